@@ -19,6 +19,7 @@
 #include "core/command_holder.h"
 
 #include <algorithm>
+#include <cctype>
 
 #include <common/sprintf.h>
 
@@ -31,7 +32,7 @@ size_t count_space(const std::string& data) {
 namespace fastonosql {
 namespace core {
 
-common::Error TestArgsInRange(const CommandInfo& cmd, commands_args_t argv) {
+common::Error TestArgsInRange(const CommandInfo& cmd, const commands_args_t& argv) {
   const size_t argc = argv.size();
   const uint16_t max = cmd.GetMaxArgumentsCount();
   const uint8_t min = cmd.GetMinArgumentsCount();
@@ -45,7 +46,7 @@ common::Error TestArgsInRange(const CommandInfo& cmd, commands_args_t argv) {
   return common::Error();
 }
 
-common::Error TestArgsModule2Equal1(const CommandInfo& cmd, commands_args_t argv) {
+common::Error TestArgsModule2Equal1(const CommandInfo& cmd, const commands_args_t& argv) {
   const size_t argc = argv.size();
   if (argc % 2 != 1) {
     std::string buff = common::MemSPrintf(
@@ -71,25 +72,33 @@ CommandHolder::CommandHolder(const std::string& name,
       white_spaces_count_(count_space(name)),
       test_funcs_(tests) {}
 
-bool CommandHolder::IsCommand(commands_args_t argv, size_t* offset) const {
-  if (argv.empty()) {
-    return false;
-  }
-
+bool CommandHolder::IsCommand(const commands_args_t& argv, size_t* offset) const {
   const size_t uargc = argv.size();
-  if (uargc == white_spaces_count_) {
+  if (uargc <= white_spaces_count_) {
     return false;
   }
 
-  CHECK(uargc > white_spaces_count_);
-  std::vector<command_buffer_t> merged;
+  // compare name word by word without joining arguments
+  size_t word_start = 0;
   for (size_t i = 0; i < white_spaces_count_ + 1; ++i) {
-    merged.push_back(argv[i]);
-  }
+    size_t word_end = name.find(' ', word_start);
+    if (word_end == std::string::npos) {
+      word_end = name.size();
+    }
 
-  command_buffer_t ws = common::JoinString(merged, " ");
-  if (!IsEqualName(ws)) {
-    return false;
+    const command_buffer_t& arg = argv[i];
+    const size_t word_len = word_end - word_start;
+    if (arg.size() != word_len) {
+      return false;
+    }
+
+    for (size_t j = 0; j < word_len; ++j) {
+      if (std::tolower(static_cast<unsigned char>(arg[j])) !=
+          std::tolower(static_cast<unsigned char>(name[word_start + j]))) {
+        return false;
+      }
+    }
+    word_start = word_end + 1;
   }
 
   if (offset) {
@@ -114,7 +123,7 @@ bool CommandHolder::IsEqualFirstName(const std::string& cmd_first_name) const {
   return IsEqualName(cmd_first_name);
 }
 
-common::Error CommandHolder::TestArgs(commands_args_t argv) const {
+common::Error CommandHolder::TestArgs(const commands_args_t& argv) const {
   const CommandInfo inf = *this;
   for (test_function_t func : test_funcs_) {
     common::Error err = func(inf, argv);
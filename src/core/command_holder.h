@@ -33,16 +33,16 @@ namespace internal {
 class CommandHandler;
 }
 
-common::Error TestArgsInRange(const CommandInfo& cmd, commands_args_t argv);
-common::Error TestArgsModule2Equal1(const CommandInfo& cmd, commands_args_t argv);
+common::Error TestArgsInRange(const CommandInfo& cmd, const commands_args_t& argv);
+common::Error TestArgsModule2Equal1(const CommandInfo& cmd, const commands_args_t& argv);
 
 class CommandHolder : public CommandInfo {
  public:
   friend class internal::CommandHandler;
 
   typedef internal::CommandHandler command_handler_t;
-  typedef std::function<common::Error(command_handler_t*, commands_args_t, FastoObject*)> function_t;
-  typedef std::function<common::Error(const CommandInfo&, commands_args_t)> test_function_t;
+  typedef std::function<common::Error(command_handler_t*, const commands_args_t&, FastoObject*)> function_t;
+  typedef std::function<common::Error(const CommandInfo&, const commands_args_t&)> test_function_t;
   typedef std::vector<test_function_t> test_functions_t;
 
   CommandHolder(const std::string& name,
@@ -56,10 +56,10 @@ class CommandHolder : public CommandInfo {
                 function_t func,
                 test_functions_t tests = {&TestArgsInRange});
 
-  bool IsCommand(commands_args_t argv, size_t* offset) const;
+  bool IsCommand(const commands_args_t& argv, size_t* offset) const;
   bool IsEqualFirstName(const std::string& cmd_first_name) const;
 
-  common::Error TestArgs(commands_args_t argv) const WARN_UNUSED_RESULT;
+  common::Error TestArgs(const commands_args_t& argv) const WARN_UNUSED_RESULT;
 
  private:
   const function_t func_;
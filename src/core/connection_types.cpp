@@ -79,7 +79,15 @@ bool IsCanSSHConnection(connectionTypes type) {
 }
 
 bool IsCanCreateDatabase(connectionTypes type) {
-  return type == LMDB || type == FORESTDB;
+  return type == ROCKSDB || type == LMDB || type == FORESTDB;
+}
+
+bool IsCanBackupLocalDatabase(connectionTypes type) {
+  return type == ROCKSDB || type == LEVELDB || type == LMDB || type == FORESTDB;
+}
+
+bool IsCanLoadKeyPages(connectionTypes type) {
+  return type == REDIS;
 }
 
 const char* ConnectionTypeToString(connectionTypes t) {
@@ -48,12 +48,15 @@ enum serverMode { STANDALONE = 0, SENTINEL, CLUSTER };
 extern const std::vector<connectionTypes> g_compiled_types;
 
 enum ConnectionMode { InteractiveMode };
+enum keysCountMode { EXACT_KEYS_COUNT = 0, ESTIMATE_KEYS_COUNT };  // estimate may use engine statistics
 
 bool IsRemoteType(connectionTypes type);
 bool IsSupportTTLKeys(connectionTypes type);
 bool IsLocalType(connectionTypes type);
 bool IsCanSSHConnection(connectionTypes type);
 bool IsCanCreateDatabase(connectionTypes type);
+bool IsCanBackupLocalDatabase(connectionTypes type);
+bool IsCanLoadKeyPages(connectionTypes type);
 const char* ConnectionTypeToString(connectionTypes t);
 
 template <connectionTypes ContType>
@@ -19,6 +19,7 @@
 #include "core/db/forestdb/command_translator.h"
 
 #include "core/connection_types.h"
+#include "core/value.h"  // for ConvertValueToArgs
 
 #define FORESTDB_GET_KEY_COMMAND DB_GET_KEY_COMMAND
 #define FORESTDB_SET_KEY_COMMAND DB_SET_KEY_COMMAND
@@ -31,43 +32,35 @@ namespace forestdb {
 
 CommandTranslator::CommandTranslator(const std::vector<CommandHolder>& commands) : ICommandTranslatorBase(commands) {}
 
-common::Error CommandTranslator::CreateKeyCommandImpl(const NDbKValue& key, command_buffer_t* cmdstring) const {
+common::Error CommandTranslator::CreateKeyCommandImpl(const NDbKValue& key, commands_args_t* argv) const {
   const NKey cur = key.GetKey();
   key_t key_str = cur.GetKey();
-  std::string value_str = key.GetValueForCommandLine();
-  command_buffer_writer_t wr;
-  wr << FORESTDB_SET_KEY_COMMAND " " << key_str.GetKeyForCommandLine() << " " << value_str;
-  *cmdstring = wr.str();
+  *argv = {FORESTDB_SET_KEY_COMMAND, key_str.GetKeyData()};
+  ConvertValueToArgs(key.GetValue().get(), argv);
   return common::Error();
 }
 
 common::Error CommandTranslator::LoadKeyCommandImpl(const NKey& key,
                                                     common::Value::Type type,
-                                                    command_buffer_t* cmdstring) const {
+                                                    commands_args_t* argv) const {
   UNUSED(type);
 
   key_t key_str = key.GetKey();
-  command_buffer_writer_t wr;
-  wr << FORESTDB_GET_KEY_COMMAND " " << key_str.GetKeyForCommandLine();
-  *cmdstring = wr.str();
+  *argv = {FORESTDB_GET_KEY_COMMAND, key_str.GetKeyData()};
   return common::Error();
 }
 
-common::Error CommandTranslator::DeleteKeyCommandImpl(const NKey& key, command_buffer_t* cmdstring) const {
+common::Error CommandTranslator::DeleteKeyCommandImpl(const NKey& key, commands_args_t* argv) const {
   key_t key_str = key.GetKey();
-  command_buffer_writer_t wr;
-  wr << FORESTDB_DELETE_KEY_COMMAND " " << key_str.GetKeyForCommandLine();
-  *cmdstring = wr.str();
+  *argv = {FORESTDB_DELETE_KEY_COMMAND, key_str.GetKeyData()};
   return common::Error();
 }
 
 common::Error CommandTranslator::RenameKeyCommandImpl(const NKey& key,
                                                       const key_t& new_name,
-                                                      command_buffer_t* cmdstring) const {
+                                                      commands_args_t* argv) const {
   key_t key_str = key.GetKey();
-  command_buffer_writer_t wr;
-  wr << FORESTDB_RENAME_KEY_COMMAND " " << key_str.GetKeyForCommandLine() << " " << new_name.GetKeyForCommandLine();
-  *cmdstring = wr.str();
+  *argv = {FORESTDB_RENAME_KEY_COMMAND, key_str.GetKeyData(), new_name.GetKeyData()};
   return common::Error();
 }
 
@@ -29,14 +29,14 @@ class CommandTranslator : public ICommandTranslatorBase {
   explicit CommandTranslator(const std::vector<CommandHolder>& commands);
 
  private:
-  virtual common::Error CreateKeyCommandImpl(const NDbKValue& key, command_buffer_t* cmdstring) const override;
+  virtual common::Error CreateKeyCommandImpl(const NDbKValue& key, commands_args_t* argv) const override;
   virtual common::Error LoadKeyCommandImpl(const NKey& key,
                                            common::Value::Type type,
-                                           command_buffer_t* cmdstring) const override;
-  virtual common::Error DeleteKeyCommandImpl(const NKey& key, command_buffer_t* cmdstring) const override;
+                                           commands_args_t* argv) const override;
+  virtual common::Error DeleteKeyCommandImpl(const NKey& key, commands_args_t* argv) const override;
   virtual common::Error RenameKeyCommandImpl(const NKey& key,
                                              const key_t& new_name,
-                                             command_buffer_t* cmdstring) const override;
+                                             commands_args_t* argv) const override;
 
   virtual bool IsLoadKeyCommandImpl(const CommandInfo& cmd) const override;
 
@@ -20,6 +20,8 @@
 
 #include <libforestdb/forestdb.h>
 
+#include <algorithm>
+
 #include <common/file_system/string_path_utils.h>
 #include <common/utils.h>  // for c_strornull
 
@@ -261,6 +263,133 @@ common::Error DBConnection::Info(const std::string& args, ServerInfo::Stats* sta
   return common::Error();
 }
 
+common::Error DBConnection::Backup(const std::string& path, internal::backup_progress_callback_t progress) {
+  common::Error err = TestIsAuthenticated();
+  if (err) {
+    return err;
+  }
+
+  size_t total = 0;
+  err = DBkcount(&total, ESTIMATE_KEYS_COUNT);
+  if (err) {
+    return err;
+  }
+
+  internal::DumpWriter writer(path);
+  err = writer.Open();
+  if (err) {
+    return err;
+  }
+
+  fdb_kvs_handle* snapshot = NULL;
+  err = CheckResultCommand(DB_BACKUP_COMMAND,
+                           fdb_snapshot_open(connection_.handle_->kvs, &snapshot, FDB_SNAPSHOT_INMEM));
+  if (err) {
+    return err;
+  }
+
+  fdb_iterator* it = NULL;
+  err = CheckResultCommand(DB_BACKUP_COMMAND, fdb_iterator_init(snapshot, &it, NULL, 0, NULL, 0, FDB_ITR_NO_DELETES));
+  if (err) {
+    fdb_kvs_close(snapshot);
+    return err;
+  }
+
+  fdb_doc* doc = NULL;
+  do {
+    fdb_status rc = fdb_iterator_get(it, &doc);
+    if (rc != FDB_RESULT_SUCCESS) {
+      break;
+    }
+
+    err = writer.Write(std::string(static_cast<const char*>(doc->key), doc->keylen),
+                       std::string(static_cast<const char*>(doc->body), doc->bodylen));
+    fdb_doc_free(doc);
+    if (err) {
+      break;
+    }
+
+    const uint64_t written = writer.GetRecordsCount();
+    if (progress && total && written % BACKUP_BATCH_SIZE == 0) {
+      progress(static_cast<int>(std::min<uint64_t>(written * 100 / total, 99)));
+    }
+  } while (fdb_iterator_next(it) != FDB_RESULT_ITERATOR_FAIL);
+  fdb_iterator_close(it);
+  fdb_kvs_close(snapshot);
+  if (err) {
+    return err;
+  }
+
+  return writer.Close();
+}
+
+common::Error DBConnection::Restore(const std::string& path, internal::backup_progress_callback_t progress) {
+  common::Error err = TestIsAuthenticated();
+  if (err) {
+    return err;
+  }
+
+  internal::DumpReader reader(path);
+  err = reader.Open();
+  if (err) {
+    return err;
+  }
+
+  // broken dump must not cost the live data
+  err = reader.Validate();
+  if (err) {
+    return err;
+  }
+
+  // database becomes a copy of dump, not a merge with it
+  err = FlushDBImpl();
+  ResetCaches();
+  if (err) {
+    return err;
+  }
+
+  size_t batch_size = 0;
+  while (true) {
+    std::string key;
+    std::string value;
+    bool eof = false;
+    err = reader.Read(&key, &value, &eof);
+    if (err || eof) {
+      break;
+    }
+
+    err = CheckResultCommand(DB_RESTORE_COMMAND, fdb_set_kv(connection_.handle_->kvs, key.data(), key.size(),
+                                                            value.data(), value.size()));
+    if (err) {
+      break;
+    }
+
+    if (++batch_size < BACKUP_BATCH_SIZE) {
+      continue;
+    }
+
+    err = CheckResultCommand(DB_RESTORE_COMMAND, fdb_commit(connection_.handle_->handle, FDB_COMMIT_NORMAL));
+    if (err) {
+      return err;
+    }
+
+    batch_size = 0;
+    if (progress) {
+      progress(std::min(reader.GetProgress(), 99));
+    }
+  }
+
+  // keep already restored part
+  common::Error commit_err =
+      CheckResultCommand(DB_RESTORE_COMMAND, fdb_commit(connection_.handle_->handle, FDB_COMMIT_NORMAL));
+  ResetCaches();
+  if (err) {
+    return err;
+  }
+
+  return commit_err;
+}
+
 common::Error DBConnection::ConfigGetDatabases(std::vector<std::string>* dbs) {
   if (!dbs) {
     DNOTREACHED();
@@ -328,15 +457,19 @@ common::Error DBConnection::ScanImpl(uint64_t cursor_in,
                                      uint64_t* cursor_out) {
   fdb_iterator* it = NULL;
   fdb_iterator_opt_t opt = FDB_ITR_NONE;
+  std::string last_key;
+  bool is_resumed = scan_cursors_.Find(cursor_in, pattern, &last_key);
+  const void* start_key = is_resumed ? last_key.data() : NULL;
+  size_t start_keylen = is_resumed ? last_key.size() : 0;
 
-  common::Error err =
-      CheckResultCommand(DB_SCAN_COMMAND, fdb_iterator_init(connection_.handle_->kvs, &it, NULL, 0, NULL, 0, opt));
+  common::Error err = CheckResultCommand(
+      DB_SCAN_COMMAND, fdb_iterator_init(connection_.handle_->kvs, &it, start_key, start_keylen, NULL, 0, opt));
   if (err) {
     return err;
   }
 
   fdb_doc* doc = NULL;
-  uint64_t offset_pos = cursor_in;
+  uint64_t offset_pos = is_resumed ? 0 : cursor_in;
   uint64_t lcursor_out = 0;
   std::vector<std::string> lkeys_out;
   do {
@@ -347,7 +480,9 @@ common::Error DBConnection::ScanImpl(uint64_t cursor_in,
 
     if (lkeys_out.size() < count_keys) {
       std::string skey = std::string(static_cast<const char*>(doc->key), doc->keylen);
-      if (common::MatchPattern(skey, pattern)) {
+      if (is_resumed && skey == last_key) {  // start key is inclusive
+        is_resumed = false;
+      } else if (common::MatchPattern(skey, pattern)) {
         if (offset_pos == 0) {
           lkeys_out.push_back(skey);
         } else {
@@ -362,6 +497,10 @@ common::Error DBConnection::ScanImpl(uint64_t cursor_in,
   } while (fdb_iterator_next(it) != FDB_RESULT_ITERATOR_FAIL);
   fdb_iterator_close(it);
 
+  if (lcursor_out != 0 && !lkeys_out.empty()) {
+    scan_cursors_.Register(lcursor_out, pattern, lkeys_out.back());
+  }
+
   *keys_out = lkeys_out;
   *cursor_out = lcursor_out;
   return common::Error();
@@ -428,6 +567,17 @@ common::Error DBConnection::DBkcountImpl(size_t* size) {
   return common::Error();
 }
 
+common::Error DBConnection::DBkcountEstimateImpl(size_t* size) {
+  fdb_kvs_info info;
+  common::Error err = CheckResultCommand(DB_DBKCOUNT_COMMAND, fdb_get_kvs_info(connection_.handle_->kvs, &info));
+  if (err) {
+    return err;
+  }
+
+  *size = info.doc_count;
+  return common::Error();
+}
+
 common::Error DBConnection::FlushDBImpl() {
   fdb_iterator* it = NULL;
   fdb_iterator_opt_t opt = FDB_ITR_NONE;
@@ -491,7 +641,7 @@ common::Error DBConnection::SelectImpl(const std::string& name, IDataBaseInfo**
 
   connection_.config_->db_name = name;
   size_t kcount = 0;
-  err = DBkcount(&kcount);
+  err = DBkcount(&kcount, ESTIMATE_KEYS_COUNT);
   DCHECK(!err) << "DBkcount failed!";
   *info = new DataBaseInfo(name, true, kcount);
   return common::Error();
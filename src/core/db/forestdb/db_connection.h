@@ -20,6 +20,7 @@
 
 #include <libforestdb/fdb_errors.h>
 
+#include "core/internal/backup.h"  // for backup_progress_callback_t
 #include "core/internal/cdb_connection.h"  // for CDBConnection
 
 #include "core/db/forestdb/config.h"
@@ -42,6 +43,8 @@ class DBConnection : public core::internal::CDBConnection<NativeConnection, Conf
 
   virtual std::string GetCurrentDBName() const override;
   common::Error Info(const std::string& args, ServerInfo::Stats* statsout) WARN_UNUSED_RESULT;
+  common::Error Backup(const std::string& path, internal::backup_progress_callback_t progress) WARN_UNUSED_RESULT;
+  common::Error Restore(const std::string& path, internal::backup_progress_callback_t progress) WARN_UNUSED_RESULT;
   common::Error ConfigGetDatabases(std::vector<std::string>* dbs) WARN_UNUSED_RESULT;
 
  private:
@@ -61,6 +64,7 @@ class DBConnection : public core::internal::CDBConnection<NativeConnection, Conf
                                  uint64_t limit,
                                  std::vector<std::string>* ret) override;
   virtual common::Error DBkcountImpl(size_t* size) override;
+  virtual common::Error DBkcountEstimateImpl(size_t* size) override;
   virtual common::Error FlushDBImpl() override;
   virtual common::Error CreateDBImpl(const std::string& name, IDataBaseInfo** info) override;
   virtual common::Error RemoveDBImpl(const std::string& name, IDataBaseInfo** info) override;
@@ -162,7 +162,7 @@ const internal::ConstantCommandsArray g_commands = {CommandHolder(DB_HELP_COMMAN
                                                                   CommandInfo::Native,
                                                                   &CommandsApi::Quit)};
 
-common::Error CommandsApi::Info(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Info(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* mdb = static_cast<DBConnection*>(handler);
   ServerInfo::Stats statsout;
   common::Error err = mdb->Info(argv.size() == 1 ? argv[0] : std::string(), &statsout);
@@ -176,7 +176,7 @@ common::Error CommandsApi::Info(internal::CommandHandler* handler, commands_args
   return common::Error();
 }
 
-common::Error CommandsApi::ConfigGet(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::ConfigGet(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* mdb = static_cast<DBConnection*>(handler);
   if (argv[0] != "databases") {
     return common::make_error_inval();
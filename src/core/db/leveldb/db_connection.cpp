@@ -20,6 +20,9 @@
 
 #include <leveldb/c.h>  // for leveldb_major_version, etc
 #include <leveldb/db.h>
+#include <leveldb/write_batch.h>
+
+#include <algorithm>
 
 #include <common/file_system/string_path_utils.h>
 
@@ -28,6 +31,9 @@
 #include "core/db/leveldb/database_info.h"
 #include "core/db/leveldb/internal/commands_api.h"
 
+#define KCOUNT_SAMPLE_SIZE 10000
+#define FLUSHDB_BATCH_SIZE 10000
+
 #define LEVELDB_HEADER_STATS                             \
   "                               Compactions\n"         \
   "Level  Files Size(MB) Time(sec) Read(MB) Write(MB)\n" \
@@ -126,7 +132,11 @@ common::Error TestConnection(const Config& config) {
 }
 
 DBConnection::DBConnection(CDBConnectionClient* client)
-    : base_class(client, new CommandTranslator(base_class::GetCommands())) {}
+    : base_class(client, new CommandTranslator(base_class::GetCommands())), flushdb_progress_() {}
+
+void DBConnection::SetFlushDBProgress(internal::backup_progress_callback_t progress) {
+  flushdb_progress_ = progress;
+}
 
 common::Error DBConnection::Info(const std::string& args, ServerInfo::Stats* statsout) {
   UNUSED(args);
@@ -200,6 +210,122 @@ common::Error DBConnection::Info(const std::string& args, ServerInfo::Stats* sta
   return common::Error();
 }
 
+common::Error DBConnection::Backup(const std::string& path, internal::backup_progress_callback_t progress) {
+  common::Error err = TestIsAuthenticated();
+  if (err) {
+    return err;
+  }
+
+  size_t total = 0;
+  err = DBkcount(&total, ESTIMATE_KEYS_COUNT);
+  if (err) {
+    return err;
+  }
+
+  internal::DumpWriter writer(path);
+  err = writer.Open();
+  if (err) {
+    return err;
+  }
+
+  const ::leveldb::Snapshot* snapshot = connection_.handle_->GetSnapshot();
+  ::leveldb::ReadOptions ro;
+  ro.fill_cache = false;
+  ro.snapshot = snapshot;
+  ::leveldb::Iterator* it = connection_.handle_->NewIterator(ro);
+  for (it->SeekToFirst(); it->Valid(); it->Next()) {
+    err = writer.Write(it->key().ToString(), it->value().ToString());
+    if (err) {
+      break;
+    }
+
+    const uint64_t written = writer.GetRecordsCount();
+    if (progress && total && written % BACKUP_BATCH_SIZE == 0) {
+      progress(static_cast<int>(std::min<uint64_t>(written * 100 / total, 99)));
+    }
+  }
+
+  auto st = it->status();
+  delete it;
+  connection_.handle_->ReleaseSnapshot(snapshot);
+  if (err) {
+    return err;
+  }
+
+  err = CheckResultCommand(DB_BACKUP_COMMAND, st);
+  if (err) {
+    return err;
+  }
+
+  return writer.Close();
+}
+
+common::Error DBConnection::Restore(const std::string& path, internal::backup_progress_callback_t progress) {
+  common::Error err = TestIsAuthenticated();
+  if (err) {
+    return err;
+  }
+
+  internal::DumpReader reader(path);
+  err = reader.Open();
+  if (err) {
+    return err;
+  }
+
+  // broken dump must not cost the live data
+  err = reader.Validate();
+  if (err) {
+    return err;
+  }
+
+  // database becomes a copy of dump, not a merge with it
+  err = FlushDBImpl();
+  ResetCaches();
+  if (err) {
+    return err;
+  }
+
+  ::leveldb::WriteOptions wo;
+  ::leveldb::WriteBatch batch;
+  size_t batch_size = 0;
+  while (true) {
+    std::string key;
+    std::string value;
+    bool eof = false;
+    err = reader.Read(&key, &value, &eof);
+    if (err) {
+      return err;
+    }
+
+    if (!eof) {
+      batch.Put(key, value);
+      if (++batch_size < BACKUP_BATCH_SIZE) {
+        continue;
+      }
+    }
+
+    if (batch_size != 0) {
+      err = CheckResultCommand(DB_RESTORE_COMMAND, connection_.handle_->Write(wo, &batch));
+      if (err) {
+        return err;
+      }
+      batch.Clear();
+      batch_size = 0;
+    }
+
+    if (eof) {
+      break;
+    }
+
+    if (progress) {
+      progress(std::min(reader.GetProgress(), 99));
+    }
+  }
+
+  ResetCaches();
+  return common::Error();
+}
+
 common::Error DBConnection::DelInner(key_t key) {
   std::string exist_key;
   common::Error err = GetInner(key, &exist_key);
@@ -234,10 +360,20 @@ common::Error DBConnection::ScanImpl(uint64_t cursor_in,
                                      uint64_t* cursor_out) {
   ::leveldb::ReadOptions ro;
   ::leveldb::Iterator* it = connection_.handle_->NewIterator(ro);
-  uint64_t offset_pos = cursor_in;
+  std::string last_key;
+  bool is_resumed = scan_cursors_.Find(cursor_in, pattern, &last_key);
+  uint64_t offset_pos = is_resumed ? 0 : cursor_in;
   uint64_t lcursor_out = 0;
   std::vector<std::string> lkeys_out;
-  for (it->SeekToFirst(); it->Valid(); it->Next()) {
+  if (is_resumed) {
+    it->Seek(last_key);
+    if (it->Valid() && it->key() == last_key) {
+      it->Next();
+    }
+  } else {
+    it->SeekToFirst();
+  }
+  for (; it->Valid(); it->Next()) {
     std::string key = it->key().ToString();
     if (lkeys_out.size() < count_keys) {
       if (common::MatchPattern(key, pattern)) {
@@ -261,6 +397,10 @@ common::Error DBConnection::ScanImpl(uint64_t cursor_in,
     return err;
   }
 
+  if (lcursor_out != 0 && !lkeys_out.empty()) {
+    scan_cursors_.Register(lcursor_out, pattern, lkeys_out.back());
+  }
+
   *keys_out = lkeys_out;
   *cursor_out = lcursor_out;
   return common::Error();
@@ -312,23 +452,110 @@ common::Error DBConnection::DBkcountImpl(size_t* size) {
   return common::Error();
 }
 
+common::Error DBConnection::DBkcountEstimateImpl(size_t* size) {
+  ::leveldb::ReadOptions ro;
+  ro.fill_cache = false;
+  ::leveldb::Iterator* it = connection_.handle_->NewIterator(ro);
+  size_t sampled = 0;
+  std::string first_key;
+  std::string last_sampled_key;
+  for (it->SeekToFirst(); it->Valid() && sampled < KCOUNT_SAMPLE_SIZE; it->Next()) {
+    if (sampled == 0) {
+      first_key = it->key().ToString();
+    }
+    last_sampled_key = it->key().ToString();
+    sampled++;
+  }
+
+  if (!it->Valid()) {  // whole database sampled
+    auto st = it->status();
+    delete it;
+    common::Error err = CheckResultCommand(DB_DBKCOUNT_COMMAND, st);
+    if (err) {
+      return err;
+    }
+
+    *size = sampled;
+    return common::Error();
+  }
+
+  it->SeekToLast();
+  std::string last_key = it->Valid() ? it->key().ToString() : last_sampled_key;
+  auto st = it->status();
+  delete it;
+  common::Error err = CheckResultCommand(DB_DBKCOUNT_COMMAND, st);
+  if (err) {
+    return err;
+  }
+
+  ::leveldb::Range ranges[2] = {::leveldb::Range(first_key, last_sampled_key), ::leveldb::Range(first_key, last_key)};
+  uint64_t sizes[2] = {0, 0};
+  connection_.handle_->GetApproximateSizes(ranges, SIZEOFMASS(ranges), sizes);
+  if (sizes[0] == 0 || sizes[1] < sizes[0]) {  // data still in memtable, approximation is useless
+    return DBkcountImpl(size);
+  }
+
+  *size = static_cast<size_t>(static_cast<double>(sampled) * sizes[1] / sizes[0]);
+  return common::Error();
+}
+
 common::Error DBConnection::FlushDBImpl() {
+  size_t total = 0;
+  if (flushdb_progress_) {
+    common::Error err = DBkcountEstimateImpl(&total);
+    if (err) {
+      total = 0;  // flush without progress
+    }
+  }
+
   ::leveldb::ReadOptions ro;
+  ro.fill_cache = false;
   ::leveldb::WriteOptions wo;
-  ::leveldb::Iterator* it = connection_.handle_->NewIterator(ro);
+  ::leveldb::Iterator* it = connection_.handle_->NewIterator(ro);  // iterates over implicit snapshot
+  ::leveldb::WriteBatch batch;
+  size_t batch_size = 0;
+  uint64_t removed = 0;
   for (it->SeekToFirst(); it->Valid(); it->Next()) {
-    std::string key = it->key().ToString();
-    common::Error err = CheckResultCommand(DB_FLUSHDB_COMMAND, connection_.handle_->Delete(wo, key));
+    batch.Delete(it->key());
+    if (++batch_size < FLUSHDB_BATCH_SIZE) {
+      continue;
+    }
+
+    common::Error err = CheckResultCommand(DB_FLUSHDB_COMMAND, connection_.handle_->Write(wo, &batch));
     if (err) {
       delete it;
       return err;
     }
+
+    removed += batch_size;
+    batch.Clear();
+    batch_size = 0;
+    if (flushdb_progress_ && total) {
+      flushdb_progress_(static_cast<int>(std::min<uint64_t>(removed * 100 / total, 99)));
+    }
+    if (IsInterrupted()) {
+      delete it;
+      return common::make_error("Interrupted " DB_FLUSHDB_COMMAND " command.");
+    }
   }
 
   auto st = it->status();
   delete it;
 
-  return CheckResultCommand(DB_FLUSHDB_COMMAND, st);
+  common::Error err = CheckResultCommand(DB_FLUSHDB_COMMAND, st);
+  if (err) {
+    return err;
+  }
+
+  if (batch_size != 0) {
+    err = CheckResultCommand(DB_FLUSHDB_COMMAND, connection_.handle_->Write(wo, &batch));
+    if (err) {
+      return err;
+    }
+  }
+
+  connection_.handle_->CompactRange(nullptr, nullptr);
+  return common::Error();
 }
 
 common::Error DBConnection::SelectImpl(const std::string& name, IDataBaseInfo** info) {
@@ -337,22 +564,47 @@ common::Error DBConnection::SelectImpl(const std::string& name, IDataBaseInfo**
   }
 
   size_t kcount = 0;
-  common::Error err = DBkcount(&kcount);
+  common::Error err = DBkcount(&kcount, ESTIMATE_KEYS_COUNT);
   DCHECK(!err);
   *info = new DataBaseInfo(name, true, kcount);
   return common::Error();
 }
 
 common::Error DBConnection::DeleteImpl(const NKeys& keys, NKeys* deleted_keys) {
-  for (size_t i = 0; i < keys.size(); ++i) {
-    NKey key = keys[i];
-    key_t key_str = key.GetKey();
-    common::Error err = DelInner(key_str);
-    if (err) {
+  // one WriteBatch per DELETE_BATCH_SIZE existing keys
+  ::leveldb::ReadOptions ro;
+  ::leveldb::WriteOptions wo;
+  for (size_t start = 0; start < keys.size(); start += DELETE_BATCH_SIZE) {
+    const size_t end = std::min(keys.size(), start + DELETE_BATCH_SIZE);
+    ::leveldb::WriteBatch batch;
+    NKeys batch_keys;
+    for (size_t i = start; i < end; ++i) {
+      const string_key_t key_str = keys[i].GetKey().GetKeyData();
+      const ::leveldb::Slice key_slice(reinterpret_cast<const char*>(key_str.data()), key_str.size());
+      std::string value_str;
+      ::leveldb::Status st = connection_.handle_->Get(ro, key_slice, &value_str);
+      if (st.IsNotFound()) {
+        continue;
+      }
+
+      common::Error err = CheckResultCommand(DB_DELETE_KEY_COMMAND, st);
+      if (err) {
+        return err;
+      }
+
+      batch.Delete(key_slice);  // copies key
+      batch_keys.push_back(keys[i]);
+    }
+
+    if (batch_keys.empty()) {
       continue;
     }
 
-    deleted_keys->push_back(key);
+    common::Error err = CheckResultCommand(DB_DELETE_KEY_COMMAND, connection_.handle_->Write(wo, &batch));
+    if (err) {
+      return err;
+    }
+    deleted_keys->insert(deleted_keys->end(), batch_keys.begin(), batch_keys.end());
   }
 
   return common::Error();
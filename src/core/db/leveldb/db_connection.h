@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include "core/internal/backup.h"  // for backup_progress_callback_t
 #include "core/internal/cdb_connection.h"  // for CDBConnection
 
 #include "core/db/leveldb/config.h"
@@ -43,6 +44,9 @@ class DBConnection : public core::internal::CDBConnection<NativeConnection, Conf
   explicit DBConnection(CDBConnectionClient* client);
 
   common::Error Info(const std::string& args, ServerInfo::Stats* statsout) WARN_UNUSED_RESULT;
+  common::Error Backup(const std::string& path, internal::backup_progress_callback_t progress) WARN_UNUSED_RESULT;
+  common::Error Restore(const std::string& path, internal::backup_progress_callback_t progress) WARN_UNUSED_RESULT;
+  void SetFlushDBProgress(internal::backup_progress_callback_t progress);  // empty callback to reset
 
  private:
   common::Error CheckResultCommand(const std::string& cmd, const ::leveldb::Status& err) WARN_UNUSED_RESULT;
@@ -61,6 +65,7 @@ class DBConnection : public core::internal::CDBConnection<NativeConnection, Conf
                                  uint64_t limit,
                                  std::vector<std::string>* ret) override;
   virtual common::Error DBkcountImpl(size_t* size) override;
+  virtual common::Error DBkcountEstimateImpl(size_t* size) override;
   virtual common::Error FlushDBImpl() override;
   virtual common::Error SelectImpl(const std::string& name, IDataBaseInfo** info) override;
   virtual common::Error DeleteImpl(const NKeys& keys, NKeys* deleted_keys) override;
@@ -68,6 +73,8 @@ class DBConnection : public core::internal::CDBConnection<NativeConnection, Conf
   virtual common::Error GetImpl(const NKey& key, NDbKValue* loaded_key) override;
   virtual common::Error RenameImpl(const NKey& key, string_key_t new_key) override;
   virtual common::Error QuitImpl() override;
+
+  internal::backup_progress_callback_t flushdb_progress_;
 };
 
 }  // namespace leveldb
@@ -20,11 +20,14 @@
 
 #include <errno.h>   // for EACCES
 #include <lmdb.h>    // for mdb_txn_abort, MDB_val
+#include <stdio.h>   // for rename, remove
 #include <stdlib.h>  // for NULL, free, calloc
+#include <string.h>  // for strerror
 #include <time.h>    // for time_t
 #include <string>    // for string
 
 #include <common/convert2string.h>
+#include <common/file_system/file_system.h>  // for copy_file, create_directory
 #include <common/file_system/string_path_utils.h>
 #include <common/utils.h>  // for c_strornull
 #include <common/value.h>  // for StringValue (ptr only)
@@ -35,6 +38,7 @@
 #include "core/db/lmdb/internal/commands_api.h"
 
 #define LMDB_OK 0
+#define LMDB_DATA_FILE_NAME "data.mdb"
 
 namespace fastonosql {
 namespace core {
@@ -328,6 +332,79 @@ common::Error DBConnection::Info(const std::string& args, ServerInfo::Stats* sta
   return common::Error();
 }
 
+common::Error DBConnection::Backup(const std::string& path, internal::backup_progress_callback_t progress) {
+  UNUSED(progress);  // mdb_env_copy2 doesn't report percents
+
+  common::Error err = TestIsAuthenticated();
+  if (err) {
+    return err;
+  }
+
+  auto conf = GetConfig();
+  if (!conf->IsSingleFileDB()) {  // copy is written into data.mdb of path folder
+    common::ErrnoError errn = common::file_system::create_directory(path, true);
+    if (errn) {
+      return common::make_error_from_errno(errn);
+    }
+  }
+
+  // consistent copy from read transaction, writers aren't blocked, free pages are omitted
+  return CheckResultCommand(DB_BACKUP_COMMAND, mdb_env_copy2(connection_.handle_->env, path.c_str(), MDB_CP_COMPACT));
+}
+
+common::Error DBConnection::Restore(const std::string& path, internal::backup_progress_callback_t progress) {
+  UNUSED(progress);
+
+  common::Error err = TestIsAuthenticated();
+  if (err) {
+    return err;
+  }
+
+  const config_t conf = GetConfig();
+  if (conf->ReadOnlyDB()) {
+    return GenerateError(DB_RESTORE_COMMAND, "database opened in read only mode");
+  }
+
+  std::string from = path;  // data file or folder made by Backup
+  if (common::file_system::is_directory(from) == common::SUCCESS) {
+    from += "/" LMDB_DATA_FILE_NAME;
+  }
+  std::string to = conf->db_path;
+  if (!conf->IsSingleFileDB()) {
+    to += "/" LMDB_DATA_FILE_NAME;
+  }
+
+  // copy next to data file and rename it over, so failed copy leaves database as it was
+  const std::string tmp = to + ".restore";
+  common::ErrnoError errn = common::file_system::copy_file(from, tmp);
+  if (errn) {
+    return common::make_error_from_errno(errn);
+  }
+
+  // environment maps data file, so it have to be closed while file replaced
+  err = Disconnect();
+  if (err) {
+    return err;
+  }
+
+#if defined(OS_WIN)
+  remove(to.c_str());  // rename doesn't replace existing file on windows
+#endif
+  const int rename_res = rename(tmp.c_str(), to.c_str());
+  const int rename_errno = errno;
+  ResetCaches();
+  err = Connect(conf);
+  if (err) {
+    return err;
+  }
+
+  if (rename_res != 0) {
+    return GenerateError(DB_RESTORE_COMMAND, strerror(rename_errno));
+  }
+
+  return common::Error();
+}
+
 common::Error DBConnection::ConfigGetDatabases(std::vector<std::string>* dbs) {
   if (!dbs) {
     DNOTREACHED();
@@ -498,10 +575,23 @@ common::Error DBConnection::ScanImpl(uint64_t cursor_in,
 
   MDB_val key;
   MDB_val data;
-  uint64_t offset_pos = cursor_in;
+  std::string last_key;
+  bool is_resumed = scan_cursors_.Find(cursor_in, pattern, &last_key);
+  uint64_t offset_pos = is_resumed ? 0 : cursor_in;
   uint64_t lcursor_out = 0;
   std::vector<std::string> lkeys_out;
-  while ((mdb_cursor_get(cursor, &key, &data, MDB_NEXT) == LMDB_OK)) {
+  MDB_cursor_op op = MDB_NEXT;
+  bool is_valid = true;
+  if (is_resumed) {
+    key.mv_size = last_key.size();
+    key.mv_data = const_cast<char*>(last_key.data());
+    is_valid = mdb_cursor_get(cursor, &key, &data, MDB_SET_RANGE) == LMDB_OK;
+    if (is_valid && std::string(reinterpret_cast<const char*>(key.mv_data), key.mv_size) != last_key) {
+      op = MDB_GET_CURRENT;
+    }
+  }
+  while (is_valid && mdb_cursor_get(cursor, &key, &data, op) == LMDB_OK) {
+    op = MDB_NEXT;
     if (lkeys_out.size() < count_keys) {
       std::string skey(reinterpret_cast<const char*>(key.mv_data), key.mv_size);
       if (common::MatchPattern(skey, pattern)) {
@@ -517,6 +607,10 @@ common::Error DBConnection::ScanImpl(uint64_t cursor_in,
     }
   }
 
+  if (lcursor_out != 0 && !lkeys_out.empty()) {
+    scan_cursors_.Register(lcursor_out, pattern, lkeys_out.back());
+  }
+
   *keys_out = lkeys_out;
   *cursor_out = lcursor_out;
   mdb_cursor_close(cursor);
@@ -557,7 +651,6 @@ common::Error DBConnection::KeysImpl(const std::string& key_start,
 }
 
 common::Error DBConnection::DBkcountImpl(size_t* size) {
-  MDB_cursor* cursor = NULL;
   MDB_txn* txn = NULL;
   common::Error err =
       CheckResultCommand(DB_DBKCOUNT_COMMAND, mdb_txn_begin(connection_.handle_->env, NULL, MDB_RDONLY, &txn));
@@ -565,22 +658,14 @@ common::Error DBConnection::DBkcountImpl(size_t* size) {
     return err;
   }
 
-  err = CheckResultCommand(DB_DBKCOUNT_COMMAND, mdb_cursor_open(txn, connection_.handle_->dbi, &cursor));
+  MDB_stat stat;
+  err = CheckResultCommand(DB_DBKCOUNT_COMMAND, mdb_stat(txn, connection_.handle_->dbi, &stat));
+  mdb_txn_abort(txn);
   if (err) {
-    mdb_txn_abort(txn);
     return err;
   }
 
-  MDB_val key;
-  MDB_val data;
-  size_t sz = 0;
-  while (mdb_cursor_get(cursor, &key, &data, MDB_NEXT) == LMDB_OK) {
-    sz++;
-  }
-  mdb_cursor_close(cursor);
-  mdb_txn_abort(txn);
-
-  *size = sz;
+  *size = stat.ms_entries;
   return common::Error();
 }
 
@@ -693,17 +778,40 @@ common::Error DBConnection::GetImpl(const NKey& key, NDbKValue* loaded_key) {
 }
 
 common::Error DBConnection::DeleteImpl(const NKeys& keys, NKeys* deleted_keys) {
+  // single write transaction for all keys
+  MDB_txn* txn = NULL;
+  auto conf = GetConfig();
+  int env_flags = conf->env_flags;
+  common::Error err =
+      CheckResultCommand(DB_DELETE_KEY_COMMAND,
+                         mdb_txn_begin(connection_.handle_->env, NULL, lmdb_db_flag_from_env_flags(env_flags), &txn));
+  if (err) {
+    return err;
+  }
+
+  NKeys removed;
   for (size_t i = 0; i < keys.size(); ++i) {
-    NKey key = keys[i];
-    key_t key_str = key.GetKey();
-    common::Error err = DelInner(key_str);
-    if (err) {
+    const string_key_t key_str = keys[i].GetKey().GetKeyData();
+    MDB_val key_slice = ConvertToLMDBSlice(key_str.data(), key_str.size());
+    int rc = mdb_del(txn, connection_.handle_->dbi, &key_slice, NULL);
+    if (rc == MDB_NOTFOUND) {
       continue;
     }
 
-    deleted_keys->push_back(key);
+    err = CheckResultCommand(DB_DELETE_KEY_COMMAND, rc);
+    if (err) {
+      mdb_txn_abort(txn);
+      return err;
+    }
+    removed.push_back(keys[i]);
+  }
+
+  err = CheckResultCommand(DB_DELETE_KEY_COMMAND, mdb_txn_commit(txn));
+  if (err) {
+    return err;
   }
 
+  deleted_keys->insert(deleted_keys->end(), removed.begin(), removed.end());
   return common::Error();
 }
 
@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include "core/internal/backup.h"  // for backup_progress_callback_t
 #include "core/internal/cdb_connection.h"  // for CDBConnection
 
 #include "core/db/lmdb/config.h"
@@ -40,6 +41,8 @@ class DBConnection : public core::internal::CDBConnection<NativeConnection, Conf
 
   virtual std::string GetCurrentDBName() const override;
   common::Error Info(const std::string& args, ServerInfo::Stats* statsout) WARN_UNUSED_RESULT;
+  common::Error Backup(const std::string& path, internal::backup_progress_callback_t progress) WARN_UNUSED_RESULT;
+  common::Error Restore(const std::string& path, internal::backup_progress_callback_t progress) WARN_UNUSED_RESULT;
   common::Error ConfigGetDatabases(std::vector<std::string>* dbs) WARN_UNUSED_RESULT;
   common::Error DropDatabase() WARN_UNUSED_RESULT;
 
@@ -171,7 +171,7 @@ const internal::ConstantCommandsArray g_commands = {CommandHolder(DB_HELP_COMMAN
                                                                   CommandInfo::Native,
                                                                   &CommandsApi::Quit)};
 
-common::Error CommandsApi::Info(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Info(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* mdb = static_cast<DBConnection*>(handler);
   ServerInfo::Stats statsout;
   common::Error err = mdb->Info(argv.size() == 1 ? argv[0] : std::string(), &statsout);
@@ -185,7 +185,7 @@ common::Error CommandsApi::Info(internal::CommandHandler* handler, commands_args
   return common::Error();
 }
 
-common::Error CommandsApi::ConfigGet(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::ConfigGet(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* mdb = static_cast<DBConnection*>(handler);
   if (argv[0] != "databases") {
     return common::make_error_inval();
@@ -204,7 +204,9 @@ common::Error CommandsApi::ConfigGet(internal::CommandHandler* handler, commands
   return common::Error();
 }
 
-common::Error CommandsApi::DropDatabase(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::DropDatabase(internal::CommandHandler* handler,
+                                        const commands_args_t& argv,
+                                        FastoObject* out) {
   UNUSED(argv);
   DBConnection* mdb = static_cast<DBConnection*>(handler);
   ServerInfo::Stats statsout;
@@ -28,9 +28,9 @@ namespace lmdb {
 
 class DBConnection;
 struct CommandsApi : public internal::ApiTraits<DBConnection> {
-  static common::Error Info(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out);
-  static common::Error ConfigGet(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out);
-  static common::Error DropDatabase(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out);
+  static common::Error Info(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out);
+  static common::Error ConfigGet(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out);
+  static common::Error DropDatabase(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out);
 };
 
 extern const internal::ConstantCommandsArray g_commands;
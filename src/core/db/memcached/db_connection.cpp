@@ -674,6 +674,27 @@ common::Error DBConnection::DBkcountImpl(size_t* size) {
   return common::Error();
 }
 
+common::Error DBConnection::DBkcountEstimateImpl(size_t* size) {
+  memcached_return_t error;
+  memcached_stat_st* st = memcached_stat(connection_.handle_, NULL, &error);
+  common::Error err = CheckResultCommand(DB_DBKCOUNT_COMMAND, error);
+  if (err) {
+    if (st) {  // allocated even if some servers failed
+      memcached_stat_free(NULL, st);
+    }
+    return err;
+  }
+
+  size_t sz = 0;
+  for (uint32_t i = 0; i < memcached_server_count(connection_.handle_); ++i) {
+    sz += st[i].curr_items;
+  }
+
+  memcached_stat_free(NULL, st);
+  *size = sz;
+  return common::Error();
+}
+
 common::Error DBConnection::FlushDBImpl() {
   return CheckResultCommand(DB_FLUSHDB_COMMAND, memcached_flush(connection_.handle_, 0));
 }
@@ -684,7 +705,7 @@ common::Error DBConnection::SelectImpl(const std::string& name, IDataBaseInfo**
   }
 
   size_t kcount = 0;
-  common::Error err = DBkcount(&kcount);
+  common::Error err = DBkcount(&kcount, ESTIMATE_KEYS_COUNT);
   // DCHECK(!err);
   *info = new DataBaseInfo(name, true, kcount);
   return common::Error();
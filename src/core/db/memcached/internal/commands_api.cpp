@@ -236,7 +236,7 @@ const internal::ConstantCommandsArray g_commands = {CommandHolder(DB_HELP_COMMAN
                                                                   CommandInfo::Native,
                                                                   &CommandsApi::Quit)};
 
-common::Error CommandsApi::Version(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Version(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   UNUSED(argv);
   UNUSED(out);
 
@@ -244,7 +244,7 @@ common::Error CommandsApi::Version(internal::CommandHandler* handler, commands_a
   return mem->VersionServer();
 }
 
-common::Error CommandsApi::Info(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Info(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* mem = static_cast<DBConnection*>(handler);
   std::string args = argv.size() == 1 ? argv[0] : std::string();
   if (args.empty() && strcasecmp(args.c_str(), "items") == 0) {
@@ -265,7 +265,7 @@ common::Error CommandsApi::Info(internal::CommandHandler* handler, commands_args
   return common::Error();
 }
 
-common::Error CommandsApi::Add(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Add(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   key_t key_str(argv[0]);
   NKey key(key_str);
   DBConnection* mem = static_cast<DBConnection*>(handler);
@@ -290,7 +290,7 @@ common::Error CommandsApi::Add(internal::CommandHandler* handler, commands_args_
   return common::Error();
 }
 
-common::Error CommandsApi::Replace(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Replace(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   key_t key_str(argv[0]);
   NKey key(key_str);
   DBConnection* mem = static_cast<DBConnection*>(handler);
@@ -315,7 +315,7 @@ common::Error CommandsApi::Replace(internal::CommandHandler* handler, commands_a
   return common::Error();
 }
 
-common::Error CommandsApi::Append(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Append(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   key_t key_str(argv[0]);
   NKey key(key_str);
   DBConnection* mem = static_cast<DBConnection*>(handler);
@@ -339,7 +339,7 @@ common::Error CommandsApi::Append(internal::CommandHandler* handler, commands_ar
   return common::Error();
 }
 
-common::Error CommandsApi::Prepend(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Prepend(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   key_t key_str(argv[0]);
   NKey key(key_str);
   DBConnection* mem = static_cast<DBConnection*>(handler);
@@ -363,7 +363,7 @@ common::Error CommandsApi::Prepend(internal::CommandHandler* handler, commands_a
   return common::Error();
 }
 
-common::Error CommandsApi::Incr(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Incr(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   key_t key_str(argv[0]);
   NKey key(key_str);
   DBConnection* mem = static_cast<DBConnection*>(handler);
@@ -383,7 +383,7 @@ common::Error CommandsApi::Incr(internal::CommandHandler* handler, commands_args
   return common::Error();
 }
 
-common::Error CommandsApi::Decr(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Decr(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   key_t key_str(argv[0]);
   NKey key(key_str);
   DBConnection* mem = static_cast<DBConnection*>(handler);
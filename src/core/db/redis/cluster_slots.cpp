@@ -0,0 +1,295 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "core/db/redis/cluster_slots.h"
+
+#include <hiredis/hiredis.h>
+
+#include <common/convert2string.h>  // for ConvertFromString
+#include <common/macros.h>          // for SIZEOFMASS
+#include <common/string_util.h>     // for FullEqualsASCII
+
+#define MOVED_PREFIX "MOVED "
+#define ASK_PREFIX "ASK "
+
+namespace fastonosql {
+namespace core {
+namespace redis {
+
+namespace {
+
+// CRC16 XMODEM (poly 0x1021)
+struct Crc16Table {
+  Crc16Table() {
+    for (uint16_t i = 0; i < SIZEOFMASS(values); ++i) {
+      uint16_t crc = i << 8;
+      for (int j = 0; j < 8; ++j) {
+        crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+      }
+      values[i] = crc;
+    }
+  }
+
+  uint16_t values[256];
+};
+
+const uint16_t* GetCrc16Table() {
+  static const Crc16Table table;  // thread safe initialization
+  return table.values;
+}
+
+uint16_t Crc16(const char* buf, size_t len) {
+  const uint16_t* table = GetCrc16Table();
+  uint16_t crc = 0;
+  for (size_t i = 0; i < len; ++i) {
+    crc = (crc << 8) ^ table[((crc >> 8) ^ static_cast<uint8_t>(buf[i])) & 0xff];
+  }
+  return crc;
+}
+
+bool IsCommand(const std::string& name, const char* command) {
+  return common::FullEqualsASCII(name, command, false);
+}
+
+bool ParseHostAndPort(const std::string& str, common::net::HostAndPort* host) {
+  const size_t pos = str.rfind(':');
+  if (pos == std::string::npos || pos == 0) {
+    return false;
+  }
+
+  uint16_t port;
+  if (!common::ConvertFromString(str.substr(pos + 1), &port)) {
+    return false;
+  }
+
+  *host = common::net::HostAndPort(str.substr(0, pos), port);
+  return true;
+}
+
+bool IsSameHost(const common::net::HostAndPort& left, const common::net::HostAndPort& right) {
+  return left.GetPort() == right.GetPort() && left.GetHost() == right.GetHost();
+}
+
+}  // namespace
+
+uint16_t KeyHashSlot(const char* key, size_t len) {
+  size_t start = 0;
+  for (; start < len; ++start) {
+    if (key[start] == '{') {
+      break;
+    }
+  }
+
+  if (start == len) {
+    return Crc16(key, len) & (cluster_slots_count - 1);
+  }
+
+  size_t end = start + 1;
+  for (; end < len; ++end) {
+    if (key[end] == '}') {
+      break;
+    }
+  }
+
+  if (end == len || end == start + 1) {  // no closing brace or empty tag: whole key is hashed
+    return Crc16(key, len) & (cluster_slots_count - 1);
+  }
+
+  return Crc16(key + start + 1, end - start - 1) & (cluster_slots_count - 1);
+}
+
+bool GetCommandKey(const commands_args_t& argv, std::string* key) {
+  if (argv.size() < 2 || !key) {
+    return false;
+  }
+
+  const std::string& name = argv[0];
+  static const char* const keyless[] = {
+      "AUTH",     "BGREWRITEAOF", "BGSAVE",   "CLIENT",    "CLUSTER",   "COMMAND", "CONFIG",  "DBSIZE",
+      "DEBUG",    "DISCARD",      "ECHO",     "EXEC",      "FLUSHALL",  "FLUSHDB", "INFO",    "KEYS",
+      "LASTSAVE", "LATENCY",      "MODULE",   "MONITOR",   "MULTI",     "PING",    "PSUBSCRIBE", "PUBLISH",
+      "PUBSUB",   "PUNSUBSCRIBE", "QUIT",     "RANDOMKEY", "ROLE",      "SAVE",    "SCAN",    "SCRIPT",
+      "SELECT",   "SHUTDOWN",     "SLAVEOF",  "SLOWLOG",   "SUBSCRIBE", "TIME",    "UNSUBSCRIBE", "WAIT"};
+  for (size_t i = 0; i < SIZEOFMASS(keyless); ++i) {
+    if (IsCommand(name, keyless[i])) {
+      return false;
+    }
+  }
+
+  if (IsCommand(name, "OBJECT") || IsCommand(name, "MEMORY")) {  // OBJECT ENCODING key
+    if (argv.size() < 3) {
+      return false;
+    }
+    *key = argv[2];
+    return true;
+  }
+
+  if (IsCommand(name, "EVAL") || IsCommand(name, "EVALSHA")) {  // EVAL script numkeys key ...
+    size_t numkeys = 0;
+    if (argv.size() < 4 || !common::ConvertFromString(argv[2], &numkeys) || numkeys == 0) {
+      return false;
+    }
+    *key = argv[3];
+    return true;
+  }
+
+  *key = argv[1];
+  return true;
+}
+
+ClusterRedirection::ClusterRedirection() : ask(false), slot(0), host() {}
+
+bool ParseClusterRedirection(const std::string& error, ClusterRedirection* out) {
+  if (!out) {
+    return false;
+  }
+
+  size_t pos = 0;
+  bool ask = false;
+  if (error.compare(0, sizeof(MOVED_PREFIX) - 1, MOVED_PREFIX) == 0) {
+    pos = sizeof(MOVED_PREFIX) - 1;
+  } else if (error.compare(0, sizeof(ASK_PREFIX) - 1, ASK_PREFIX) == 0) {
+    pos = sizeof(ASK_PREFIX) - 1;
+    ask = true;
+  } else {
+    return false;
+  }
+
+  const size_t space = error.find(' ', pos);
+  if (space == std::string::npos) {
+    return false;
+  }
+
+  uint16_t slot;
+  if (!common::ConvertFromString(error.substr(pos, space - pos), &slot) || slot >= cluster_slots_count) {
+    return false;
+  }
+
+  common::net::HostAndPort host;
+  if (!ParseHostAndPort(error.substr(space + 1), &host)) {
+    return false;
+  }
+
+  out->ask = ask;
+  out->slot = slot;
+  out->host = host;
+  return true;
+}
+
+ClusterSlotsMap::Node::Node() : host(), id() {}
+
+ClusterSlotsMap::Node::Node(const common::net::HostAndPort& host, const std::string& id) : host(host), id(id) {}
+
+ClusterSlotsMap::ClusterSlotsMap() : masters_(), slots_() {}
+
+common::Error ClusterSlotsMap::Update(const redisReply* slots) {
+  if (!slots || slots->type != REDIS_REPLY_ARRAY) {
+    return common::make_error("Invalid CLUSTER SLOTS reply");
+  }
+
+  Clear();
+  slots_.assign(cluster_slots_count, 0);
+  for (size_t i = 0; i < slots->elements; ++i) {
+    // start, end, master [ip, port, id], replicas ...
+    const redisReply* range = slots->element[i];
+    if (range->type != REDIS_REPLY_ARRAY || range->elements < 3 || range->element[0]->type != REDIS_REPLY_INTEGER ||
+        range->element[1]->type != REDIS_REPLY_INTEGER || range->element[2]->type != REDIS_REPLY_ARRAY) {
+      Clear();
+      return common::make_error("Invalid CLUSTER SLOTS reply");
+    }
+
+    const long long start = range->element[0]->integer;
+    const long long end = range->element[1]->integer;
+    const redisReply* master = range->element[2];
+    if (start < 0 || end >= cluster_slots_count || start > end || master->elements < 2 ||
+        master->element[0]->type != REDIS_REPLY_STRING || master->element[1]->type != REDIS_REPLY_INTEGER) {
+      Clear();
+      return common::make_error("Invalid CLUSTER SLOTS reply");
+    }
+
+    std::string id;
+    if (master->elements > 2 && master->element[2]->type == REDIS_REPLY_STRING) {
+      id.assign(master->element[2]->str, master->element[2]->len);
+    }
+    const common::net::HostAndPort host(std::string(master->element[0]->str, master->element[0]->len),
+                                        static_cast<uint16_t>(master->element[1]->integer));
+    const uint16_t index = static_cast<uint16_t>(FindOrAddMaster(Node(host, id)) + 1);
+    for (long long slot = start; slot <= end; ++slot) {
+      slots_[slot] = index;
+    }
+  }
+
+  return common::Error();
+}
+
+void ClusterSlotsMap::SetMaster(uint16_t slot, const common::net::HostAndPort& host) {
+  if (slot >= cluster_slots_count) {
+    DNOTREACHED();
+    return;
+  }
+
+  if (slots_.empty()) {
+    slots_.assign(cluster_slots_count, 0);
+  }
+  slots_[slot] = static_cast<uint16_t>(FindOrAddMaster(Node(host, std::string())) + 1);
+}
+
+void ClusterSlotsMap::Clear() {
+  masters_.clear();
+  slots_.clear();
+}
+
+bool ClusterSlotsMap::IsEmpty() const {
+  return masters_.empty();
+}
+
+bool ClusterSlotsMap::FindMaster(uint16_t slot, Node* node) const {
+  if (slot >= slots_.size() || !node) {
+    return false;
+  }
+
+  const uint16_t index = slots_[slot];
+  if (index == 0) {
+    return false;
+  }
+
+  *node = masters_[index - 1];
+  return true;
+}
+
+std::vector<ClusterSlotsMap::Node> ClusterSlotsMap::GetMasters() const {
+  return masters_;
+}
+
+size_t ClusterSlotsMap::FindOrAddMaster(const Node& node) {
+  for (size_t i = 0; i < masters_.size(); ++i) {
+    if (IsSameHost(masters_[i].host, node.host)) {
+      if (masters_[i].id.empty()) {
+        masters_[i].id = node.id;
+      }
+      return i;
+    }
+  }
+
+  masters_.push_back(node);
+  return masters_.size() - 1;
+}
+
+}  // namespace redis
+}  // namespace core
+}  // namespace fastonosql
@@ -0,0 +1,84 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <string>  // for string
+#include <vector>  // for vector
+
+#include <common/error.h>      // for Error
+#include <common/net/types.h>  // for HostAndPort
+
+#include "core/types.h"  // for commands_args_t
+
+struct redisReply;
+
+namespace fastonosql {
+namespace core {
+namespace redis {
+
+enum { cluster_slots_count = 16384 };
+
+// CRC16 of key or of its {hash tag} modulo slots count, as CLUSTER KEYSLOT
+uint16_t KeyHashSlot(const char* key, size_t len);
+
+// key which decides slot of command, false for commands without keys (INFO, CLUSTER, CONFIG ...)
+bool GetCommandKey(const commands_args_t& argv, std::string* key);
+
+// -MOVED slot host:port or -ASK slot host:port error
+struct ClusterRedirection {
+  ClusterRedirection();
+
+  bool ask;
+  uint16_t slot;
+  common::net::HostAndPort host;
+};
+
+bool ParseClusterRedirection(const std::string& error, ClusterRedirection* out);
+
+// cached CLUSTER SLOTS: slot -> master
+class ClusterSlotsMap {
+ public:
+  struct Node {
+    Node();
+    Node(const common::net::HostAndPort& host, const std::string& id);
+
+    common::net::HostAndPort host;
+    std::string id;  // empty for servers older than 4.0
+  };
+
+  ClusterSlotsMap();
+
+  common::Error Update(const redisReply* slots) WARN_UNUSED_RESULT;  // CLUSTER SLOTS reply
+  void SetMaster(uint16_t slot, const common::net::HostAndPort& host);  // MOVED between updates
+  void Clear();
+
+  bool IsEmpty() const;
+  bool FindMaster(uint16_t slot, Node* node) const;
+  std::vector<Node> GetMasters() const;
+
+ private:
+  size_t FindOrAddMaster(const Node& node);
+
+  std::vector<Node> masters_;
+  std::vector<uint16_t> slots_;  // index in masters_ + 1, 0 if slot is not served
+};
+
+}  // namespace redis
+}  // namespace core
+}  // namespace fastonosql
@@ -18,7 +18,10 @@
 
 #include "core/db/redis/command_translator.h"
 
+#include <common/convert2string.h>
+
 #include "core/connection_types.h"
+#include "core/value.h"  // for ConvertValueToArgs
 
 #define REDIS_SET_KEY_COMMAND DB_SET_KEY_COMMAND
 #define REDIS_SET_KEY_ARRAY_COMMAND "LPUSH"
@@ -49,6 +52,14 @@
 
 #define REDIS_LRANGE "LRANGE"
 
+#define REDIS_SSCAN "SSCAN"
+#define REDIS_HSCAN "HSCAN"
+
+#define REDIS_LLEN "LLEN"
+#define REDIS_SCARD "SCARD"
+#define REDIS_ZCARD "ZCARD"
+#define REDIS_HLEN "HLEN"
+
 #define REDIS_SETEX "SETEX"
 #define REDIS_SETNX "SETNX"
 
@@ -59,8 +70,9 @@
 #define REDIS_INCRBY "INCRBY"
 #define REDIS_INCRBYFLOAT "INCRBYFLOAT"
 
-#define REDIS_MODULE_LOAD "MODULE LOAD"
-#define REDIS_MODULE_UNLOAD "MODULE UNLOAD"
+#define REDIS_MODULE "MODULE"
+#define REDIS_MODULE_LOAD "LOAD"
+#define REDIS_MODULE_UNLOAD "UNLOAD"
 
 namespace fastonosql {
 namespace core {
@@ -72,249 +84,248 @@ const char* CommandTranslator::GetDBName() const {
   return ConnectionTraits<REDIS>::GetDBName();
 }
 
-common::Error CommandTranslator::Zrange(const NKey& key,
-                                        int start,
-                                        int stop,
-                                        bool withscores,
-                                        command_buffer_t* cmdstring) {
+common::Error CommandTranslator::Zrange(const NKey& key, int start, int stop, bool withscores, commands_args_t* argv) {
   key_t key_str = key.GetKey();
-  command_buffer_writer_t wr;
-  wr << REDIS_ZRANGE " " << key_str.GetKeyForCommandLine() << " " << start << " " << stop;
+  *argv = {REDIS_ZRANGE, key_str.GetKeyData(), common::ConvertToString(start), common::ConvertToString(stop)};
   if (withscores) {
-    wr << " WITHSCORES";
+    argv->push_back("WITHSCORES");
   }
 
-  *cmdstring = wr.str();
   return common::Error();
 }
 
-common::Error CommandTranslator::Hgetall(const NKey& key, command_buffer_t* cmdstring) {
-  if (!cmdstring) {
+common::Error CommandTranslator::Hgetall(const NKey& key, commands_args_t* argv) {
+  if (!argv) {
     return common::make_error_inval();
   }
 
   key_t key_str = key.GetKey();
-  command_buffer_writer_t wr;
-  wr << REDIS_HGETALL " " << key_str.GetKeyForCommandLine();
-  *cmdstring = wr.str();
+  *argv = {REDIS_HGETALL, key_str.GetKeyData()};
   return common::Error();
 }
 
-common::Error CommandTranslator::Smembers(const NKey& key, command_buffer_t* cmdstring) {
-  if (!cmdstring) {
+common::Error CommandTranslator::Smembers(const NKey& key, commands_args_t* argv) {
+  if (!argv) {
     return common::make_error_inval();
   }
 
   key_t key_str = key.GetKey();
-  command_buffer_writer_t wr;
-  wr << REDIS_SMEMBERS " " << key_str.GetKeyForCommandLine();
-  *cmdstring = wr.str();
+  *argv = {REDIS_SMEMBERS, key_str.GetKeyData()};
   return common::Error();
 }
 
-common::Error CommandTranslator::Lrange(const NKey& key, int start, int stop, command_buffer_t* cmdstring) {
-  if (!cmdstring) {
+common::Error CommandTranslator::Lrange(const NKey& key, int start, int stop, commands_args_t* argv) {
+  if (!argv) {
     return common::make_error_inval();
   }
 
   key_t key_str = key.GetKey();
-  command_buffer_writer_t wr;
-  wr << REDIS_LRANGE " " << key_str.GetKeyForCommandLine() << " " << start << " " << stop;
-  *cmdstring = wr.str();
+  *argv = {REDIS_LRANGE, key_str.GetKeyData(), common::ConvertToString(start), common::ConvertToString(stop)};
+  return common::Error();
+}
+
+common::Error CommandTranslator::Sscan(const NKey& key, uint64_t cursor, size_t count, commands_args_t* argv) {
+  if (!argv) {
+    return common::make_error_inval();
+  }
+
+  key_t key_str = key.GetKey();
+  *argv = {REDIS_SSCAN, key_str.GetKeyData(), common::ConvertToString(cursor), "COUNT",
+           common::ConvertToString(count)};
   return common::Error();
 }
 
-common::Error CommandTranslator::SetEx(const NDbKValue& key, ttl_t ttl, command_buffer_t* cmdstring) {
-  if (!cmdstring) {
+common::Error CommandTranslator::Hscan(const NKey& key, uint64_t cursor, size_t count, commands_args_t* argv) {
+  if (!argv) {
+    return common::make_error_inval();
+  }
+
+  key_t key_str = key.GetKey();
+  *argv = {REDIS_HSCAN, key_str.GetKeyData(), common::ConvertToString(cursor), "COUNT",
+           common::ConvertToString(count)};
+  return common::Error();
+}
+
+common::Error CommandTranslator::KeySize(const NKey& key, common::Value::Type type, commands_args_t* argv) {
+  if (!argv) {
+    return common::make_error_inval();
+  }
+
+  key_t key_str = key.GetKey();
+  if (type == common::Value::TYPE_ARRAY) {
+    *argv = {REDIS_LLEN, key_str.GetKeyData()};
+  } else if (type == common::Value::TYPE_SET) {
+    *argv = {REDIS_SCARD, key_str.GetKeyData()};
+  } else if (type == common::Value::TYPE_ZSET) {
+    *argv = {REDIS_ZCARD, key_str.GetKeyData()};
+  } else if (type == common::Value::TYPE_HASH) {
+    *argv = {REDIS_HLEN, key_str.GetKeyData()};
+  } else {
+    return common::make_error("Size supported only for collection keys");
+  }
+
+  return common::Error();
+}
+
+common::Error CommandTranslator::SetEx(const NDbKValue& key, ttl_t ttl, commands_args_t* argv) {
+  if (!argv) {
     return common::make_error_inval();
   }
 
   const NKey cur = key.GetKey();
   key_t key_str = cur.GetKey();
-  std::string value_str = key.GetValueForCommandLine();
-  command_buffer_writer_t wr;
-  wr << REDIS_SETEX " " << key_str.GetKeyForCommandLine() << " " << ttl << " " << value_str;
-  *cmdstring = wr.str();
+  *argv = {REDIS_SETEX, key_str.GetKeyData(), common::ConvertToString(ttl)};
+  ConvertValueToArgs(key.GetValue().get(), argv);
   return common::Error();
 }
 
-common::Error CommandTranslator::SetNX(const NDbKValue& key, command_buffer_t* cmdstring) {
-  if (!cmdstring) {
+common::Error CommandTranslator::SetNX(const NDbKValue& key, commands_args_t* argv) {
+  if (!argv) {
     return common::make_error_inval();
   }
 
   const NKey cur = key.GetKey();
   key_t key_str = cur.GetKey();
-  std::string value_str = key.GetValueForCommandLine();
-  command_buffer_writer_t wr;
-  wr << REDIS_SETNX " " << key_str.GetKeyForCommandLine() << " " << value_str;
-  *cmdstring = wr.str();
+  *argv = {REDIS_SETNX, key_str.GetKeyData()};
+  ConvertValueToArgs(key.GetValue().get(), argv);
   return common::Error();
 }
 
-common::Error CommandTranslator::Decr(const NKey& key, command_buffer_t* cmdstring) {
-  if (!cmdstring) {
+common::Error CommandTranslator::Decr(const NKey& key, commands_args_t* argv) {
+  if (!argv) {
     return common::make_error_inval();
   }
 
   key_t key_str = key.GetKey();
-  command_buffer_writer_t wr;
-  wr << REDIS_DECR " " << key_str.GetKeyForCommandLine();
-  *cmdstring = wr.str();
+  *argv = {REDIS_DECR, key_str.GetKeyData()};
   return common::Error();
 }
 
-common::Error CommandTranslator::DecrBy(const NKey& key, int inc, command_buffer_t* cmdstring) {
-  if (!cmdstring) {
+common::Error CommandTranslator::DecrBy(const NKey& key, int inc, commands_args_t* argv) {
+  if (!argv) {
     return common::make_error_inval();
   }
 
   key_t key_str = key.GetKey();
-  command_buffer_writer_t wr;
-  wr << REDIS_DECRBY " " << key_str.GetKeyForCommandLine() << " " << inc;
-  *cmdstring = wr.str();
+  *argv = {REDIS_DECRBY, key_str.GetKeyData(), common::ConvertToString(inc)};
   return common::Error();
 }
 
-common::Error CommandTranslator::Incr(const NKey& key, command_buffer_t* cmdstring) {
-  if (!cmdstring) {
+common::Error CommandTranslator::Incr(const NKey& key, commands_args_t* argv) {
+  if (!argv) {
     return common::make_error_inval();
   }
 
   key_t key_str = key.GetKey();
-  command_buffer_writer_t wr;
-  wr << REDIS_INCR " " << key_str.GetKeyForCommandLine();
-  *cmdstring = wr.str();
+  *argv = {REDIS_INCR, key_str.GetKeyData()};
   return common::Error();
 }
 
-common::Error CommandTranslator::IncrBy(const NKey& key, int inc, command_buffer_t* cmdstring) {
-  if (!cmdstring) {
+common::Error CommandTranslator::IncrBy(const NKey& key, int inc, commands_args_t* argv) {
+  if (!argv) {
     return common::make_error_inval();
   }
 
   key_t key_str = key.GetKey();
-  command_buffer_writer_t wr;
-  wr << REDIS_INCRBY " " << key_str.GetKeyForCommandLine() << " " << inc;
-  *cmdstring = wr.str();
+  *argv = {REDIS_INCRBY, key_str.GetKeyData(), common::ConvertToString(inc)};
   return common::Error();
 }
 
-common::Error CommandTranslator::IncrByFloat(const NKey& key, double inc, command_buffer_t* cmdstring) {
-  if (!cmdstring) {
+common::Error CommandTranslator::IncrByFloat(const NKey& key, double inc, commands_args_t* argv) {
+  if (!argv) {
     return common::make_error_inval();
   }
 
   key_t key_str = key.GetKey();
-  command_buffer_writer_t wr;
-  wr << REDIS_INCRBYFLOAT " " << key_str.GetKeyForCommandLine() << " " << inc;
-  *cmdstring = wr.str();
+  *argv = {REDIS_INCRBYFLOAT, key_str.GetKeyData(), common::ConvertToString(inc)};
   return common::Error();
 }
 
-common::Error CommandTranslator::ModuleLoadCommand(const ModuleInfo& module, command_buffer_t* cmdstring) {
-  if (!cmdstring) {
+common::Error CommandTranslator::ModuleLoadCommand(const ModuleInfo& module, commands_args_t* argv) {
+  if (!argv) {
     return common::make_error_inval();
   }
 
-  command_buffer_writer_t wr;
-  wr << REDIS_MODULE_LOAD " " << module.name;
-  *cmdstring = wr.str();
+  *argv = {REDIS_MODULE, REDIS_MODULE_LOAD, module.name};
   return common::Error();
 }
 
-common::Error CommandTranslator::ModuleUnloadCommand(const ModuleInfo& module, command_buffer_t* cmdstring) {
-  if (!cmdstring) {
+common::Error CommandTranslator::ModuleUnloadCommand(const ModuleInfo& module, commands_args_t* argv) {
+  if (!argv) {
     return common::make_error_inval();
   }
 
-  command_buffer_writer_t wr;
-  wr << REDIS_MODULE_UNLOAD " " << module.name;
-  *cmdstring = wr.str();
+  *argv = {REDIS_MODULE, REDIS_MODULE_UNLOAD, module.name};
   return common::Error();
 }
 
-common::Error CommandTranslator::CreateKeyCommandImpl(const NDbKValue& key, command_buffer_t* cmdstring) const {
+common::Error CommandTranslator::CreateKeyCommandImpl(const NDbKValue& key, commands_args_t* argv) const {
   const NKey cur = key.GetKey();
   key_t key_str = cur.GetKey();
-  std::string value_str = key.GetValueForCommandLine();
-  command_buffer_writer_t wr;
   common::Value::Type type = key.GetType();
+  const char* command = REDIS_SET_KEY_COMMAND;
   if (type == common::Value::TYPE_ARRAY) {
-    wr << REDIS_SET_KEY_ARRAY_COMMAND " " << key_str.GetKeyForCommandLine() << " " << value_str;
+    command = REDIS_SET_KEY_ARRAY_COMMAND;
   } else if (type == common::Value::TYPE_SET) {
-    wr << REDIS_SET_KEY_SET_COMMAND " " << key_str.GetKeyForCommandLine() << " " << value_str;
+    command = REDIS_SET_KEY_SET_COMMAND;
   } else if (type == common::Value::TYPE_ZSET) {
-    wr << REDIS_SET_KEY_ZSET_COMMAND " " << key_str.GetKeyForCommandLine() << " " << value_str;
+    command = REDIS_SET_KEY_ZSET_COMMAND;
   } else if (type == common::Value::TYPE_HASH) {
-    wr << REDIS_SET_KEY_HASH_COMMAND " " << key_str.GetKeyForCommandLine() << " " << value_str;
-  } else {
-    wr << REDIS_SET_KEY_COMMAND " " << key_str.GetKeyForCommandLine() << " " << value_str;
+    command = REDIS_SET_KEY_HASH_COMMAND;
   }
 
-  *cmdstring = wr.str();
+  *argv = {command, key_str.GetKeyData()};
+  ConvertValueToArgs(key.GetValue().get(), argv);  // elements as separate arguments
   return common::Error();
 }
 
 common::Error CommandTranslator::LoadKeyCommandImpl(const NKey& key,
                                                     common::Value::Type type,
-                                                    command_buffer_t* cmdstring) const {
+                                                    commands_args_t* argv) const {
   key_t key_str = key.GetKey();
-  command_buffer_writer_t wr;
   if (type == common::Value::TYPE_ARRAY) {
-    wr << REDIS_GET_KEY_ARRAY_COMMAND " " << key_str.GetKeyForCommandLine() << " 0 -1";
+    *argv = {REDIS_GET_KEY_ARRAY_COMMAND, key_str.GetKeyData(), "0", "-1"};
   } else if (type == common::Value::TYPE_SET) {
-    wr << REDIS_GET_KEY_SET_COMMAND " " << key_str.GetKeyForCommandLine();
+    *argv = {REDIS_GET_KEY_SET_COMMAND, key_str.GetKeyData()};
   } else if (type == common::Value::TYPE_ZSET) {
-    wr << REDIS_GET_KEY_ZSET_COMMAND " " << key_str.GetKeyForCommandLine() << " 0 -1 WITHSCORES";
+    *argv = {REDIS_GET_KEY_ZSET_COMMAND, key_str.GetKeyData(), "0", "-1", "WITHSCORES"};
   } else if (type == common::Value::TYPE_HASH) {
-    wr << REDIS_GET_KEY_HASH_COMMAND " " << key_str.GetKeyForCommandLine();
+    *argv = {REDIS_GET_KEY_HASH_COMMAND, key_str.GetKeyData()};
   } else {
-    wr << REDIS_GET_KEY_COMMAND " " << key_str.GetKeyForCommandLine();
+    *argv = {REDIS_GET_KEY_COMMAND, key_str.GetKeyData()};
   }
 
-  *cmdstring = wr.str();
   return common::Error();
 }
 
-common::Error CommandTranslator::DeleteKeyCommandImpl(const NKey& key, command_buffer_t* cmdstring) const {
+common::Error CommandTranslator::DeleteKeyCommandImpl(const NKey& key, commands_args_t* argv) const {
   key_t key_str = key.GetKey();
-  command_buffer_writer_t wr;
-  wr << REDIS_DELETE_KEY_COMMAND " " << key_str.GetKeyForCommandLine();
-  *cmdstring = wr.str();
+  *argv = {REDIS_DELETE_KEY_COMMAND, key_str.GetKeyData()};
   return common::Error();
 }
 
 common::Error CommandTranslator::RenameKeyCommandImpl(const NKey& key,
                                                       const key_t& new_name,
-                                                      command_buffer_t* cmdstring) const {
+                                                      commands_args_t* argv) const {
   key_t key_str = key.GetKey();
-  command_buffer_writer_t wr;
-  wr << REDIS_RENAME_KEY_COMMAND " " << key_str.GetKeyForCommandLine() << " " << new_name.GetKeyForCommandLine();
-  *cmdstring = wr.str();
+  *argv = {REDIS_RENAME_KEY_COMMAND, key_str.GetKeyData(), new_name.GetKeyData()};
   return common::Error();
 }
 
-common::Error CommandTranslator::ChangeKeyTTLCommandImpl(const NKey& key,
-                                                         ttl_t ttl,
-                                                         command_buffer_t* cmdstring) const {
+common::Error CommandTranslator::ChangeKeyTTLCommandImpl(const NKey& key, ttl_t ttl, commands_args_t* argv) const {
   key_t key_str = key.GetKey();
-  command_buffer_writer_t wr;
   if (ttl == NO_TTL) {
-    wr << REDIS_PERSIST_KEY_COMMAND " " << key_str.GetKeyForCommandLine();
+    *argv = {REDIS_PERSIST_KEY_COMMAND, key_str.GetKeyData()};
   } else {
-    wr << REDIS_CHANGE_TTL_COMMAND " " << key_str.GetKeyForCommandLine() << " " << ttl;
+    *argv = {REDIS_CHANGE_TTL_COMMAND, key_str.GetKeyData(), common::ConvertToString(ttl)};
   }
 
-  *cmdstring = wr.str();
   return common::Error();
 }
 
-common::Error CommandTranslator::LoadKeyTTLCommandImpl(const NKey& key, command_buffer_t* cmdstring) const {
+common::Error CommandTranslator::LoadKeyTTLCommandImpl(const NKey& key, commands_args_t* argv) const {
   key_t key_str = key.GetKey();
-  command_buffer_writer_t wr;
-  wr << REDIS_GET_TTL_COMMAND " " << key_str.GetKeyForCommandLine();
-  *cmdstring = wr.str();
+  *argv = {REDIS_GET_TTL_COMMAND, key_str.GetKeyData()};
   return common::Error();
 }
 
@@ -31,39 +31,44 @@ class CommandTranslator : public ICommandTranslator {
   explicit CommandTranslator(const std::vector<CommandHolder>& commands);
   virtual const char* GetDBName() const override;
 
-  common::Error Zrange(const NKey& key, int start, int stop, bool withscores, command_buffer_t* cmdstring)
-      WARN_UNUSED_RESULT;
+  common::Error Zrange(const NKey& key, int start, int stop, bool withscores, commands_args_t* argv) WARN_UNUSED_RESULT;
 
-  common::Error Hgetall(const NKey& key, command_buffer_t* cmdstring) WARN_UNUSED_RESULT;
+  common::Error Hgetall(const NKey& key, commands_args_t* argv) WARN_UNUSED_RESULT;
 
-  common::Error Smembers(const NKey& key, command_buffer_t* cmdstring) WARN_UNUSED_RESULT;
+  common::Error Smembers(const NKey& key, commands_args_t* argv) WARN_UNUSED_RESULT;
 
-  common::Error Lrange(const NKey& key, int start, int stop, command_buffer_t* cmdstring) WARN_UNUSED_RESULT;
+  common::Error Lrange(const NKey& key, int start, int stop, commands_args_t* argv) WARN_UNUSED_RESULT;
 
-  common::Error SetEx(const NDbKValue& key, ttl_t ttl, command_buffer_t* cmdstring) WARN_UNUSED_RESULT;
-  common::Error SetNX(const NDbKValue& key, command_buffer_t* cmdstring) WARN_UNUSED_RESULT;
+  common::Error Sscan(const NKey& key, uint64_t cursor, size_t count, commands_args_t* argv) WARN_UNUSED_RESULT;
+  common::Error Hscan(const NKey& key, uint64_t cursor, size_t count, commands_args_t* argv) WARN_UNUSED_RESULT;
 
-  common::Error Decr(const NKey& key, command_buffer_t* cmdstring) WARN_UNUSED_RESULT;
-  common::Error DecrBy(const NKey& key, int inc, command_buffer_t* cmdstring) WARN_UNUSED_RESULT;
+  // LLEN, SCARD, ZCARD or HLEN by type of key
+  common::Error KeySize(const NKey& key, common::Value::Type type, commands_args_t* argv) WARN_UNUSED_RESULT;
 
-  common::Error Incr(const NKey& key, command_buffer_t* cmdstring) WARN_UNUSED_RESULT;
-  common::Error IncrBy(const NKey& key, int inc, command_buffer_t* cmdstring) WARN_UNUSED_RESULT;
-  common::Error IncrByFloat(const NKey& key, double inc, command_buffer_t* cmdstring) WARN_UNUSED_RESULT;
+  common::Error SetEx(const NDbKValue& key, ttl_t ttl, commands_args_t* argv) WARN_UNUSED_RESULT;
+  common::Error SetNX(const NDbKValue& key, commands_args_t* argv) WARN_UNUSED_RESULT;
 
-  common::Error ModuleLoadCommand(const ModuleInfo& module, command_buffer_t* cmdstring) WARN_UNUSED_RESULT;
-  common::Error ModuleUnloadCommand(const ModuleInfo& module, command_buffer_t* cmdstring) WARN_UNUSED_RESULT;
+  common::Error Decr(const NKey& key, commands_args_t* argv) WARN_UNUSED_RESULT;
+  common::Error DecrBy(const NKey& key, int inc, commands_args_t* argv) WARN_UNUSED_RESULT;
+
+  common::Error Incr(const NKey& key, commands_args_t* argv) WARN_UNUSED_RESULT;
+  common::Error IncrBy(const NKey& key, int inc, commands_args_t* argv) WARN_UNUSED_RESULT;
+  common::Error IncrByFloat(const NKey& key, double inc, commands_args_t* argv) WARN_UNUSED_RESULT;
+
+  common::Error ModuleLoadCommand(const ModuleInfo& module, commands_args_t* argv) WARN_UNUSED_RESULT;
+  common::Error ModuleUnloadCommand(const ModuleInfo& module, commands_args_t* argv) WARN_UNUSED_RESULT;
 
  private:
-  virtual common::Error CreateKeyCommandImpl(const NDbKValue& key, command_buffer_t* cmdstring) const override;
+  virtual common::Error CreateKeyCommandImpl(const NDbKValue& key, commands_args_t* argv) const override;
   virtual common::Error LoadKeyCommandImpl(const NKey& key,
                                            common::Value::Type type,
-                                           command_buffer_t* cmdstring) const override;
-  virtual common::Error DeleteKeyCommandImpl(const NKey& key, command_buffer_t* cmdstring) const override;
+                                           commands_args_t* argv) const override;
+  virtual common::Error DeleteKeyCommandImpl(const NKey& key, commands_args_t* argv) const override;
   virtual common::Error RenameKeyCommandImpl(const NKey& key,
                                              const key_t& new_name,
-                                             command_buffer_t* cmdstring) const override;
-  virtual common::Error ChangeKeyTTLCommandImpl(const NKey& key, ttl_t ttl, command_buffer_t* cmdstring) const override;
-  virtual common::Error LoadKeyTTLCommandImpl(const NKey& key, command_buffer_t* cmdstring) const override;
+                                             commands_args_t* argv) const override;
+  virtual common::Error ChangeKeyTTLCommandImpl(const NKey& key, ttl_t ttl, commands_args_t* argv) const override;
+  virtual common::Error LoadKeyTTLCommandImpl(const NKey& key, commands_args_t* argv) const override;
 
   virtual bool IsLoadKeyCommandImpl(const CommandInfo& cmd) const override;
 
@@ -19,6 +19,12 @@
 #include "core/db/redis/db_connection.h"
 
 #include <errno.h>
+#include <inttypes.h>
+#include <string.h>
+
+#include <algorithm>
+#include <deque>
+#include <set>
 
 extern "C" {
 #include "sds.h"
@@ -31,13 +37,17 @@ extern "C" {
 #include "core/db/redis/command_translator.h"
 #include "core/db/redis/database_info.h"  // for DataBaseInfo
 #include "core/db/redis/internal/commands_api.h"
+#include "core/db/redis/rdb_parser.h"
+#include "core/db/redis/reply_object.h"  // for ReplyObject
 #include "core/db/redis/sentinel_info.h"  // for DiscoverySentinelInfo, etc
+#include "core/logger.h"
 
 #define HIREDIS_VERSION    \
   STRINGIZE(HIREDIS_MAJOR) \
   "." STRINGIZE(HIREDIS_MINOR) "." STRINGIZE(HIREDIS_PATCH)
 
 #define DBSIZE "DBSIZE"
+#define REDIS_UNLINK_COMMAND "UNLINK"  // non blocking DEL since 4.0
 
 #define GET_PASSWORD "CONFIG get requirepass"
 
@@ -55,6 +65,9 @@ extern "C" {
 #define ANET_ERR -1
 #define ANET_ERR_LEN 256
 
+#define LISTEN_MAX_MESSAGES 1000
+#define LISTEN_RATE_SAMPLE_MSEC 10000 /* milliseconds. */
+
 namespace {
 
 const struct RedisInit {
@@ -299,6 +312,40 @@ common::Error AuthContext(redisContext* context, const std::string& auth_str) {
   return common::Error();
 }
 
+// SCAN reply: [cursor, [keys]], reply is freed
+common::Error ParseScanReply(redisReply* reply, std::vector<std::string>* keys_out, uint64_t* cursor_out) {
+  if (reply->type != REDIS_REPLY_ARRAY || reply->elements != 2 || reply->element[0]->type != REDIS_REPLY_STRING ||
+      reply->element[1]->type != REDIS_REPLY_ARRAY) {
+    freeReplyObject(reply);
+    return common::make_error("I/O error");
+  }
+
+  uint64_t lcursor_out;
+  if (!common::ConvertFromString(std::string(reply->element[0]->str, reply->element[0]->len), &lcursor_out)) {
+    freeReplyObject(reply);
+    return common::make_error_inval();
+  }
+
+  const redisReply* keys = reply->element[1];
+  for (size_t i = 0; i < keys->elements; ++i) {
+    const redisReply* key = keys->element[i];
+    if (key->type == REDIS_REPLY_STRING) {
+      keys_out->push_back(std::string(key->str, key->len));
+    }
+  }
+
+  *cursor_out = lcursor_out;
+  freeReplyObject(reply);
+  return common::Error();
+}
+
+void FreeReplies(std::vector<redisReply*>* replies) {
+  for (size_t i = 0; i < replies->size(); ++i) {
+    freeReplyObject((*replies)[i]);
+  }
+  replies->clear();
+}
+
 }  // namespace
 
 RConfig::RConfig(const Config& config, const SSHInfo& sinfo) : Config(config), ssh_info(sinfo) {}
@@ -487,7 +534,14 @@ common::Error DiscoverySentinelConnection(const RConfig& rconfig, std::vector<Se
 }
 
 DBConnection::DBConnection(CDBConnectionClient* client)
-    : base_class(client, new CommandTranslator(base_class::GetCommands())), is_auth_(false), cur_db_(-1) {}
+    : base_class(client, new CommandTranslator(base_class::GetCommands())),
+      is_auth_(false),
+      cur_db_(-1),
+      cluster_slots_(),
+      cluster_self_id_(),
+      cluster_nodes_(),
+      cluster_scans_(),
+      last_cluster_scan_(0) {}
 
 bool DBConnection::IsAuthenticated() const {
   if (!base_class::IsAuthenticated()) {
@@ -509,6 +563,11 @@ common::Error DBConnection::Connect(const config_t& config) {
     return err;
   }
 
+  err = RefreshClusterSlots();
+  if (err) {
+    return err;
+  }
+
   int db_num = config->db_num;
   err = Select(common::ConvertToString(db_num), NULL);
   if (err) {
@@ -519,6 +578,10 @@ common::Error DBConnection::Connect(const config_t& config) {
 }
 
 common::Error DBConnection::Disconnect() {
+  CloseClusterNodes();
+  cluster_slots_.Clear();
+  cluster_self_id_.clear();
+  cluster_scans_.clear();
   cur_db_ = -1;
   is_auth_ = false;
   return base_class::Disconnect();
@@ -533,6 +596,312 @@ std::string DBConnection::GetCurrentDBName() const {
   return base_class::GetCurrentDBName();
 }
 
+bool DBConnection::IsClusterMode() const {
+  return !cluster_slots_.IsEmpty();
+}
+
+common::Error DBConnection::RefreshClusterSlots() {
+  redisReply* reply = NULL;
+  common::Error err = ExecRedisCommand(connection_.handle_, commands_args_t{"CLUSTER", "SLOTS"}, &reply);
+  if (err) {  // cluster support is disabled
+    cluster_slots_.Clear();
+    return common::Error();
+  }
+
+  err = cluster_slots_.Update(reply);
+  freeReplyObject(reply);
+  if (err) {
+    return err;
+  }
+
+  reply = NULL;
+  err = ExecRedisCommand(connection_.handle_, commands_args_t{"CLUSTER", "MYID"}, &reply);
+  if (!err) {  // MYID since 4.0, older servers are matched by host
+    if (reply->type == REDIS_REPLY_STRING) {
+      cluster_self_id_.assign(reply->str, reply->len);
+    }
+    freeReplyObject(reply);
+  }
+  return common::Error();
+}
+
+common::Error DBConnection::GetClusterNodeContext(const ClusterSlotsMap::Node& node, NativeConnection** context) {
+  const config_t config = GetConfig();
+  const bool is_self = (!node.id.empty() && node.id == cluster_self_id_) ||
+                       (node.host.GetPort() == config->host.GetPort() && node.host.GetHost() == config->host.GetHost());
+  if (is_self) {
+    *context = connection_.handle_;
+    return common::Error();
+  }
+
+  const std::string key = common::ConvertToString(node.host);
+  auto it = cluster_nodes_.find(key);
+  if (it != cluster_nodes_.end()) {
+    *context = it->second;
+    return common::Error();
+  }
+
+  RConfig rconfig = *config;
+  rconfig.host = node.host;
+  rconfig.hostsocket.clear();
+  NativeConnection* lcontext = NULL;
+  common::Error err = CreateConnection(rconfig, &lcontext);
+  if (err) {
+    return err;
+  }
+
+  err = AuthContext(lcontext, rconfig.auth);
+  if (err) {
+    redisFree(lcontext);
+    return err;
+  }
+
+  cluster_nodes_[key] = lcontext;
+  *context = lcontext;
+  return common::Error();
+}
+
+void DBConnection::CloseClusterNode(NativeConnection* context) {
+  for (auto it = cluster_nodes_.begin(); it != cluster_nodes_.end(); ++it) {
+    if (it->second == context) {
+      redisFree(it->second);
+      cluster_nodes_.erase(it);
+      return;
+    }
+  }
+  // main connection stays, its error is reported by next command
+}
+
+void DBConnection::CloseClusterNodes() {
+  for (auto it = cluster_nodes_.begin(); it != cluster_nodes_.end(); ++it) {
+    redisFree(it->second);
+  }
+  cluster_nodes_.clear();
+}
+
+common::Error DBConnection::ExecRoutedCommand(const commands_args_t& argv, redisReply** out_reply) {
+  std::string key;
+  if (!IsClusterMode() || !GetCommandKey(argv, &key)) {
+    return ExecRedisCommand(connection_.handle_, argv, out_reply);
+  }
+
+  ClusterSlotsMap::Node node;
+  if (!cluster_slots_.FindMaster(KeyHashSlot(key.data(), key.size()), &node)) {
+    return ExecRedisCommand(connection_.handle_, argv, out_reply);  // uncovered slot, server answers with error
+  }
+
+  bool asking = false;
+  for (int i = 0; i <= CLUSTER_MAX_REDIRECTIONS; ++i) {
+    NativeConnection* context = NULL;
+    common::Error err = GetClusterNodeContext(node, &context);
+    if (err) {
+      return err;
+    }
+
+    if (asking) {
+      redisReply* asking_reply = NULL;
+      err = ExecRedisCommand(context, commands_args_t{"ASKING"}, &asking_reply);
+      if (err) {
+        return err;
+      }
+      freeReplyObject(asking_reply);
+    }
+
+    err = ExecRedisCommand(context, argv, out_reply);
+    ClusterRedirection redirection;
+    if (!err || !ParseClusterRedirection(err->GetDescription(), &redirection)) {
+      return err;
+    }
+
+    asking = redirection.ask;
+    node = ClusterSlotsMap::Node(redirection.host, std::string());
+    if (!asking) {  // slot migrated, reload map once per redirection
+      common::Error refresh_err = RefreshClusterSlots();
+      if (refresh_err || !IsClusterMode()) {
+        cluster_slots_.SetMaster(redirection.slot, redirection.host);
+      }
+    }
+  }
+
+  return common::make_error("Too many cluster redirections");
+}
+
+common::Error DBConnection::ExecFanOut(const std::vector<NativeConnection*>& contexts,
+                                       const std::vector<commands_args_t>& argvs,
+                                       std::vector<redisReply*>* replies) {
+  if (contexts.size() != argvs.size() || !replies) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  // queue commands on every node, flush them and only then wait replies,
+  // so nodes execute at the same time
+  common::Error err;
+  std::set<NativeConnection*> broken;
+  size_t queued = 0;
+  for (; queued < contexts.size(); ++queued) {
+    const commands_args_t& argv = argvs[queued];
+    std::vector<const char*> argvc(argv.size());
+    std::vector<size_t> argvlen(argv.size());
+    for (size_t j = 0; j < argv.size(); ++j) {
+      argvc[j] = argv[j].data();
+      argvlen[j] = argv[j].size();
+    }
+    if (redisAppendCommandArgv(contexts[queued], static_cast<int>(argv.size()), argvc.data(), argvlen.data()) ==
+        REDIS_ERR) {
+      err = PrintRedisContextError(contexts[queued]);
+      broken.insert(contexts[queued]);
+      break;
+    }
+  }
+
+  for (size_t i = 0; i < queued; ++i) {
+    int done = 0;
+    while (!done && !broken.count(contexts[i])) {
+      if (redisBufferWrite(contexts[i], &done) == REDIS_ERR) {
+        if (!err) {
+          err = PrintRedisContextError(contexts[i]);
+        }
+        broken.insert(contexts[i]);
+      }
+    }
+  }
+
+  // read replies of every queued command even after error, otherwise cached node connections
+  // would return them to next commands; connections which can't be read are closed
+  replies->clear();
+  for (size_t i = 0; i < queued; ++i) {
+    if (broken.count(contexts[i])) {
+      continue;
+    }
+
+    void* reply = NULL;
+    if (redisGetReply(contexts[i], &reply) == REDIS_ERR) {
+      if (!err) {
+        err = PrintRedisContextError(contexts[i]);
+      }
+      broken.insert(contexts[i]);
+      continue;
+    }
+
+    redisReply* rreply = static_cast<redisReply*>(reply);
+    if (rreply->type == REDIS_REPLY_ERROR) {
+      if (!err) {
+        err = common::make_error(std::string(rreply->str, rreply->len));
+      }
+      freeReplyObject(rreply);
+      continue;
+    }
+    replies->push_back(rreply);
+  }
+
+  for (auto it = broken.begin(); it != broken.end(); ++it) {
+    CloseClusterNode(*it);
+  }
+
+  if (err) {
+    FreeReplies(replies);
+  }
+  return err;
+}
+
+common::Error DBConnection::ExecOnMasters(const commands_args_t& argv, std::vector<redisReply*>* replies) {
+  const std::vector<ClusterSlotsMap::Node> masters = cluster_slots_.GetMasters();
+  std::vector<NativeConnection*> contexts;
+  for (size_t i = 0; i < masters.size(); ++i) {
+    NativeConnection* context = NULL;
+    common::Error err = GetClusterNodeContext(masters[i], &context);
+    if (err) {
+      return err;
+    }
+    contexts.push_back(context);
+  }
+
+  return ExecFanOut(contexts, std::vector<commands_args_t>(contexts.size(), argv), replies);
+}
+
+common::Error DBConnection::ClusterScan(uint64_t cursor_in,
+                                        const std::string& pattern,
+                                        uint64_t count_keys,
+                                        std::vector<std::string>* keys_out,
+                                        uint64_t* cursor_out) {
+  // cursor of cluster scan is id of saved node cursors
+  cluster_scan_t pending;
+  if (cursor_in == 0) {
+    const std::vector<ClusterSlotsMap::Node> masters = cluster_slots_.GetMasters();
+    for (size_t i = 0; i < masters.size(); ++i) {
+      pending.push_back(std::make_pair(masters[i], 0));
+    }
+  } else {
+    auto it = cluster_scans_.find(cursor_in);
+    if (it == cluster_scans_.end()) {
+      return common::make_error("Unknown cluster scan cursor");
+    }
+    pending = it->second;
+    cluster_scans_.erase(it);
+  }
+
+  if (pending.empty()) {
+    *cursor_out = 0;
+    return common::Error();
+  }
+
+  const uint64_t node_count = std::max<uint64_t>(1, count_keys / pending.size());
+  std::vector<NativeConnection*> contexts;
+  std::vector<commands_args_t> argvs;
+  for (size_t i = 0; i < pending.size(); ++i) {
+    NativeConnection* context = NULL;
+    common::Error err = GetClusterNodeContext(pending[i].first, &context);
+    if (err) {
+      return err;
+    }
+
+    commands_args_t argv;
+    if (!SplitCommandArgs(core::internal::GetKeysPattern(pending[i].second, pattern, node_count), &argv)) {
+      return common::make_error_inval();
+    }
+    contexts.push_back(context);
+    argvs.push_back(argv);
+  }
+
+  std::vector<redisReply*> replies;
+  common::Error err = ExecFanOut(contexts, argvs, &replies);
+  if (err) {
+    return err;
+  }
+
+  cluster_scan_t next;
+  for (size_t i = 0; i < replies.size(); ++i) {
+    uint64_t node_cursor = 0;
+    common::Error parse_err = ParseScanReply(replies[i], keys_out, &node_cursor);  // frees reply
+    if (parse_err && !err) {
+      err = parse_err;
+    }
+    if (node_cursor != 0) {
+      next.push_back(std::make_pair(pending[i].first, node_cursor));
+    }
+  }
+
+  if (err) {
+    return err;
+  }
+
+  if (next.empty()) {
+    *cursor_out = 0;
+    return common::Error();
+  }
+
+  if (cluster_scans_.size() >= CLUSTER_MAX_SCANS) {  // abandoned scans
+    cluster_scans_.erase(cluster_scans_.begin());
+  }
+  if (++last_cluster_scan_ == 0) {
+    ++last_cluster_scan_;
+  }
+  cluster_scans_[last_cluster_scan_] = next;
+  *cursor_out = last_cluster_scan_;
+  return common::Error();
+}
+
 /* Sends SYNC and reads the number of bytes in the payload.
  * Used both by
  * slaveMode() and getRDB(). */
@@ -548,7 +917,7 @@ common::Error DBConnection::SendSync(unsigned long long* payload) {
    * and we don't want to mess with its buffers, so
    * everything is performed
    * using direct low-level I/O. */
-  char buf[4096], *p;
+  char buf[4096];
 
   /* Send the SYNC command. */
   ssize_t nwrite = 0;
@@ -556,28 +925,43 @@ common::Error DBConnection::SendSync(unsigned long long* payload) {
     return common::make_error("Error writing to master");
   }
 
-  /* Read $<payload>\r\n, making sure to read just up to
-   * "\n" */
-  p = buf;
-  while (1) {
-    ssize_t nread = 0;
-    int res = redisReadToBuffer(connection_.handle_, p, 1, &nread);
-    if (res == REDIS_ERR) {
+  /* Read $<payload>\r\n in chunks, bytes after "\n" are already payload,
+   * they are returned to hiredis reader and redisReadToBuffer serves them first. */
+  size_t len = 0;
+  char* eol = NULL;
+  while (!eol) {
+    if (len == sizeof(buf)) {
       return common::make_error("Error reading bulk length while SYNCing");
     }
 
-    if (!nread) {
-      continue;
+    ssize_t nread = 0;
+    int res = redisReadToBuffer(connection_.handle_, buf + len, sizeof(buf) - len, &nread);
+    if (res == REDIS_ERR) {
+      return common::make_error("Error reading bulk length while SYNCing");
     }
+    len += nread;
 
-    if (*p == '\n' && p != buf) {
-      break;
+    /* master sends newlines while payload is being prepared */
+    size_t skip = 0;
+    while (skip < len && buf[skip] == '\n') {
+      skip++;
     }
-    if (*p != '\n') {
-      p++;
+    if (skip) {
+      memmove(buf, buf + skip, len - skip);
+      len -= skip;
     }
+    eol = static_cast<char*>(memchr(buf, '\n', len));
+  }
+
+  const size_t line_len = eol - buf + 1;
+  if (line_len < len && redisReaderFeed(connection_.handle_->reader, eol + 1, len - line_len) != REDIS_OK) {
+    return common::make_error("Error reading bulk length while SYNCing");
+  }
+
+  *eol = '\0';
+  if (eol != buf && *(eol - 1) == '\r') {
+    *(eol - 1) = '\0';
   }
-  *p = '\0';
   if (buf[0] == '-') {
     std::string buf2 = common::MemSPrintf("SYNC with master failed: %s", buf);
     return common::make_error(buf2);
@@ -604,27 +988,58 @@ common::Error DBConnection::SlaveMode(FastoObject* out) {
     return err;
   }
 
-  char buf[1024];
-  /* Discard the payload. */
+  /* Stream the payload through RDB parser to build memory report. */
+  RdbMemoryReport report;
+  RdbParser parser(
+      [this, &payload](char* buf, size_t size, size_t* nread) -> common::Error {
+        if (!payload) {
+          return common::make_error("Unexpected end of RDB payload");
+        }
+
+        ssize_t lnread = 0;
+        int res = redisReadToBuffer(connection_.handle_, buf, (payload > size) ? size : payload, &lnread);
+        if (res == REDIS_ERR) {
+          return common::make_error("Error reading RDB payload while SYNCing");
+        }
+        payload -= lnread;
+        *nread = lnread;
+        return common::Error();
+      },
+      [&report](const RdbKeyInfo& info) { report.AddKey(info); });
+  err = parser.Parse();
+  if (err) {
+    LOG_CORE_MSG(common::MemSPrintf("RDB payload parsed partially (%" PRIu64 " bytes): %s", parser.GetParsedBytes(),
+                                    err->GetDescription()),
+                 common::logging::LOG_LEVEL_WARNING, false);
+  }
+
+  std::vector<char> buf(RdbParser::buffer_size);
+  /* Discard rest of the payload. */
   while (payload) {
     ssize_t nread = 0;
-    int res = redisReadToBuffer(connection_.handle_, buf, (payload > sizeof(buf)) ? sizeof(buf) : payload, &nread);
+    int res = redisReadToBuffer(connection_.handle_, buf.data(), (payload > buf.size()) ? buf.size() : payload, &nread);
     if (res == REDIS_ERR) {
       return common::make_error("Error reading RDB payload while SYNCing");
     }
     payload -= nread;
   }
 
-  /* Now we can use hiredis to read the incoming protocol.
-   */
-  while (!IsInterrupted()) {
-    err = CliReadReply(out);
-    if (err) {
-      return err;
+  common::ArrayValue* report_value = report.MakeValue();
+  for (size_t i = 0; i < report_value->GetSize(); ++i) {  // totals, biggest keys and prefixes
+    std::string line;
+    if (report_value->GetString(i, &line)) {
+      LOG_CORE_MSG("RDB " + line, common::logging::LOG_LEVEL_INFO, false);
     }
   }
+  FastoObject* report_obj = new FastoObject(out, report_value, GetDelimiter());
+  out->AddChildren(report_obj);
 
-  return common::make_error(common::COMMON_EINTR);
+  /* Now we can use hiredis to read the incoming protocol.
+   * Replicated commands get their own ring, so they never push the report out.
+   */
+  FastoObject* stream_obj = new FastoObject(out, common::Value::CreateStringValue("SYNC"), GetDelimiter());
+  out->AddChildren(stream_obj);
+  return ListenLoop("SYNC", stream_obj);
 }
 
 common::Error DBConnection::ScanImpl(uint64_t cursor_in,
@@ -632,6 +1047,10 @@ common::Error DBConnection::ScanImpl(uint64_t cursor_in,
                                      uint64_t count_keys,
                                      std::vector<std::string>* keys_out,
                                      uint64_t* cursor_out) {
+  if (IsClusterMode()) {
+    return ClusterScan(cursor_in, pattern, count_keys, keys_out, cursor_out);
+  }
+
   const command_buffer_t pattern_result = core::internal::GetKeysPattern(cursor_in, pattern, count_keys);
   redisReply* reply = NULL;
   common::Error err = ExecRedisCommand(connection_.handle_, pattern_result, &reply);
@@ -639,51 +1058,7 @@ common::Error DBConnection::ScanImpl(uint64_t cursor_in,
     return err;
   }
 
-  if (reply->type != REDIS_REPLY_ARRAY) {
-    freeReplyObject(reply);
-    return common::make_error("I/O error");
-  }
-
-  common::Value* val = nullptr;
-  err = ValueFromReplay(reply, &val);
-  if (err) {
-    delete val;
-    freeReplyObject(reply);
-    return err;
-  }
-
-  common::ArrayValue* arr = static_cast<common::ArrayValue*>(val);
-  CHECK_EQ(2, arr->GetSize());
-  std::string cursor_out_str;
-  if (!arr->GetString(0, &cursor_out_str)) {
-    delete val;
-    freeReplyObject(reply);
-    return common::make_error("I/O error");
-  }
-
-  common::ArrayValue* arr_keys = nullptr;
-  if (!arr->GetList(1, &arr_keys)) {
-    delete val;
-    freeReplyObject(reply);
-    return common::make_error("I/O error");
-  }
-
-  for (size_t i = 0; i < arr_keys->GetSize(); ++i) {
-    std::string key;
-    if (arr_keys->GetString(i, &key)) {
-      keys_out->push_back(key);
-    }
-  }
-
-  uint64_t lcursor_out;
-  if (!common::ConvertFromString(cursor_out_str, &lcursor_out)) {
-    return common::make_error_inval();
-  }
-
-  *cursor_out = lcursor_out;
-  delete val;
-  freeReplyObject(reply);
-  return common::Error();
+  return ParseScanReply(reply, keys_out, cursor_out);
 }
 
 common::Error DBConnection::KeysImpl(const std::string& key_start,
@@ -698,6 +1073,24 @@ common::Error DBConnection::KeysImpl(const std::string& key_start,
 }
 
 common::Error DBConnection::DBkcountImpl(size_t* size) {
+  if (IsClusterMode()) {
+    std::vector<redisReply*> replies;
+    common::Error err = ExecOnMasters({DBSIZE}, &replies);
+    if (err) {
+      return err;
+    }
+
+    size_t total = 0;
+    for (size_t i = 0; i < replies.size(); ++i) {
+      if (replies[i]->type == REDIS_REPLY_INTEGER) {
+        total += static_cast<size_t>(replies[i]->integer);
+      }
+    }
+    FreeReplies(&replies);
+    *size = total;
+    return common::Error();
+  }
+
   redisReply* reply = reinterpret_cast<redisReply*>(redisCommand(connection_.handle_, DBSIZE));
 
   if (!reply || reply->type != REDIS_REPLY_INTEGER) {
@@ -711,6 +1104,17 @@ common::Error DBConnection::DBkcountImpl(size_t* size) {
 }
 
 common::Error DBConnection::FlushDBImpl() {
+  if (IsClusterMode()) {
+    std::vector<redisReply*> replies;
+    common::Error err = ExecOnMasters({DB_FLUSHDB_COMMAND}, &replies);
+    if (err) {
+      return err;
+    }
+
+    FreeReplies(&replies);
+    return common::Error();
+  }
+
   redisReply* reply = reinterpret_cast<redisReply*>(redisCommand(connection_.handle_, DB_FLUSHDB_COMMAND));
   if (!reply) {
     return PrintRedisContextError(connection_.handle_);
@@ -751,32 +1155,51 @@ common::Error DBConnection::SelectImpl(const std::string& name, IDataBaseInfo**
 }
 
 common::Error DBConnection::DeleteImpl(const NKeys& keys, NKeys* deleted_keys) {
+  // variadic UNLINK (DEL before 4.0) per DELETE_BATCH_SIZE keys,
+  // in cluster mode keys are grouped by slot because multi key commands can't cross slots
+  std::map<uint16_t, NKeys> groups;
   for (size_t i = 0; i < keys.size(); ++i) {
-    NKey key = keys[i];
-    command_buffer_t del_cmd;
-    redis_translator_t tran = GetSpecificTranslator<CommandTranslator>();
-    common::Error err = tran->DeleteKeyCommand(key, &del_cmd);
-    if (err) {
-      return err;
+    uint16_t slot = 0;
+    if (IsClusterMode()) {
+      const string_key_t key_str = keys[i].GetKey().GetKeyData();
+      slot = KeyHashSlot(key_str.data(), key_str.size());
     }
+    groups[slot].push_back(keys[i]);
+  }
+
+  bool use_unlink = true;
+  for (auto it = groups.begin(); it != groups.end(); ++it) {
+    const NKeys& group = it->second;
+    for (size_t start = 0; start < group.size(); start += DELETE_BATCH_SIZE) {
+      const size_t end = std::min(group.size(), start + DELETE_BATCH_SIZE);
+      commands_args_t argv;
+      argv.push_back(use_unlink ? REDIS_UNLINK_COMMAND : DB_DELETE_KEY_COMMAND);
+      for (size_t i = start; i < end; ++i) {
+        argv.push_back(group[i].GetKey().GetKeyData());
+      }
 
-    redisReply* reply = NULL;
-    err = ExecRedisCommand(connection_.handle_, del_cmd, &reply);
-    if (err) {
-      return err;
-    }
+      redisReply* reply = NULL;
+      common::Error err = ExecRoutedCommand(argv, &reply);
+      if (err && use_unlink && err->GetDescription().find("unknown command") != std::string::npos) {
+        use_unlink = false;
+        argv[0] = DB_DELETE_KEY_COMMAND;
+        err = ExecRoutedCommand(argv, &reply);
+      }
+      if (err) {
+        return err;
+      }
 
-    if (reply->type == REDIS_REPLY_INTEGER && reply->integer == 1) {
-      deleted_keys->push_back(key);
+      // reply is count of removed keys, missing keys are reported too because they are absent anyway
+      deleted_keys->insert(deleted_keys->end(), group.begin() + start, group.begin() + end);
+      freeReplyObject(reply);
     }
-    freeReplyObject(reply);
   }
 
   return common::Error();
 }
 
 common::Error DBConnection::SetImpl(const NDbKValue& key, NDbKValue* added_key) {
-  command_buffer_t set_cmd;
+  commands_args_t set_cmd;
   redis_translator_t tran = GetSpecificTranslator<CommandTranslator>();
   common::Error err = tran->CreateKeyCommand(key, &set_cmd);
   if (err) {
@@ -784,7 +1207,7 @@ common::Error DBConnection::SetImpl(const NDbKValue& key, NDbKValue* added_key)
   }
 
   redisReply* reply = NULL;
-  err = ExecRedisCommand(connection_.handle_, set_cmd, &reply);
+  err = ExecRoutedCommand(set_cmd, &reply);
   if (err) {
     return err;
   }
@@ -795,7 +1218,7 @@ common::Error DBConnection::SetImpl(const NDbKValue& key, NDbKValue* added_key)
 }
 
 common::Error DBConnection::GetImpl(const NKey& key, NDbKValue* loaded_key) {
-  command_buffer_t get_cmd;
+  commands_args_t get_cmd;
   redis_translator_t tran = GetSpecificTranslator<CommandTranslator>();
   common::Error err = tran->LoadKeyCommand(key, common::Value::TYPE_STRING, &get_cmd);
   if (err) {
@@ -803,7 +1226,7 @@ common::Error DBConnection::GetImpl(const NKey& key, NDbKValue* loaded_key) {
   }
 
   redisReply* reply = NULL;
-  err = ExecRedisCommand(connection_.handle_, get_cmd, &reply);
+  err = ExecRoutedCommand(get_cmd, &reply);
   if (err) {
     return err;
   }
@@ -822,14 +1245,14 @@ common::Error DBConnection::GetImpl(const NKey& key, NDbKValue* loaded_key) {
 
 common::Error DBConnection::RenameImpl(const NKey& key, string_key_t new_key) {
   redis_translator_t tran = GetSpecificTranslator<CommandTranslator>();
-  command_buffer_t rename_cmd;
+  commands_args_t rename_cmd;
   common::Error err = tran->RenameKeyCommand(key, key_t(new_key), &rename_cmd);
   if (err) {
     return err;
   }
 
   redisReply* reply = NULL;
-  err = ExecRedisCommand(connection_.handle_, rename_cmd, &reply);
+  err = ExecRoutedCommand(rename_cmd, &reply);
   if (err) {
     return err;
   }
@@ -841,14 +1264,14 @@ common::Error DBConnection::RenameImpl(const NKey& key, string_key_t new_key) {
 common::Error DBConnection::SetTTLImpl(const NKey& key, ttl_t ttl) {
   key_t key_str = key.GetKey();
   redis_translator_t tran = GetSpecificTranslator<CommandTranslator>();
-  command_buffer_t ttl_cmd;
+  commands_args_t ttl_cmd;
   common::Error err = tran->ChangeKeyTTLCommand(key, ttl, &ttl_cmd);
   if (err) {
     return err;
   }
 
   redisReply* reply = NULL;
-  err = ExecRedisCommand(connection_.handle_, ttl_cmd, &reply);
+  err = ExecRoutedCommand(ttl_cmd, &reply);
   if (err) {
     return err;
   }
@@ -863,14 +1286,14 @@ common::Error DBConnection::SetTTLImpl(const NKey& key, ttl_t ttl) {
 
 common::Error DBConnection::GetTTLImpl(const NKey& key, ttl_t* ttl) {
   redis_translator_t tran = GetSpecificTranslator<CommandTranslator>();
-  command_buffer_t ttl_cmd;
+  commands_args_t ttl_cmd;
   common::Error err = tran->LoadKeyTTLCommand(key, &ttl_cmd);
   if (err) {
     return err;
   }
 
   redisReply* reply = NULL;
-  err = ExecRedisCommand(connection_.handle_, ttl_cmd, &reply);
+  err = ExecRoutedCommand(ttl_cmd, &reply);
   if (err) {
     return err;
   }
@@ -887,7 +1310,7 @@ common::Error DBConnection::GetTTLImpl(const NKey& key, ttl_t* ttl) {
 
 common::Error DBConnection::ModuleLoadImpl(const ModuleInfo& module) {
   redis_translator_t tran = GetSpecificTranslator<CommandTranslator>();
-  command_buffer_t module_load_cmd;
+  commands_args_t module_load_cmd;
   common::Error err = tran->ModuleLoadCommand(module, &module_load_cmd);
   if (err) {
     return err;
@@ -905,7 +1328,7 @@ common::Error DBConnection::ModuleLoadImpl(const ModuleInfo& module) {
 
 common::Error DBConnection::ModuleUnLoadImpl(const ModuleInfo& module) {
   redis_translator_t tran = GetSpecificTranslator<CommandTranslator>();
-  command_buffer_t module_unload_cmd;
+  commands_args_t module_unload_cmd;
   common::Error err = tran->ModuleUnloadCommand(module, &module_unload_cmd);
   if (err) {
     return err;
@@ -936,30 +1359,75 @@ common::Error DBConnection::QuitImpl() {
 common::Error DBConnection::CliFormatReplyRaw(FastoObject* out, redisReply* r) {
   if (!out || !r) {
     DNOTREACHED();
+    if (r) {
+      freeReplyObject(r);
+    }
     return common::make_error_inval();
   }
 
-  common::Value* out_val = nullptr;
-  common::Error err = ValueFromReplay(r, &out_val);
-  if (err) {
-    if (err->GetDescription() == "NOAUTH") {  //"NOAUTH Authentication
-                                              // required."
+  const redisReply* err_reply = FindErrorReply(r);
+  if (err_reply) {
+    std::string str(err_reply->str, err_reply->len);
+    freeReplyObject(r);
+    if (str == "NOAUTH") {  //"NOAUTH Authentication
+                            // required."
       is_auth_ = false;
     }
-    return err;
+    return common::make_error(str);
   }
 
-  FastoObject* obj = new FastoObject(out, out_val, GetDelimiter());
+  // bulk strings stay in reply until value is requested
+  FastoObject* obj = new ReplyObject(out, r, GetDelimiter());
   out->AddChildren(obj);
   return common::Error();
 }
 
-common::Error DBConnection::CliReadReply(FastoObject* out) {
+common::Error DBConnection::ListenLoop(const char* name, FastoObject* out) {
   if (!out) {
     DNOTREACHED();
     return common::make_error_inval();
   }
 
+  out->SetChildrensLimit(LISTEN_MAX_MESSAGES);
+  uint64_t received = 0;
+  uint64_t sample_received = 0;
+  common::time64_t sample_start = common::time::current_mstime();
+  common::Error err;
+  while (!IsInterrupted()) {  // listen loop
+    err = CliReadReply(out);
+    if (err) {
+      break;
+    }
+
+    received++;
+    const common::time64_t now = common::time::current_mstime();
+    const common::time64_t elapsed = now - sample_start;
+    if (elapsed >= LISTEN_RATE_SAMPLE_MSEC) {
+      const double rate = static_cast<double>(received - sample_received) * 1000 / elapsed;
+      LOG_CORE_MSG(common::MemSPrintf("%s received %" PRIu64 " messages (%.2f msg/sec), dropped %" PRIu64 ".", name,
+                                      received, rate, out->GetDroppedChildrensCount()),
+                   common::logging::LOG_LEVEL_INFO, false);
+      sample_received = received;
+      sample_start = now;
+    }
+  }
+
+  LOG_CORE_MSG(common::MemSPrintf("%s finished, received %" PRIu64 " messages, dropped %" PRIu64 ".", name, received,
+                                  out->GetDroppedChildrensCount()),
+               common::logging::LOG_LEVEL_INFO, false);
+  if (err) {
+    return err;
+  }
+
+  return common::make_error(common::COMMON_EINTR);
+}
+
+common::Error DBConnection::CliGetReply(redisReply** out_reply) {
+  if (!out_reply) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
   common::Error err = TestIsConnected();
   if (err) {
     return err;
@@ -978,15 +1446,47 @@ common::Error DBConnection::CliReadReply(FastoObject* out) {
     return PrintRedisContextError(connection_.handle_); /* avoid compiler warning */
   }
 
-  redisReply* reply = static_cast<redisReply*>(_reply);
-  common::Error er = CliFormatReplyRaw(out, reply);
-  freeReplyObject(reply);
-  return er;
+  *out_reply = static_cast<redisReply*>(_reply);
+  return common::Error();
+}
+
+common::Error DBConnection::CliReadReply(FastoObject* out) {
+  if (!out) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  redisReply* reply = NULL;
+  common::Error err = CliGetReply(&reply);
+  if (err) {
+    return err;
+  }
+
+  return CliFormatReplyRaw(out, reply);
+}
+
+common::Error DBConnection::ReadPipelineReply(FastoObjectCommand* cmd, common::Error* first_err) {
+  redisReply* reply = NULL;
+  common::Error err = CliGetReply(&reply);
+  if (err) {  // connection is lost, replies of the rest commands can't be read
+    return err;
+  }
+
+  // error reply belongs to this command only, next replies are still in order
+  err = CliFormatReplyRaw(cmd, reply);
+  if (err) {
+    cmd->SetError(err);
+    if (!*first_err) {
+      *first_err = err;
+    }
+  }
+  return common::Error();
 }
 
 common::Error DBConnection::ExecuteAsPipeline(const std::vector<FastoObjectCommandIPtr>& cmds,
-                                              void (*log_command_cb)(FastoObjectCommandIPtr command)) {
-  if (cmds.empty()) {
+                                              void (*log_command_cb)(FastoObjectCommandIPtr command),
+                                              size_t window) {
+  if (cmds.empty() || window == 0) {
     DNOTREACHED();
     return common::make_error("Invalid input command");
   }
@@ -996,46 +1496,83 @@ common::Error DBConnection::ExecuteAsPipeline(const std::vector<FastoObjectComma
     return err;
   }
 
-  // start piplene mode
-  std::vector<FastoObjectCommandIPtr> valid_cmds;
+  // start piplene mode, not more than window commands waiting for replies
+  std::deque<FastoObjectCommandIPtr> in_flight;
+  commands_args_t argv;
+  std::vector<const char*> argv_ptrs;
+  std::vector<size_t> argv_lens;
+  common::Error first_err;  // of commands, reported after all sent commands got replies
+  bool interrupted = false;
   for (size_t i = 0; i < cmds.size(); ++i) {
+    if (IsInterrupted()) {
+      interrupted = true;  // stop sending, but read replies of already sent commands
+      break;
+    }
+
     FastoObjectCommandIPtr cmd = cmds[i];
-    command_buffer_t command = cmd->GetInputCommand();
+    const command_buffer_t command = cmd->GetInputCommand();
     if (command.empty()) {
       continue;
     }
 
+    if (!SplitCommandArgs(command, &argv) || argv.empty()) {
+      err = common::make_error(common::MemSPrintf("Invalid input command: %s", command));
+    } else if (!isPipeLineCommand(argv[0].c_str())) {
+      err = common::make_error(common::MemSPrintf("Command %s can't be executed in pipeline", argv[0]));
+    }
+    if (err) {
+      cmd->SetError(err);
+      if (!first_err) {
+        first_err = err;
+      }
+      err = common::Error();
+      continue;
+    }
+
     if (log_command_cb) {
       log_command_cb(cmd);
     }
 
-    int argc = 0;
-    sds* argv = sdssplitargslong(command.data(), &argc);
-    if (argv) {
-      if (isPipeLineCommand(argv[0])) {
-        valid_cmds.push_back(cmd);
-        void* raw_argvlen_ptr = malloc(static_cast<size_t>(argc) * sizeof(size_t));
-        size_t* argvlen = reinterpret_cast<size_t*>(raw_argvlen_ptr);
-        for (int i = 0; i < argc; ++i) {
-          argvlen[i] = sdslen(argv[i]);
-        }
-        redisAppendCommandArgv(connection_.handle_, argc, const_cast<const char**>(argv), argvlen);
-        free(raw_argvlen_ptr);
+    argv_ptrs.clear();
+    argv_lens.clear();
+    for (size_t j = 0; j < argv.size(); ++j) {
+      argv_ptrs.push_back(argv[j].data());
+      argv_lens.push_back(argv[j].size());
+    }
+    if (redisAppendCommandArgv(connection_.handle_, static_cast<int>(argv.size()), argv_ptrs.data(),
+                               argv_lens.data()) != REDIS_OK) {
+      err = PrintRedisContextError(connection_.handle_);
+      break;  // already sent commands are still drained
+    }
+    in_flight.push_back(cmd);
+
+    // backpressure: first reply flushes queued commands, next ones are read from the socket buffer
+    while (in_flight.size() >= window) {
+      err = ReadPipelineReply(in_flight.front().get(), &first_err);
+      in_flight.pop_front();
+      if (err) {
+        return err;
       }
-      sdsfreesplitres(argv, argc);
     }
   }
 
-  for (size_t i = 0; i < valid_cmds.size(); ++i) {
-    FastoObjectCommandIPtr cmd = cmds[i];
-    common::Error err = CliReadReply(cmd.get());
-    if (err) {
-      return err;
+  while (!in_flight.empty()) {
+    common::Error read_err = ReadPipelineReply(in_flight.front().get(), &first_err);
+    in_flight.pop_front();
+    if (read_err) {
+      return read_err;
     }
   }
   // end piplene
 
-  return common::Error();
+  if (err) {
+    return err;
+  }
+
+  if (interrupted) {
+    return common::make_error(common::COMMON_EINTR);
+  }
+  return first_err;
 }
 
 common::Error DBConnection::CommonExec(const commands_args_t& argv, FastoObject* out) {
@@ -1050,14 +1587,12 @@ common::Error DBConnection::CommonExec(const commands_args_t& argv, FastoObject*
   }
 
   redisReply* reply = NULL;
-  err = ExecRedisCommand(connection_.handle_, argv, &reply);
+  err = ExecRoutedCommand(argv, &reply);
   if (err) {
     return err;
   }
 
-  err = CliFormatReplyRaw(out, reply);
-  freeReplyObject(reply);
-  return err;
+  return CliFormatReplyRaw(out, reply);
 }
 
 common::Error DBConnection::Auth(const std::string& password) {
@@ -1094,20 +1629,11 @@ common::Error DBConnection::Monitor(const commands_args_t& argv, FastoObject* ou
   }
 
   err = CliFormatReplyRaw(out, reply);
-  freeReplyObject(reply);
-  reply = NULL;
   if (err) {
     return err;
   }
 
-  while (!IsInterrupted()) {  // listen loop
-    err = CliReadReply(out);
-    if (err) {
-      return err;
-    }
-  }
-
-  return common::make_error(common::COMMON_EINTR);
+  return ListenLoop("MONITOR", out);
 }
 
 common::Error DBConnection::Subscribe(const commands_args_t& argv, FastoObject* out) {
@@ -1128,20 +1654,11 @@ common::Error DBConnection::Subscribe(const commands_args_t& argv, FastoObject*
   }
 
   err = CliFormatReplyRaw(out, reply);
-  freeReplyObject(reply);
-  reply = NULL;
   if (err) {
     return err;
   }
 
-  while (!IsInterrupted()) {  // listen loop
-    err = CliReadReply(out);
-    if (err) {
-      return err;
-    }
-  }
-
-  return common::make_error(common::COMMON_EINTR);
+  return ListenLoop("SUBSCRIBE", out);
 }
 
 common::Error DBConnection::SetEx(const NDbKValue& key, ttl_t ttl) {
@@ -1151,14 +1668,14 @@ common::Error DBConnection::SetEx(const NDbKValue& key, ttl_t ttl) {
   }
 
   redis_translator_t tran = GetSpecificTranslator<CommandTranslator>();
-  command_buffer_t setex_cmd;
+  commands_args_t setex_cmd;
   err = tran->SetEx(key, ttl, &setex_cmd);
   if (err) {
     return err;
   }
 
   redisReply* reply = NULL;
-  err = ExecRedisCommand(connection_.handle_, setex_cmd, &reply);
+  err = ExecRoutedCommand(setex_cmd, &reply);
   if (err) {
     return err;
   }
@@ -1180,14 +1697,14 @@ common::Error DBConnection::SetNX(const NDbKValue& key, long long* result) {
   }
 
   redis_translator_t tran = GetSpecificTranslator<CommandTranslator>();
-  command_buffer_t setnx_cmd;
+  commands_args_t setnx_cmd;
   err = tran->SetNX(key, &setnx_cmd);
   if (err) {
     return err;
   }
 
   redisReply* reply = NULL;
-  err = ExecRedisCommand(connection_.handle_, setnx_cmd, &reply);
+  err = ExecRoutedCommand(setnx_cmd, &reply);
   if (err) {
     return err;
   }
@@ -1219,14 +1736,14 @@ common::Error DBConnection::Lpush(const NKey& key, NValue arr, long long* list_l
 
   NDbKValue rarr(key, arr);
   redis_translator_t tran = GetSpecificTranslator<CommandTranslator>();
-  command_buffer_t lpush_cmd;
+  commands_args_t lpush_cmd;
   err = tran->CreateKeyCommand(rarr, &lpush_cmd);
   if (err) {
     return err;
   }
 
   redisReply* reply = NULL;
-  err = ExecRedisCommand(connection_.handle_, lpush_cmd, &reply);
+  err = ExecRoutedCommand(lpush_cmd, &reply);
   if (err) {
     return err;
   }
@@ -1256,14 +1773,14 @@ common::Error DBConnection::Lrange(const NKey& key, int start, int stop, NDbKVal
   }
 
   redis_translator_t tran = GetSpecificTranslator<CommandTranslator>();
-  command_buffer_t lrange_cmd;
+  commands_args_t lrange_cmd;
   err = tran->Lrange(key, start, stop, &lrange_cmd);
   if (err) {
     return err;
   }
 
   redisReply* reply = NULL;
-  err = ExecRedisCommand(connection_.handle_, lrange_cmd, &reply);
+  err = ExecRoutedCommand(lrange_cmd, &reply);
   if (err) {
     return err;
   }
@@ -1302,14 +1819,14 @@ common::Error DBConnection::Sadd(const NKey& key, NValue set, long long* added)
 
   NDbKValue rset(key, set);
   redis_translator_t tran = GetSpecificTranslator<CommandTranslator>();
-  command_buffer_t sadd_cmd;
+  commands_args_t sadd_cmd;
   err = tran->CreateKeyCommand(rset, &sadd_cmd);
   if (err) {
     return err;
   }
 
   redisReply* reply = NULL;
-  err = ExecRedisCommand(connection_.handle_, sadd_cmd, &reply);
+  err = ExecRoutedCommand(sadd_cmd, &reply);
   if (err) {
     return err;
   }
@@ -1339,14 +1856,14 @@ common::Error DBConnection::Smembers(const NKey& key, NDbKValue* loaded_key) {
   }
 
   redis_translator_t tran = GetSpecificTranslator<CommandTranslator>();
-  command_buffer_t smembers_cmd;
+  commands_args_t smembers_cmd;
   err = tran->Smembers(key, &smembers_cmd);
   if (err) {
     return err;
   }
 
   redisReply* reply = NULL;
-  err = ExecRedisCommand(connection_.handle_, smembers_cmd, &reply);
+  err = ExecRoutedCommand(smembers_cmd, &reply);
   if (err) {
     return err;
   }
@@ -1401,14 +1918,14 @@ common::Error DBConnection::Zadd(const NKey& key, NValue scores, long long* adde
 
   NDbKValue rzset(key, scores);
   redis_translator_t tran = GetSpecificTranslator<CommandTranslator>();
-  command_buffer_t zadd_cmd;
+  commands_args_t zadd_cmd;
   err = tran->CreateKeyCommand(rzset, &zadd_cmd);
   if (err) {
     return err;
   }
 
   redisReply* reply = NULL;
-  err = ExecRedisCommand(connection_.handle_, zadd_cmd, &reply);
+  err = ExecRoutedCommand(zadd_cmd, &reply);
   if (err) {
     return err;
   }
@@ -1438,14 +1955,14 @@ common::Error DBConnection::Zrange(const NKey& key, int start, int stop, bool wi
   }
 
   redis_translator_t tran = GetSpecificTranslator<CommandTranslator>();
-  command_buffer_t zrange;
+  commands_args_t zrange;
   err = tran->Zrange(key, start, stop, withscores, &zrange);
   if (err) {
     return err;
   }
 
   redisReply* reply = NULL;
-  err = ExecRedisCommand(connection_.handle_, zrange, &reply);
+  err = ExecRoutedCommand(zrange, &reply);
   if (err) {
     return err;
   }
@@ -1510,14 +2027,14 @@ common::Error DBConnection::Hmset(const NKey& key, NValue hash) {
 
   NDbKValue rhash(key, hash);
   redis_translator_t tran = GetSpecificTranslator<CommandTranslator>();
-  command_buffer_t hmset_cmd;
+  commands_args_t hmset_cmd;
   err = tran->CreateKeyCommand(rhash, &hmset_cmd);
   if (err) {
     return err;
   }
 
   redisReply* reply = NULL;
-  err = ExecRedisCommand(connection_.handle_, hmset_cmd, &reply);
+  err = ExecRoutedCommand(hmset_cmd, &reply);
   if (err) {
     return err;
   }
@@ -1546,14 +2063,14 @@ common::Error DBConnection::Hgetall(const NKey& key, NDbKValue* loaded_key) {
   }
 
   redis_translator_t tran = GetSpecificTranslator<CommandTranslator>();
-  command_buffer_t hgetall_cmd;
+  commands_args_t hgetall_cmd;
   err = tran->Hgetall(key, &hgetall_cmd);
   if (err) {
     return err;
   }
 
   redisReply* reply = NULL;
-  err = ExecRedisCommand(connection_.handle_, hgetall_cmd, &reply);
+  err = ExecRoutedCommand(hgetall_cmd, &reply);
   if (err) {
     return err;
   }
@@ -1596,6 +2113,146 @@ common::Error DBConnection::Hgetall(const NKey& key, NDbKValue* loaded_key) {
   return common::Error();
 }
 
+common::Error DBConnection::KeySize(const NKey& key, common::Value::Type type, size_t* size) {
+  if (!size) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  common::Error err = TestIsAuthenticated();
+  if (err) {
+    return err;
+  }
+
+  redis_translator_t tran = GetSpecificTranslator<CommandTranslator>();
+  commands_args_t size_cmd;
+  err = tran->KeySize(key, type, &size_cmd);
+  if (err) {
+    return err;
+  }
+
+  redisReply* reply = NULL;
+  err = ExecRoutedCommand(size_cmd, &reply);
+  if (err) {
+    return err;
+  }
+
+  if (reply->type != REDIS_REPLY_INTEGER) {
+    freeReplyObject(reply);
+    return common::make_error("I/O error");
+  }
+
+  *size = reply->integer;
+  freeReplyObject(reply);
+  return common::Error();
+}
+
+common::Error DBConnection::LoadKeyPage(const NKey& key,
+                                        common::Value::Type type,
+                                        uint64_t cursor_in,
+                                        size_t count,
+                                        NValue* page,
+                                        uint64_t* cursor_out) {
+  if (!page || !cursor_out || count == 0) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  common::Error err = TestIsAuthenticated();
+  if (err) {
+    return err;
+  }
+
+  redis_translator_t tran = GetSpecificTranslator<CommandTranslator>();
+  commands_args_t page_cmd;
+  const int start = static_cast<int>(cursor_in);
+  const int stop = static_cast<int>(cursor_in + count - 1);
+  if (type == common::Value::TYPE_ARRAY) {
+    err = tran->Lrange(key, start, stop, &page_cmd);
+  } else if (type == common::Value::TYPE_ZSET) {
+    err = tran->Zrange(key, start, stop, true, &page_cmd);
+  } else if (type == common::Value::TYPE_SET) {
+    err = tran->Sscan(key, cursor_in, count, &page_cmd);
+  } else if (type == common::Value::TYPE_HASH) {
+    err = tran->Hscan(key, cursor_in, count, &page_cmd);
+  } else {
+    return common::make_error("Paging supported only for collection keys");
+  }
+
+  if (err) {
+    return err;
+  }
+
+  redisReply* reply = NULL;
+  err = ExecRoutedCommand(page_cmd, &reply);
+  if (err) {
+    return err;
+  }
+
+  if (reply->type != REDIS_REPLY_ARRAY) {
+    freeReplyObject(reply);
+    return common::make_error("I/O error");
+  }
+
+  // elements are bulk strings, values are built straight from reply
+  const redisReply* elements = reply;
+  uint64_t next_cursor = 0;
+  if (type == common::Value::TYPE_SET || type == common::Value::TYPE_HASH) {
+    if (reply->elements != 2 || reply->element[0]->type != REDIS_REPLY_STRING ||
+        reply->element[1]->type != REDIS_REPLY_ARRAY) {
+      freeReplyObject(reply);
+      return common::make_error("I/O error");
+    }
+
+    const std::string cursor_str(reply->element[0]->str, reply->element[0]->len);
+    if (!common::ConvertFromString(cursor_str, &next_cursor)) {
+      freeReplyObject(reply);
+      return common::make_error_inval();
+    }
+    elements = reply->element[1];
+  } else {
+    const size_t received = type == common::Value::TYPE_ARRAY ? reply->elements : reply->elements / 2;
+    if (received == count) {
+      next_cursor = cursor_in + count;
+    }
+  }
+
+  auto element_value = [elements](size_t i) -> common::Value* {
+    const redisReply* el = elements->element[i];
+    return common::Value::CreateStringValue(std::string(el->str, el->len));
+  };
+
+  if (type == common::Value::TYPE_ARRAY) {
+    common::ArrayValue* arr = common::Value::CreateArrayValue();
+    for (size_t i = 0; i < elements->elements; ++i) {
+      arr->Append(element_value(i));
+    }
+    *page = NValue(arr);
+  } else if (type == common::Value::TYPE_SET) {
+    common::SetValue* set = common::Value::CreateSetValue();
+    for (size_t i = 0; i < elements->elements; ++i) {
+      set->Insert(element_value(i));
+    }
+    *page = NValue(set);
+  } else if (type == common::Value::TYPE_ZSET) {
+    common::ZSetValue* zset = common::Value::CreateZSetValue();
+    for (size_t i = 0; i + 1 < elements->elements; i += 2) {
+      zset->Insert(element_value(i + 1), element_value(i));
+    }
+    *page = NValue(zset);
+  } else {
+    common::HashValue* hash = common::Value::CreateHashValue();
+    for (size_t i = 0; i + 1 < elements->elements; i += 2) {
+      hash->Insert(element_value(i), element_value(i + 1));
+    }
+    *page = NValue(hash);
+  }
+
+  *cursor_out = next_cursor;
+  freeReplyObject(reply);
+  return common::Error();
+}
+
 common::Error DBConnection::Decr(const NKey& key, long long* decr) {
   if (!decr) {
     DNOTREACHED();
@@ -1607,7 +2264,7 @@ common::Error DBConnection::Decr(const NKey& key, long long* decr) {
     return err;
   }
 
-  std::string decr_cmd;
+  commands_args_t decr_cmd;
   redis_translator_t tran = GetSpecificTranslator<CommandTranslator>();
   err = tran->Decr(key, &decr_cmd);
   if (err) {
@@ -1615,7 +2272,7 @@ common::Error DBConnection::Decr(const NKey& key, long long* decr) {
   }
 
   redisReply* reply = NULL;
-  err = ExecRedisCommand(connection_.handle_, decr_cmd, &reply);
+  err = ExecRoutedCommand(decr_cmd, &reply);
   if (err) {
     return err;
   }
@@ -1645,7 +2302,7 @@ common::Error DBConnection::DecrBy(const NKey& key, int dec, long long* decr) {
     return err;
   }
 
-  std::string decrby_cmd;
+  commands_args_t decrby_cmd;
   redis_translator_t tran = GetSpecificTranslator<CommandTranslator>();
   err = tran->DecrBy(key, dec, &decrby_cmd);
   if (err) {
@@ -1653,7 +2310,7 @@ common::Error DBConnection::DecrBy(const NKey& key, int dec, long long* decr) {
   }
 
   redisReply* reply = NULL;
-  err = ExecRedisCommand(connection_.handle_, decrby_cmd, &reply);
+  err = ExecRoutedCommand(decrby_cmd, &reply);
   if (err) {
     return err;
   }
@@ -1683,7 +2340,7 @@ common::Error DBConnection::Incr(const NKey& key, long long* incr) {
     return err;
   }
 
-  std::string incr_cmd;
+  commands_args_t incr_cmd;
   redis_translator_t tran = GetSpecificTranslator<CommandTranslator>();
   err = tran->Incr(key, &incr_cmd);
   if (err) {
@@ -1691,7 +2348,7 @@ common::Error DBConnection::Incr(const NKey& key, long long* incr) {
   }
 
   redisReply* reply = NULL;
-  err = ExecRedisCommand(connection_.handle_, incr_cmd, &reply);
+  err = ExecRoutedCommand(incr_cmd, &reply);
   if (err) {
     return err;
   }
@@ -1721,7 +2378,7 @@ common::Error DBConnection::IncrBy(const NKey& key, int inc, long long* incr) {
     return err;
   }
 
-  std::string incrby_cmd;
+  commands_args_t incrby_cmd;
   redis_translator_t tran = GetSpecificTranslator<CommandTranslator>();
   err = tran->IncrBy(key, inc, &incrby_cmd);
   if (err) {
@@ -1729,7 +2386,7 @@ common::Error DBConnection::IncrBy(const NKey& key, int inc, long long* incr) {
   }
 
   redisReply* reply = NULL;
-  err = ExecRedisCommand(connection_.handle_, incrby_cmd, &reply);
+  err = ExecRoutedCommand(incrby_cmd, &reply);
   if (err) {
     return err;
   }
@@ -1759,7 +2416,7 @@ common::Error DBConnection::IncrByFloat(const NKey& key, double inc, std::string
     return err;
   }
 
-  std::string incrfloat_cmd;
+  commands_args_t incrfloat_cmd;
   redis_translator_t tran = GetSpecificTranslator<CommandTranslator>();
   err = tran->IncrByFloat(key, inc, &incrfloat_cmd);
   if (err) {
@@ -1767,7 +2424,7 @@ common::Error DBConnection::IncrByFloat(const NKey& key, double inc, std::string
   }
 
   redisReply* reply = NULL;
-  err = ExecRedisCommand(connection_.handle_, incrfloat_cmd, &reply);
+  err = ExecRoutedCommand(incrfloat_cmd, &reply);
   if (err) {
     return err;
   }
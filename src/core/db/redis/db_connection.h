@@ -18,8 +18,14 @@
 
 #pragma once
 
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "core/internal/cdb_connection.h"  // for CDBConnection
 
+#include "core/db/redis/cluster_slots.h"  // for ClusterSlotsMap
 #include "core/db/redis/config.h"
 #include "core/db/redis/server_info.h"  // for ServerInfo
 
@@ -30,6 +36,10 @@
 #define GET_SENTINEL_MASTERS "SENTINEL MASTERS"
 #define GET_SENTINEL_SLAVES_PATTERN_1ARGS_S "SENTINEL SLAVES %s"
 
+#define PIPELINE_DEFAULT_WINDOW 1024
+#define CLUSTER_MAX_REDIRECTIONS 5
+#define CLUSTER_MAX_SCANS 64
+
 struct redisContext;  // lines 49-49
 struct redisReply;    // lines 50-50
 
@@ -65,8 +75,10 @@ class DBConnection : public core::internal::CDBConnection<NativeConnection, RCon
 
   common::Error SlaveMode(FastoObject* out) WARN_UNUSED_RESULT;
 
+  // window: max commands sent without read reply
   common::Error ExecuteAsPipeline(const std::vector<FastoObjectCommandIPtr>& cmds,
-                                  void (*log_command_cb)(FastoObjectCommandIPtr)) WARN_UNUSED_RESULT;
+                                  void (*log_command_cb)(FastoObjectCommandIPtr),
+                                  size_t window = PIPELINE_DEFAULT_WINDOW) WARN_UNUSED_RESULT;
 
   common::Error CommonExec(const commands_args_t& argv, FastoObject* out) WARN_UNUSED_RESULT;
   common::Error Auth(const std::string& password) WARN_UNUSED_RESULT;
@@ -88,6 +100,16 @@ class DBConnection : public core::internal::CDBConnection<NativeConnection, RCon
   common::Error Hmset(const NKey& key, NValue hash);
   common::Error Hgetall(const NKey& key, NDbKValue* loaded_key);
 
+  // windowed loading of collections: offsets for lists and zsets, SSCAN/HSCAN cursors for sets and hashes,
+  // cursor_out is 0 after last page
+  common::Error KeySize(const NKey& key, common::Value::Type type, size_t* size) WARN_UNUSED_RESULT;
+  common::Error LoadKeyPage(const NKey& key,
+                            common::Value::Type type,
+                            uint64_t cursor_in,
+                            size_t count,
+                            NValue* page,
+                            uint64_t* cursor_out) WARN_UNUSED_RESULT;
+
   common::Error Decr(const NKey& key, long long* decr);
   common::Error DecrBy(const NKey& key, int inc, long long* decr);
 
@@ -126,11 +148,41 @@ class DBConnection : public core::internal::CDBConnection<NativeConnection, RCon
 
   common::Error SendSync(unsigned long long* payload) WARN_UNUSED_RESULT;
 
-  common::Error CliFormatReplyRaw(FastoObject* out, redisReply* r) WARN_UNUSED_RESULT;
+  // cluster mode: keyed commands go to master of key slot following MOVED/ASK,
+  // SCAN, DBSIZE and FLUSHDB are sent to all masters at once and merged
+  typedef std::vector<std::pair<ClusterSlotsMap::Node, uint64_t>> cluster_scan_t;  // node cursors of SCAN
+  bool IsClusterMode() const;
+  common::Error RefreshClusterSlots() WARN_UNUSED_RESULT;
+  common::Error GetClusterNodeContext(const ClusterSlotsMap::Node& node, NativeConnection** context) WARN_UNUSED_RESULT;
+  void CloseClusterNode(NativeConnection* context);  // drops cached node connection
+  void CloseClusterNodes();
+  common::Error ExecRoutedCommand(const commands_args_t& argv, redisReply** out_reply) WARN_UNUSED_RESULT;
+  common::Error ExecFanOut(const std::vector<NativeConnection*>& contexts,
+                           const std::vector<commands_args_t>& argvs,
+                           std::vector<redisReply*>* replies) WARN_UNUSED_RESULT;  // replies in order of contexts
+  common::Error ExecOnMasters(const commands_args_t& argv, std::vector<redisReply*>* replies) WARN_UNUSED_RESULT;
+  common::Error ClusterScan(uint64_t cursor_in,
+                            const std::string& pattern,
+                            uint64_t count_keys,
+                            std::vector<std::string>* keys_out,
+                            uint64_t* cursor_out) WARN_UNUSED_RESULT;
+
+  common::Error CliFormatReplyRaw(FastoObject* out, redisReply* r) WARN_UNUSED_RESULT;  // r take ownership
+  common::Error CliGetReply(redisReply** out_reply) WARN_UNUSED_RESULT;  // fails only on connection errors
   common::Error CliReadReply(FastoObject* out) WARN_UNUSED_RESULT;
+  // error reply is set to cmd and kept in first_err, returned error means connection is lost
+  common::Error ReadPipelineReply(FastoObjectCommand* cmd, common::Error* first_err) WARN_UNUSED_RESULT;
+  // reads pushed messages until interrupted, out keeps only last LISTEN_MAX_MESSAGES
+  common::Error ListenLoop(const char* name, FastoObject* out) WARN_UNUSED_RESULT;
 
   bool is_auth_;
   int cur_db_;
+
+  ClusterSlotsMap cluster_slots_;  // empty if server isn't in cluster mode
+  std::string cluster_self_id_;
+  std::map<std::string, NativeConnection*> cluster_nodes_;  // other masters by host:port
+  std::map<uint64_t, cluster_scan_t> cluster_scans_;
+  uint64_t last_cluster_scan_;
 };
 
 }  // namespace redis
@@ -0,0 +1,779 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "core/db/redis/rdb_parser.h"
+
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include <common/convert2string.h>
+#include <common/sprintf.h>
+#include <common/time.h>
+
+#define RDB_6BITLEN 0
+#define RDB_14BITLEN 1
+#define RDB_32BITLEN 0x80
+#define RDB_64BITLEN 0x81
+#define RDB_ENCVAL 3
+
+#define RDB_ENC_INT8 0
+#define RDB_ENC_INT16 1
+#define RDB_ENC_INT32 2
+#define RDB_ENC_LZF 3
+
+#define RDB_TYPE_STRING 0
+#define RDB_TYPE_LIST 1
+#define RDB_TYPE_SET 2
+#define RDB_TYPE_ZSET 3
+#define RDB_TYPE_HASH 4
+#define RDB_TYPE_ZSET_2 5
+#define RDB_TYPE_MODULE_PRE_GA 6
+#define RDB_TYPE_MODULE_2 7
+#define RDB_TYPE_HASH_ZIPMAP 9
+#define RDB_TYPE_LIST_ZIPLIST 10
+#define RDB_TYPE_SET_INTSET 11
+#define RDB_TYPE_ZSET_ZIPLIST 12
+#define RDB_TYPE_HASH_ZIPLIST 13
+#define RDB_TYPE_LIST_QUICKLIST 14
+#define RDB_TYPE_STREAM_LISTPACKS 15
+#define RDB_TYPE_HASH_LISTPACK 16
+#define RDB_TYPE_ZSET_LISTPACK 17
+#define RDB_TYPE_LIST_QUICKLIST_2 18
+#define RDB_TYPE_STREAM_LISTPACKS_2 19
+#define RDB_TYPE_SET_LISTPACK 20
+#define RDB_TYPE_STREAM_LISTPACKS_3 21
+
+#define RDB_OPCODE_SLOT_INFO 244
+#define RDB_OPCODE_FUNCTION2 245
+#define RDB_OPCODE_FUNCTION_PRE_GA 246
+#define RDB_OPCODE_MODULE_AUX 247
+#define RDB_OPCODE_IDLE 248
+#define RDB_OPCODE_FREQ 249
+#define RDB_OPCODE_AUX 250
+#define RDB_OPCODE_RESIZEDB 251
+#define RDB_OPCODE_EXPIRETIME_MS 252
+#define RDB_OPCODE_EXPIRETIME 253
+#define RDB_OPCODE_SELECTDB 254
+#define RDB_OPCODE_EOF 255
+
+#define RDB_QUICKLIST_NODE_PLAIN 1
+
+#define RDB_MAGIC "REDIS"
+#define RDB_MAGIC_SIZE 5
+#define RDB_VERSION_SIZE 4
+#define RDB_CHECKSUM_VERSION 5
+#define RDB_STREAM_ID_SIZE 16
+
+#define OBJ_ENCODING_EMBSTR_SIZE_LIMIT 44
+#define LZF_MAX_RATIO 88  // back reference of 3 bytes expands to 264
+
+namespace {
+
+uint64_t LoadLE(const uint8_t* data, size_t size) {
+  uint64_t result = 0;
+  for (size_t i = 0; i < size; ++i) {
+    result |= static_cast<uint64_t>(data[i]) << (8 * i);
+  }
+  return result;
+}
+
+uint64_t LoadBE(const uint8_t* data, size_t size) {
+  uint64_t result = 0;
+  for (size_t i = 0; i < size; ++i) {
+    result = (result << 8) | data[i];
+  }
+  return result;
+}
+
+// lzf_d.c without optimizations, returns false on corrupted input
+bool LzfDecompress(const uint8_t* in, size_t in_len, uint8_t* out, size_t out_len) {
+  const uint8_t* ip = in;
+  const uint8_t* const in_end = in + in_len;
+  uint8_t* op = out;
+  uint8_t* const out_end = out + out_len;
+  while (ip < in_end) {
+    size_t ctrl = *ip++;
+    if (ctrl < (1 << 5)) { /* literal run */
+      ctrl++;
+      if (op + ctrl > out_end || ip + ctrl > in_end) {
+        return false;
+      }
+      memcpy(op, ip, ctrl);
+      op += ctrl;
+      ip += ctrl;
+      continue;
+    }
+
+    /* back reference */
+    size_t len = ctrl >> 5;
+    const size_t offset = ((ctrl & 0x1f) << 8) + 1;
+    if (len == 7) {
+      if (ip >= in_end) {
+        return false;
+      }
+      len += *ip++;
+    }
+    if (ip >= in_end) {
+      return false;
+    }
+    const size_t full_offset = offset + *ip++;
+    len += 2;
+    if (op + len > out_end || static_cast<size_t>(op - out) < full_offset) {
+      return false;
+    }
+    const uint8_t* ref = op - full_offset;
+    for (size_t i = 0; i < len; ++i) {  // regions can overlap
+      *op++ = *ref++;
+    }
+  }
+
+  return op == out_end;
+}
+
+// count of entries from ziplist, listpack, intset and zipmap headers
+uint64_t ZiplistCount(const std::string& blob) {
+  if (blob.size() < 10) {
+    return 0;
+  }
+  uint64_t count = LoadLE(reinterpret_cast<const uint8_t*>(blob.data()) + 8, 2);
+  return count == UINT16_MAX ? 0 : count;
+}
+
+uint64_t ListpackCount(const std::string& blob) {
+  if (blob.size() < 6) {
+    return 0;
+  }
+  uint64_t count = LoadLE(reinterpret_cast<const uint8_t*>(blob.data()) + 4, 2);
+  return count == UINT16_MAX ? 0 : count;
+}
+
+uint64_t IntsetCount(const std::string& blob) {
+  if (blob.size() < 8) {
+    return 0;
+  }
+  return LoadLE(reinterpret_cast<const uint8_t*>(blob.data()) + 4, 4);
+}
+
+uint64_t ZipmapCount(const std::string& blob) {
+  if (blob.empty()) {
+    return 0;
+  }
+  uint8_t count = static_cast<uint8_t>(blob[0]);
+  return count < 254 ? count : 0;
+}
+
+std::string TotalsLine(const std::string& name, uint64_t keys, uint64_t size) {
+  return common::MemSPrintf("%s: %" PRIu64 " keys, %" PRIu64 " bytes", name, keys, size);
+}
+
+bool LessBySize(const fastonosql::core::redis::RdbKeyInfo& lhs, const fastonosql::core::redis::RdbKeyInfo& rhs) {
+  return lhs.serialized_size > rhs.serialized_size;  // min-heap
+}
+
+}  // namespace
+
+namespace fastonosql {
+namespace core {
+namespace redis {
+
+RdbKeyInfo::RdbKeyInfo() : key(), db(0), type(), encoding(), expire_msec(-1), elements(0), serialized_size(0) {}
+
+RdbParser::RdbParser(read_callback_t reader, key_callback_t key_cb)
+    : reader_(reader), key_cb_(key_cb), buffer_(buffer_size), pos_(0), end_(0), parsed_bytes_(0) {}
+
+uint64_t RdbParser::GetParsedBytes() const {
+  return parsed_bytes_;
+}
+
+common::Error RdbParser::Fill() {
+  pos_ = 0;
+  end_ = 0;
+  size_t nread = 0;
+  common::Error err = reader_(buffer_.data(), buffer_.size(), &nread);
+  if (err) {
+    return err;
+  }
+
+  if (nread == 0) {
+    return common::make_error("Unexpected end of RDB payload");
+  }
+
+  end_ = nread;
+  return common::Error();
+}
+
+common::Error RdbParser::ReadBytes(void* dst, size_t len) {
+  char* out = static_cast<char*>(dst);
+  while (len) {
+    if (pos_ == end_) {
+      common::Error err = Fill();
+      if (err) {
+        return err;
+      }
+    }
+
+    size_t chunk = std::min(len, end_ - pos_);
+    if (out) {
+      memcpy(out, buffer_.data() + pos_, chunk);
+      out += chunk;
+    }
+    pos_ += chunk;
+    len -= chunk;
+    parsed_bytes_ += chunk;
+  }
+
+  return common::Error();
+}
+
+// grows with received data, so corrupt length fails at end of stream instead of allocating it
+common::Error RdbParser::ReadToString(uint64_t len, std::string* out) {
+  if (len > max_string_size) {
+    return common::make_error(common::MemSPrintf("Too large RDB string: %" PRIu64 " bytes", len));
+  }
+
+  out->clear();
+  while (out->size() < len) {
+    const size_t offset = out->size();
+    const size_t chunk = std::min<uint64_t>(len - offset, buffer_size);
+    out->resize(offset + chunk);
+    common::Error err = ReadBytes(&(*out)[offset], chunk);
+    if (err) {
+      return err;
+    }
+  }
+
+  return common::Error();
+}
+
+common::Error RdbParser::ReadByte(uint8_t* byte) {
+  return ReadBytes(byte, 1);
+}
+
+common::Error RdbParser::ReadLength(uint64_t* len, bool* is_encoded) {
+  uint8_t buf[8];
+  common::Error err = ReadByte(&buf[0]);
+  if (err) {
+    return err;
+  }
+
+  *is_encoded = false;
+  const uint8_t type = (buf[0] & 0xC0) >> 6;
+  if (type == RDB_ENCVAL) {
+    *is_encoded = true;
+    *len = buf[0] & 0x3F;
+  } else if (type == RDB_6BITLEN) {
+    *len = buf[0] & 0x3F;
+  } else if (type == RDB_14BITLEN) {
+    uint8_t next = 0;
+    err = ReadByte(&next);
+    if (err) {
+      return err;
+    }
+    *len = (static_cast<uint64_t>(buf[0] & 0x3F) << 8) | next;
+  } else if (buf[0] == RDB_32BITLEN) {
+    err = ReadBytes(buf, 4);
+    if (err) {
+      return err;
+    }
+    *len = LoadBE(buf, 4);
+  } else if (buf[0] == RDB_64BITLEN) {
+    err = ReadBytes(buf, 8);
+    if (err) {
+      return err;
+    }
+    *len = LoadBE(buf, 8);
+  } else {
+    return common::make_error(common::MemSPrintf("Unknown RDB length encoding: %d", buf[0]));
+  }
+
+  return common::Error();
+}
+
+common::Error RdbParser::ReadLength(uint64_t* len) {
+  bool is_encoded = false;
+  common::Error err = ReadLength(len, &is_encoded);
+  if (err) {
+    return err;
+  }
+
+  if (is_encoded) {
+    return common::make_error("Unexpected encoded RDB length");
+  }
+
+  return common::Error();
+}
+
+common::Error RdbParser::ReadString(std::string* out, uint64_t* len, bool* is_int) {
+  uint64_t lsize = 0;
+  bool is_encoded = false;
+  common::Error err = ReadLength(&lsize, &is_encoded);
+  if (err) {
+    return err;
+  }
+
+  bool lis_int = false;
+  if (!is_encoded) {
+    if (out) {
+      err = ReadToString(lsize, out);
+    } else {
+      err = ReadBytes(nullptr, lsize);
+    }
+  } else if (lsize == RDB_ENC_LZF) {
+    uint64_t clen = 0;
+    err = ReadLength(&clen);
+    if (err) {
+      return err;
+    }
+    err = ReadLength(&lsize);
+    if (err) {
+      return err;
+    }
+
+    if (out) {
+      if (lsize > max_string_size || lsize / LZF_MAX_RATIO > clen) {
+        return common::make_error("Invalid LZF compressed RDB string");
+      }
+
+      std::string compressed;
+      err = ReadToString(clen, &compressed);
+      if (err) {
+        return err;
+      }
+      out->resize(lsize);
+      if (!LzfDecompress(reinterpret_cast<const uint8_t*>(compressed.data()), clen,
+                         reinterpret_cast<uint8_t*>(&(*out)[0]), lsize)) {
+        return common::make_error("Invalid LZF compressed RDB string");
+      }
+    } else {
+      err = ReadBytes(nullptr, clen);
+    }
+  } else if (lsize == RDB_ENC_INT8 || lsize == RDB_ENC_INT16 || lsize == RDB_ENC_INT32) {
+    const size_t int_size = lsize == RDB_ENC_INT8 ? 1 : lsize == RDB_ENC_INT16 ? 2 : 4;
+    uint8_t buf[4];
+    err = ReadBytes(buf, int_size);
+    if (err) {
+      return err;
+    }
+
+    const uint64_t uval = LoadLE(buf, int_size);
+    int64_t val = 0;
+    if (int_size == 1) {
+      val = static_cast<int8_t>(uval);
+    } else if (int_size == 2) {
+      val = static_cast<int16_t>(uval);
+    } else {
+      val = static_cast<int32_t>(uval);
+    }
+    const std::string str = common::ConvertToString(val);
+    lsize = str.size();
+    lis_int = true;
+    if (out) {
+      *out = str;
+    }
+  } else {
+    return common::make_error(common::MemSPrintf("Unknown RDB string encoding: %" PRIu64, lsize));
+  }
+
+  if (err) {
+    return err;
+  }
+
+  if (len) {
+    *len = lsize;
+  }
+  if (is_int) {
+    *is_int = lis_int;
+  }
+  return common::Error();
+}
+
+common::Error RdbParser::Parse() {
+  char header[RDB_MAGIC_SIZE + RDB_VERSION_SIZE + 1] = {0};
+  common::Error err = ReadBytes(header, RDB_MAGIC_SIZE + RDB_VERSION_SIZE);
+  if (err) {
+    return err;
+  }
+
+  if (memcmp(header, RDB_MAGIC, RDB_MAGIC_SIZE) != 0) {
+    return common::make_error("Wrong signature of RDB payload");
+  }
+  const int version = atoi(header + RDB_MAGIC_SIZE);
+
+  uint64_t db = 0;
+  int64_t expire_msec = -1;
+  while (true) {
+    uint8_t type = 0;
+    err = ReadByte(&type);
+    if (err) {
+      return err;
+    }
+
+    if (type == RDB_OPCODE_EOF) {
+      break;
+    }
+
+    uint8_t buf[8];
+    uint64_t len = 0;
+    switch (type) {
+      case RDB_OPCODE_EXPIRETIME:
+        err = ReadBytes(buf, 4);
+        expire_msec = static_cast<int64_t>(LoadLE(buf, 4)) * 1000;
+        break;
+      case RDB_OPCODE_EXPIRETIME_MS:
+        err = ReadBytes(buf, 8);
+        expire_msec = static_cast<int64_t>(LoadLE(buf, 8));
+        break;
+      case RDB_OPCODE_SELECTDB:
+        err = ReadLength(&db);
+        break;
+      case RDB_OPCODE_RESIZEDB:
+        err = ReadLength(&len);
+        if (!err) {
+          err = ReadLength(&len);
+        }
+        break;
+      case RDB_OPCODE_SLOT_INFO:
+        for (int i = 0; i < 3 && !err; ++i) {
+          err = ReadLength(&len);
+        }
+        break;
+      case RDB_OPCODE_AUX:
+        err = ReadString(nullptr);
+        if (!err) {
+          err = ReadString(nullptr);
+        }
+        break;
+      case RDB_OPCODE_IDLE:
+        err = ReadLength(&len);
+        break;
+      case RDB_OPCODE_FREQ:
+        err = ReadByte(buf);
+        break;
+      case RDB_OPCODE_FUNCTION2:
+        err = ReadString(nullptr);
+        break;
+      case RDB_OPCODE_MODULE_AUX:
+      case RDB_OPCODE_FUNCTION_PRE_GA:
+        return common::make_error(common::MemSPrintf("Unsupported RDB opcode: %d", type));
+      default: {
+        RdbKeyInfo info;
+        info.db = db;
+        info.expire_msec = expire_msec;
+        const uint64_t start = parsed_bytes_ - 1;
+        err = ReadString(&info.key);
+        if (err) {
+          return err;
+        }
+        err = ReadValue(type, &info);
+        if (err) {
+          return err;
+        }
+        info.serialized_size = parsed_bytes_ - start;
+        expire_msec = -1;
+        if (key_cb_) {
+          key_cb_(info);
+        }
+        break;
+      }
+    }
+
+    if (err) {
+      return err;
+    }
+  }
+
+  if (version >= RDB_CHECKSUM_VERSION) {
+    return ReadBytes(nullptr, 8);
+  }
+  return common::Error();
+}
+
+common::Error RdbParser::ReadValue(uint8_t type, RdbKeyInfo* info) {
+  uint64_t len = 0;
+  common::Error err;
+  std::string blob;
+  switch (type) {
+    case RDB_TYPE_STRING: {
+      bool is_int = false;
+      err = ReadString(nullptr, &info->elements, &is_int);
+      info->type = "string";
+      info->encoding = is_int ? "int" : info->elements <= OBJ_ENCODING_EMBSTR_SIZE_LIMIT ? "embstr" : "raw";
+      return err;
+    }
+    case RDB_TYPE_LIST:
+    case RDB_TYPE_SET:
+    case RDB_TYPE_HASH:
+      info->type = type == RDB_TYPE_LIST ? "list" : type == RDB_TYPE_SET ? "set" : "hash";
+      info->encoding = type == RDB_TYPE_LIST ? "linkedlist" : "hashtable";
+      err = ReadLength(&len);
+      info->elements = len;
+      if (type == RDB_TYPE_HASH) {
+        len *= 2;
+      }
+      for (uint64_t i = 0; i < len && !err; ++i) {
+        err = ReadString(nullptr);
+      }
+      return err;
+    case RDB_TYPE_ZSET:
+    case RDB_TYPE_ZSET_2:
+      info->type = "zset";
+      info->encoding = "skiplist";
+      err = ReadLength(&len);
+      info->elements = len;
+      for (uint64_t i = 0; i < len && !err; ++i) {
+        err = ReadString(nullptr);
+        if (err) {
+          return err;
+        }
+        if (type == RDB_TYPE_ZSET_2) {
+          err = ReadBytes(nullptr, 8);
+        } else {
+          uint8_t dlen = 0;
+          err = ReadByte(&dlen);
+          if (!err && dlen < 253) {  // 253, 254, 255: nan, +inf, -inf
+            err = ReadBytes(nullptr, dlen);
+          }
+        }
+      }
+      return err;
+    case RDB_TYPE_HASH_ZIPMAP:
+      info->type = "hash";
+      info->encoding = "zipmap";
+      err = ReadString(&blob);
+      info->elements = ZipmapCount(blob);
+      return err;
+    case RDB_TYPE_LIST_ZIPLIST:
+    case RDB_TYPE_ZSET_ZIPLIST:
+    case RDB_TYPE_HASH_ZIPLIST:
+      info->type = type == RDB_TYPE_LIST_ZIPLIST ? "list" : type == RDB_TYPE_ZSET_ZIPLIST ? "zset" : "hash";
+      info->encoding = "ziplist";
+      err = ReadString(&blob);
+      info->elements = type == RDB_TYPE_LIST_ZIPLIST ? ZiplistCount(blob) : ZiplistCount(blob) / 2;
+      return err;
+    case RDB_TYPE_SET_INTSET:
+      info->type = "set";
+      info->encoding = "intset";
+      err = ReadString(&blob);
+      info->elements = IntsetCount(blob);
+      return err;
+    case RDB_TYPE_HASH_LISTPACK:
+    case RDB_TYPE_ZSET_LISTPACK:
+    case RDB_TYPE_SET_LISTPACK:
+      info->type = type == RDB_TYPE_HASH_LISTPACK ? "hash" : type == RDB_TYPE_ZSET_LISTPACK ? "zset" : "set";
+      info->encoding = "listpack";
+      err = ReadString(&blob);
+      info->elements = type == RDB_TYPE_SET_LISTPACK ? ListpackCount(blob) : ListpackCount(blob) / 2;
+      return err;
+    case RDB_TYPE_LIST_QUICKLIST:
+    case RDB_TYPE_LIST_QUICKLIST_2:
+      info->type = "list";
+      info->encoding = "quicklist";
+      err = ReadLength(&len);
+      for (uint64_t i = 0; i < len && !err; ++i) {
+        uint64_t container = 0;
+        if (type == RDB_TYPE_LIST_QUICKLIST_2) {
+          err = ReadLength(&container);
+          if (err) {
+            return err;
+          }
+        }
+
+        if (container == RDB_QUICKLIST_NODE_PLAIN) {  // single large element
+          err = ReadString(nullptr);
+          info->elements++;
+        } else {
+          err = ReadString(&blob);
+          info->elements += type == RDB_TYPE_LIST_QUICKLIST ? ZiplistCount(blob) : ListpackCount(blob);
+        }
+      }
+      return err;
+    case RDB_TYPE_STREAM_LISTPACKS:
+    case RDB_TYPE_STREAM_LISTPACKS_2:
+    case RDB_TYPE_STREAM_LISTPACKS_3:
+      return ReadStream(type, info);
+    default:
+      return common::make_error(common::MemSPrintf("Unsupported RDB object type: %d", type));
+  }
+}
+
+common::Error RdbParser::ReadStream(uint8_t type, RdbKeyInfo* info) {
+  info->type = "stream";
+  info->encoding = "stream";
+
+  uint64_t listpacks = 0;
+  common::Error err = ReadLength(&listpacks);
+  for (uint64_t i = 0; i < listpacks && !err; ++i) {
+    err = ReadString(nullptr);  // master id
+    if (!err) {
+      err = ReadString(nullptr);  // listpack
+    }
+  }
+  if (err) {
+    return err;
+  }
+
+  err = ReadLength(&info->elements);
+  uint64_t len = 0;
+  const size_t ids_count = type == RDB_TYPE_STREAM_LISTPACKS ? 2 : 7;  // last id, first id, max deleted, added
+  for (size_t i = 0; i < ids_count && !err; ++i) {
+    err = ReadLength(&len);
+  }
+  if (err) {
+    return err;
+  }
+
+  uint64_t cgroups = 0;
+  err = ReadLength(&cgroups);
+  for (uint64_t i = 0; i < cgroups && !err; ++i) {
+    err = ReadString(nullptr);
+    const size_t group_ids_count = type == RDB_TYPE_STREAM_LISTPACKS ? 2 : 3;  // last id, entries read
+    for (size_t j = 0; j < group_ids_count && !err; ++j) {
+      err = ReadLength(&len);
+    }
+    if (err) {
+      return err;
+    }
+
+    uint64_t pel = 0;
+    err = ReadLength(&pel);
+    for (uint64_t j = 0; j < pel && !err; ++j) {
+      err = ReadBytes(nullptr, RDB_STREAM_ID_SIZE + 8);  // id, delivery time
+      if (!err) {
+        err = ReadLength(&len);  // delivery count
+      }
+    }
+    if (err) {
+      return err;
+    }
+
+    uint64_t consumers = 0;
+    err = ReadLength(&consumers);
+    for (uint64_t j = 0; j < consumers && !err; ++j) {
+      err = ReadString(nullptr);
+      if (!err) {
+        err = ReadBytes(nullptr, type == RDB_TYPE_STREAM_LISTPACKS_3 ? 16 : 8);  // seen time, active time
+      }
+      uint64_t consumer_pel = 0;
+      if (!err) {
+        err = ReadLength(&consumer_pel);
+      }
+      if (!err) {
+        err = ReadBytes(nullptr, consumer_pel * RDB_STREAM_ID_SIZE);
+      }
+    }
+  }
+
+  return err;
+}
+
+RdbMemoryReport::Totals::Totals() : keys(0), size(0) {}
+
+RdbMemoryReport::RdbMemoryReport(const std::string& ns_separator, size_t top_count)
+    : ns_separator_(ns_separator),
+      top_count_(top_count),
+      total_(),
+      types_(),
+      prefixes_(),
+      other_prefixes_(),
+      largest_() {}
+
+void RdbMemoryReport::AddKey(const RdbKeyInfo& info) {
+  total_.keys++;
+  total_.size += info.serialized_size;
+
+  Totals& type = types_[info.type];
+  type.keys++;
+  type.size += info.serialized_size;
+
+  const size_t pos = ns_separator_.empty() ? std::string::npos : info.key.find(ns_separator_);
+  if (pos != std::string::npos) {
+    const std::string prefix = info.key.substr(0, pos);
+    auto it = prefixes_.find(prefix);
+    if (it == prefixes_.end() && prefixes_.size() >= max_prefixes) {
+      other_prefixes_.keys++;
+      other_prefixes_.size += info.serialized_size;
+    } else {
+      Totals& pref = prefixes_[prefix];
+      pref.keys++;
+      pref.size += info.serialized_size;
+    }
+  }
+
+  if (top_count_ == 0) {
+    return;
+  }
+
+  if (largest_.size() < top_count_) {
+    largest_.push_back(info);
+    std::push_heap(largest_.begin(), largest_.end(), &LessBySize);
+  } else if (largest_.front().serialized_size < info.serialized_size) {
+    std::pop_heap(largest_.begin(), largest_.end(), &LessBySize);
+    largest_.back() = info;
+    std::push_heap(largest_.begin(), largest_.end(), &LessBySize);
+  }
+}
+
+uint64_t RdbMemoryReport::GetKeysCount() const {
+  return total_.keys;
+}
+
+uint64_t RdbMemoryReport::GetTotalSize() const {
+  return total_.size;
+}
+
+common::ArrayValue* RdbMemoryReport::MakeValue() const {
+  common::ArrayValue* report = common::Value::CreateArrayValue();
+  report->AppendString(TotalsLine("Total", total_.keys, total_.size));
+  for (auto it = types_.begin(); it != types_.end(); ++it) {
+    report->AppendString(TotalsLine("Type " + it->first, it->second.keys, it->second.size));
+  }
+
+  std::vector<RdbKeyInfo> largest = largest_;
+  std::sort_heap(largest.begin(), largest.end(), &LessBySize);
+  const common::time64_t now = common::time::current_mstime();
+  for (size_t i = 0; i < largest.size(); ++i) {
+    const RdbKeyInfo& info = largest[i];
+    const int64_t ttl = info.expire_msec == -1 ? -1 : std::max<int64_t>(0, (info.expire_msec - now) / 1000);
+    report->AppendString(common::MemSPrintf("Biggest key db%" PRIu64 " '%s': %s (%s), %" PRIu64 " elements, %" PRIu64
+                                            " bytes, ttl %" PRId64,
+                                            info.db, info.key, info.type, info.encoding, info.elements,
+                                            info.serialized_size, ttl));
+  }
+
+  std::vector<std::pair<std::string, Totals>> prefixes(prefixes_.begin(), prefixes_.end());
+  std::sort(prefixes.begin(), prefixes.end(),
+            [](const std::pair<std::string, Totals>& lhs, const std::pair<std::string, Totals>& rhs) {
+              return lhs.second.size > rhs.second.size;
+            });
+  for (size_t i = 0; i < prefixes.size() && i < top_count_; ++i) {
+    report->AppendString(
+        TotalsLine("Prefix " + prefixes[i].first + ns_separator_, prefixes[i].second.keys, prefixes[i].second.size));
+  }
+  if (other_prefixes_.keys) {
+    report->AppendString(TotalsLine("Other prefixes", other_prefixes_.keys, other_prefixes_.size));
+  }
+
+  return report;
+}
+
+}  // namespace redis
+}  // namespace core
+}  // namespace fastonosql
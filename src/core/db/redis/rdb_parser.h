@@ -0,0 +1,109 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <common/error.h>  // for Error
+#include <common/value.h>
+
+namespace fastonosql {
+namespace core {
+namespace redis {
+
+struct RdbKeyInfo {
+  RdbKeyInfo();
+
+  std::string key;
+  uint64_t db;
+  std::string type;      // as TYPE command
+  std::string encoding;  // as OBJECT ENCODING command
+  int64_t expire_msec;   // absolute unix time, -1 if key is persistent
+  uint64_t elements;     // string length for strings
+  uint64_t serialized_size;
+};
+
+// incremental parser of RDB stream, values are skipped without materialization,
+// so memory usage doesn't depend on payload size
+class RdbParser {
+ public:
+  typedef std::function<common::Error(char* buf, size_t size, size_t* nread)> read_callback_t;
+  typedef std::function<void(const RdbKeyInfo& info)> key_callback_t;
+  enum { buffer_size = 64 * 1024 };  // large reads keep ssh tunneled SYNC fast
+  enum { max_string_size = 512 * 1024 * 1024 };  // proto-max-bulk-len, longer strings mean corrupt stream
+
+  RdbParser(read_callback_t reader, key_callback_t key_cb);
+
+  common::Error Parse() WARN_UNUSED_RESULT;  // till EOF opcode and checksum
+  uint64_t GetParsedBytes() const;
+
+ private:
+  common::Error Fill() WARN_UNUSED_RESULT;
+  common::Error ReadBytes(void* dst, size_t len) WARN_UNUSED_RESULT;  // dst may be null to skip
+  common::Error ReadToString(uint64_t len, std::string* out) WARN_UNUSED_RESULT;
+  common::Error ReadByte(uint8_t* byte) WARN_UNUSED_RESULT;
+  common::Error ReadLength(uint64_t* len, bool* is_encoded) WARN_UNUSED_RESULT;
+  common::Error ReadLength(uint64_t* len) WARN_UNUSED_RESULT;
+  common::Error ReadString(std::string* out, uint64_t* len = nullptr, bool* is_int = nullptr) WARN_UNUSED_RESULT;
+  common::Error ReadValue(uint8_t type, RdbKeyInfo* info) WARN_UNUSED_RESULT;
+  common::Error ReadStream(uint8_t type, RdbKeyInfo* info) WARN_UNUSED_RESULT;
+
+  const read_callback_t reader_;
+  const key_callback_t key_cb_;
+  std::vector<char> buffer_;
+  size_t pos_;
+  size_t end_;
+  uint64_t parsed_bytes_;
+};
+
+// aggregates parsed keys: totals per type, largest keys and totals per namespace prefix
+class RdbMemoryReport {
+ public:
+  enum { default_top_count = 20, max_prefixes = 1000 };
+
+  explicit RdbMemoryReport(const std::string& ns_separator = ":", size_t top_count = default_top_count);
+
+  void AddKey(const RdbKeyInfo& info);
+  uint64_t GetKeysCount() const;
+  uint64_t GetTotalSize() const;
+
+  common::ArrayValue* MakeValue() const;  // caller take ownership
+
+ private:
+  struct Totals {
+    Totals();
+    uint64_t keys;
+    uint64_t size;
+  };
+
+  const std::string ns_separator_;
+  const size_t top_count_;
+  Totals total_;
+  std::map<std::string, Totals> types_;
+  std::map<std::string, Totals> prefixes_;
+  Totals other_prefixes_;
+  std::vector<RdbKeyInfo> largest_;  // min-heap by serialized_size
+};
+
+}  // namespace redis
+}  // namespace core
+}  // namespace fastonosql
@@ -0,0 +1,191 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "core/db/redis/reply_object.h"
+
+#include <hiredis/hiredis.h>
+
+#include <common/convert2string.h>
+
+#include "core/value.h"  // for IValueSink
+
+namespace fastonosql {
+namespace core {
+namespace redis {
+namespace {
+
+void WriteData(const char* data, size_t size, const std::string* prefix, IValueSink* sink) {
+  if (prefix) {
+    sink->Write(prefix->data(), prefix->size());
+  }
+  sink->Write(data, size);
+}
+
+// same output as ConvertValue(value, delimiter, false), prefix is written before first data
+bool WriteReply(const redisReply* r, const std::string& delimiter, const std::string* prefix, IValueSink* sink) {
+  switch (r->type) {
+    case REDIS_REPLY_STATUS:
+    case REDIS_REPLY_STRING: {
+      if (r->len == 0) {
+        return false;
+      }
+      WriteData(r->str, r->len, prefix, sink);
+      return true;
+    }
+    case REDIS_REPLY_INTEGER: {
+      const std::string str = common::ConvertToString(static_cast<long long>(r->integer));
+      WriteData(str.data(), str.size(), prefix, sink);
+      return true;
+    }
+    case REDIS_REPLY_ARRAY: {
+      bool written = false;
+      for (size_t i = 0; i < r->elements; ++i) {
+        if (WriteReply(r->element[i], delimiter, written ? &delimiter : prefix, sink)) {
+          written = true;
+        }
+      }
+      return written;
+    }
+    default:
+      return false;
+  }
+}
+
+// converts and frees reply, array elements are freed one by one,
+// so reply and value copies of the same element don't coexist
+common::Value* TakeReplyValue(redisReply* r) {
+  common::Value* result = nullptr;
+  switch (r->type) {
+    case REDIS_REPLY_STATUS:
+    case REDIS_REPLY_STRING: {
+      result = common::Value::CreateStringValue(std::string(r->str, r->len));
+      break;
+    }
+    case REDIS_REPLY_INTEGER: {
+      result = common::Value::CreateLongLongIntegerValue(r->integer);
+      break;
+    }
+    case REDIS_REPLY_ARRAY: {
+      common::ArrayValue* arv = common::Value::CreateArrayValue();
+      for (size_t i = 0; i < r->elements; ++i) {
+        arv->Append(TakeReplyValue(r->element[i]));
+        r->element[i] = NULL;
+      }
+      result = arv;
+      break;
+    }
+    default: {
+      result = common::Value::CreateNullValue();
+      break;
+    }
+  }
+
+  freeReplyObject(r);
+  return result;
+}
+
+}  // namespace
+
+ReplyObject::ReplyObject(FastoObject* parent, redisReply* reply, const std::string& delimiter)
+    : FastoObject(parent, delimiter), lock_(), reply_(reply), materialized_() {
+  DCHECK(reply_);
+}
+
+ReplyObject::~ReplyObject() {
+  if (reply_) {
+    freeReplyObject(reply_);
+    reply_ = NULL;
+  }
+}
+
+common::Value::Type ReplyObject::GetType() const {
+  std::lock_guard<std::mutex> lock(lock_);
+  if (value_) {
+    return value_->GetType();
+  }
+
+  if (materialized_) {
+    return materialized_->GetType();
+  }
+
+  switch (reply_->type) {
+    case REDIS_REPLY_STATUS:
+    case REDIS_REPLY_STRING:
+      return common::Value::TYPE_STRING;
+    case REDIS_REPLY_INTEGER:
+      return common::Value::TYPE_LONG_LONG_INTEGER;
+    case REDIS_REPLY_ARRAY:
+      return common::Value::TYPE_ARRAY;
+    default:
+      return common::Value::TYPE_NULL;
+  }
+}
+
+std::string ReplyObject::ToString() const {
+  std::lock_guard<std::mutex> lock(lock_);
+  if (value_) {
+    return ConvertValue(value_.get(), GetDelimiter(), false);
+  }
+
+  if (materialized_) {
+    return ConvertValue(materialized_.get(), GetDelimiter(), false);
+  }
+
+  std::string result;
+  StringValueSink sink(&result);
+  WriteReply(reply_, GetDelimiter(), nullptr, &sink);
+  return result;
+}
+
+FastoObject::value_t ReplyObject::GetValue() const {
+  std::lock_guard<std::mutex> lock(lock_);
+  if (value_) {
+    return value_;
+  }
+
+  if (!materialized_) {
+    materialized_ = value_t(TakeReplyValue(reply_));
+    reply_ = NULL;
+  }
+  return materialized_;
+}
+
+const redisReply* FindErrorReply(const redisReply* reply) {
+  if (!reply) {
+    return nullptr;
+  }
+
+  if (reply->type == REDIS_REPLY_ERROR) {
+    return reply;
+  }
+
+  if (reply->type == REDIS_REPLY_ARRAY) {
+    for (size_t i = 0; i < reply->elements; ++i) {
+      const redisReply* err = FindErrorReply(reply->element[i]);
+      if (err) {
+        return err;
+      }
+    }
+  }
+
+  return nullptr;
+}
+
+}  // namespace redis
+}  // namespace core
+}  // namespace fastonosql
@@ -0,0 +1,57 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <mutex>
+#include <string>
+
+#include "core/global.h"  // for FastoObject
+
+struct redisReply;
+
+namespace fastonosql {
+namespace core {
+namespace redis {
+
+// result of command which keeps hiredis reply instead of copying it into common::Value:
+// type and text output are read straight from reply buffers, value is built only when requested,
+// reply elements are released as soon as they are converted
+class ReplyObject : public FastoObject {
+ public:
+  ReplyObject(FastoObject* parent, redisReply* reply, const std::string& delimiter);  // reply take ownership
+  virtual ~ReplyObject();
+
+  virtual common::Value::Type GetType() const override;
+  virtual std::string ToString() const override;
+  virtual value_t GetValue() const override;
+
+ private:
+  DISALLOW_COPY_AND_ASSIGN(ReplyObject);
+
+  mutable std::mutex lock_;  // value may be requested from gui thread while driver formats output
+  mutable redisReply* reply_;
+  mutable value_t materialized_;
+};
+
+// first error reply in reply tree, nullptr if there is no one
+const redisReply* FindErrorReply(const redisReply* reply);
+
+}  // namespace redis
+}  // namespace core
+}  // namespace fastonosql
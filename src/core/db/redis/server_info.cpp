@@ -18,6 +18,12 @@
 
 #include "core/db/redis/server_info.h"
 
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <limits>
+
 #include <common/convert2string.h>
 
 #include "core/db_traits.h"
@@ -131,6 +137,135 @@ std::vector<info_field_t> DBTraits<REDIS>::GetInfoFields() {
 }
 
 namespace redis {
+namespace {
+
+// integers are parsed in place, out isn't changed if value isn't a number or doesn't fit
+template <typename T>
+void ParseNumber(const char* value, size_t size, T* out) {
+  size_t i = 0;
+  const bool negative = size && value[0] == '-';
+  if (negative) {
+    if (!std::numeric_limits<T>::is_signed) {
+      return;
+    }
+    i++;
+  }
+
+  if (i == size) {
+    return;
+  }
+
+  int64_t result = 0;
+  for (; i < size; ++i) {
+    const char ch = value[i];
+    if (ch < '0' || ch > '9') {
+      return;
+    }
+    result = result * 10 + (ch - '0');
+    if (result > static_cast<int64_t>(std::numeric_limits<T>::max()) + negative) {
+      return;
+    }
+  }
+
+  *out = static_cast<T>(negative ? -result : result);
+}
+
+void ParseNumber(const char* value, size_t size, float* out) {
+  char* end = nullptr;
+  const float result = strtof(value, &end);  // line is followed by "\r\n" or end of string
+  if (size && end == value + size) {
+    *out = result;
+  }
+}
+
+// maps field labels to property and field indexes of ServerInfo,
+// built once from info fields and sorted by length, then bytes, so lookup doesn't allocate
+class InfoFieldsTable {
+ public:
+  struct Entry {
+    const char* label;
+    size_t size;
+    unsigned char property;
+    unsigned char field;
+  };
+
+  InfoFieldsTable() : fields_(DBTraits<REDIS>::GetInfoFields()), entries_() {
+    for (size_t i = 0; i < fields_.size(); ++i) {
+      const std::vector<Field>& property = fields_[i].second;
+      for (size_t j = 0; j < property.size(); ++j) {
+        Entry entry = {property[j].name.c_str(), property[j].name.size(), static_cast<unsigned char>(i),
+                       static_cast<unsigned char>(j)};
+        entries_.push_back(entry);
+      }
+    }
+    std::sort(entries_.begin(), entries_.end(), &InfoFieldsTable::Less);
+  }
+
+  const Entry* Find(const char* label, size_t size) const {
+    const Entry key = {label, size, 0, 0};
+    auto it = std::lower_bound(entries_.begin(), entries_.end(), key, &InfoFieldsTable::Less);
+    if (it == entries_.end() || it->size != size || memcmp(it->label, label, size) != 0) {
+      return nullptr;
+    }
+    return &(*it);
+  }
+
+ private:
+  static bool Less(const Entry& lhs, const Entry& rhs) {
+    if (lhs.size != rhs.size) {
+      return lhs.size < rhs.size;
+    }
+    return memcmp(lhs.label, rhs.label, lhs.size) < 0;
+  }
+
+  const std::vector<info_field_t> fields_;  // owns labels
+  std::vector<Entry> entries_;
+};
+
+const InfoFieldsTable& GetInfoFieldsTable() {
+  static const InfoFieldsTable table;
+  return table;
+}
+
+// calls func(label, label_size, value, value_size) for every "label:value" line,
+// section headers and empty lines are skipped
+template <typename F>
+void ForEachInfoLine(const std::string& text, F func) {
+  const char* line = text.data();
+  const char* const end = line + text.size();
+  while (line < end) {
+    const char* eol = static_cast<const char*>(memchr(line, '\n', end - line));
+    const char* next = eol ? eol + 1 : end;
+    if (!eol) {
+      eol = end;
+    }
+    if (eol != line && *(eol - 1) == '\r') {
+      eol--;
+    }
+
+    if (eol != line && *line != '#') {
+      const char* delem = static_cast<const char*>(memchr(line, ':', eol - line));
+      if (delem) {
+        func(line, delem - line, delem + 1, eol - delem - 1);
+      }
+    }
+    line = next;
+  }
+}
+
+template <typename T>
+void ParseInfoSection(const std::string& text, unsigned char property, T* section) {
+  const InfoFieldsTable& table = GetInfoFieldsTable();
+  ForEachInfoLine(text, [&table, property, section](const char* label, size_t label_size, const char* value,
+                                                    size_t value_size) {
+    const InfoFieldsTable::Entry* entry = table.Find(label, label_size);
+    if (entry && entry->property == property) {
+      section->SetValueByIndex(entry->field, value, value_size);
+    }
+  });
+}
+
+}  // namespace
 
 ServerInfo::Server::Server::Server()
     : redis_version_(),
@@ -165,67 +300,7 @@ ServerInfo::Server::Server(const std::string& server_text)
       uptime_in_days_(0),
       hz_(0),
       lru_clock_(0) {
-  size_t pos = 0;
-  size_t start = 0;
-  while ((pos = server_text.find("\r\n", start)) != std::string::npos) {
-    std::string line = server_text.substr(start, pos - start);
-    size_t delem = line.find_first_of(':');
-    std::string field = line.substr(0, delem);
-    std::string value = line.substr(delem + 1);
-    if (field == REDIS_VERSION_LABEL) {
-      redis_version_ = value;
-    } else if (field == REDIS_GIT_SHA1_LABEL) {
-      redis_git_sha1_ = value;
-    } else if (field == REDIS_GIT_DIRTY_LABEL) {
-      redis_git_dirty_ = value;
-    } else if (field == REDIS_MODE_LABEL) {
-      redis_mode_ = value;
-    } else if (field == REDIS_OS_LABEL) {
-      os_ = value;
-    } else if (field == REDIS_ARCH_BITS_LABEL) {
-      uint32_t arch_bits;
-      if (common::ConvertFromString(value, &arch_bits)) {
-        arch_bits_ = arch_bits;
-      }
-    } else if (field == REDIS_MULTIPLEXING_API_LABEL) {
-      multiplexing_api_ = value;
-    } else if (field == REDIS_GCC_VERSION_LABEL) {
-      gcc_version_ = value;
-    } else if (field == REDIS_PROCESS_ID_LABEL) {
-      uint32_t process_id;
-      if (common::ConvertFromString(value, &process_id)) {
-        process_id_ = process_id;
-      }
-    } else if (field == REDIS_RUN_ID_LABEL) {
-      run_id_ = value;
-    } else if (field == REDIS_TCP_PORT_LABEL) {
-      uint32_t tcp_port;
-      if (common::ConvertFromString(value, &tcp_port)) {
-        tcp_port_ = tcp_port;
-      }
-    } else if (field == REDIS_UPTIME_IN_SECONDS_LABEL) {
-      uint32_t uptime_in_seconds;
-      if (common::ConvertFromString(value, &uptime_in_seconds)) {
-        uptime_in_seconds_ = uptime_in_seconds;
-      }
-    } else if (field == REDIS_UPTIME_IN_DAYS_LABEL) {
-      uint32_t uptime_in_days;
-      if (common::ConvertFromString(value, &uptime_in_days)) {
-        uptime_in_days_ = uptime_in_days;
-      }
-    } else if (field == REDIS_HZ_LABEL) {
-      uint32_t hz;
-      if (common::ConvertFromString(value, &hz)) {
-        hz_ = hz;
-      }
-    } else if (field == REDIS_LRU_CLOCK_LABEL) {
-      uint32_t lru_clock;
-      if (common::ConvertFromString(value, &lru_clock)) {
-        lru_clock_ = lru_clock;
-      }
-    }
-    start = pos + 2;
-  }
+  ParseInfoSection(server_text, 0, this);
 }
 
 common::Value* ServerInfo::Server::GetValueByIndex(unsigned char index) const {
@@ -270,41 +345,67 @@ common::Value* ServerInfo::Server::GetValueByIndex(unsigned char index) const {
   return nullptr;
 }
 
+void ServerInfo::Server::SetValueByIndex(unsigned char index, const char* value, size_t size) {
+  switch (index) {
+    case 0:
+      redis_version_.assign(value, size);
+      break;
+    case 1:
+      redis_git_sha1_.assign(value, size);
+      break;
+    case 2:
+      redis_git_dirty_.assign(value, size);
+      break;
+    case 3:
+      redis_build_id_.assign(value, size);
+      break;
+    case 4:
+      redis_mode_.assign(value, size);
+      break;
+    case 5:
+      os_.assign(value, size);
+      break;
+    case 6:
+      ParseNumber(value, size, &arch_bits_);
+      break;
+    case 7:
+      multiplexing_api_.assign(value, size);
+      break;
+    case 8:
+      gcc_version_.assign(value, size);
+      break;
+    case 9:
+      ParseNumber(value, size, &process_id_);
+      break;
+    case 10:
+      run_id_.assign(value, size);
+      break;
+    case 11:
+      ParseNumber(value, size, &tcp_port_);
+      break;
+    case 12:
+      ParseNumber(value, size, &uptime_in_seconds_);
+      break;
+    case 13:
+      ParseNumber(value, size, &uptime_in_days_);
+      break;
+    case 14:
+      ParseNumber(value, size, &hz_);
+      break;
+    case 15:
+      ParseNumber(value, size, &lru_clock_);
+      break;
+    default:
+      break;
+  }
+}
+
 ServerInfo::Clients::Clients()
     : connected_clients_(0), client_longest_output_list_(0), client_biggest_input_buf_(0), blocked_clients_(0) {}
 
 ServerInfo::Clients::Clients(const std::string& client_text)
     : connected_clients_(0), client_longest_output_list_(0), client_biggest_input_buf_(0), blocked_clients_(0) {
-  size_t pos = 0;
-  size_t start = 0;
-  while ((pos = client_text.find(("\r\n"), start)) != std::string::npos) {
-    std::string line = client_text.substr(start, pos - start);
-    size_t delem = line.find_first_of(':');
-    std::string field = line.substr(0, delem);
-    std::string value = line.substr(delem + 1);
-    if (field == REDIS_CONNECTED_CLIENTS_LABEL) {
-      uint32_t connected_clients;
-      if (common::ConvertFromString(value, &connected_clients)) {
-        connected_clients_ = connected_clients;
-      }
-    } else if (field == REDIS_CLIENT_LONGEST_OUTPUT_LIST_LABEL) {
-      uint32_t client_longest_output_list;
-      if (common::ConvertFromString(value, &client_longest_output_list)) {
-        client_longest_output_list_ = client_longest_output_list;
-      }
-    } else if (field == REDIS_CLIENT_BIGGEST_INPUT_BUF_LABEL) {
-      uint32_t client_biggest_input_buf;
-      if (common::ConvertFromString(value, &client_biggest_input_buf)) {
-        client_biggest_input_buf_ = client_biggest_input_buf;
-      }
-    } else if (field == REDIS_BLOCKED_CLIENTS_LABEL) {
-      uint32_t blocked_clients;
-      if (common::ConvertFromString(value, &blocked_clients)) {
-        blocked_clients_ = blocked_clients;
-      }
-    }
-    start = pos + 2;
-  }
+  ParseInfoSection(client_text, 1, this);
 }
 
 common::Value* ServerInfo::Clients::GetValueByIndex(unsigned char index) const {
@@ -325,6 +426,25 @@ common::Value* ServerInfo::Clients::GetValueByIndex(unsigned char index) const {
   return nullptr;
 }
 
+void ServerInfo::Clients::SetValueByIndex(unsigned char index, const char* value, size_t size) {
+  switch (index) {
+    case 0:
+      ParseNumber(value, size, &connected_clients_);
+      break;
+    case 1:
+      ParseNumber(value, size, &client_longest_output_list_);
+      break;
+    case 2:
+      ParseNumber(value, size, &client_biggest_input_buf_);
+      break;
+    case 3:
+      ParseNumber(value, size, &blocked_clients_);
+      break;
+    default:
+      break;
+  }
+}
+
 ServerInfo::Memory::Memory()
     : used_memory_(0),
       used_memory_human_(),
@@ -344,47 +464,7 @@ ServerInfo::Memory::Memory(const std::string& memory_text)
       used_memory_lua_(0),
       mem_fragmentation_ratio_(0),
       mem_allocator_() {
-  size_t pos = 0;
-  size_t start = 0;
-  while ((pos = memory_text.find(("\r\n"), start)) != std::string::npos) {
-    std::string line = memory_text.substr(start, pos - start);
-    size_t delem = line.find_first_of(':');
-    std::string field = line.substr(0, delem);
-    std::string value = line.substr(delem + 1);
-    if (field == REDIS_USED_MEMORY_LABEL) {
-      uint32_t used_memory;
-      if (common::ConvertFromString(value, &used_memory)) {
-        used_memory_ = used_memory;
-      }
-    } else if (field == REDIS_USED_MEMORY_HUMAN_LABEL) {
-      used_memory_human_ = value;
-    } else if (field == REDIS_USED_MEMORY_RSS_LABEL) {
-      uint32_t used_memory_rss;
-      if (common::ConvertFromString(value, &used_memory_rss)) {
-        used_memory_rss_ = used_memory_rss;
-      }
-    } else if (field == REDIS_USED_MEMORY_PEAK_LABEL) {
-      uint32_t used_memory_peak;
-      if (common::ConvertFromString(value, &used_memory_peak)) {
-        used_memory_peak_ = used_memory_peak;
-      }
-    } else if (field == REDIS_USED_MEMORY_PEAK_HUMAN_LABEL) {
-      used_memory_peak_human_ = value;
-    } else if (field == REDIS_USED_MEMORY_LUA_LABEL) {
-      uint32_t used_memory_lua;
-      if (common::ConvertFromString(value, &used_memory_lua)) {
-        used_memory_lua_ = used_memory_lua;
-      }
-    } else if (field == REDIS_MEM_FRAGMENTATION_RATIO_LABEL) {
-      float mem_fragmentation_ratio;
-      if (common::ConvertFromString(value, &mem_fragmentation_ratio)) {
-        mem_fragmentation_ratio_ = mem_fragmentation_ratio;
-      }
-    } else if (field == REDIS_MEM_ALLOCATOR_LABEL) {
-      mem_allocator_ = value;
-    }
-    start = pos + 2;
-  }
+  ParseInfoSection(memory_text, 2, this);
 }
 
 common::Value* ServerInfo::Memory::GetValueByIndex(unsigned char index) const {
@@ -413,6 +493,37 @@ common::Value* ServerInfo::Memory::GetValueByIndex(unsigned char index) const {
   return nullptr;
 }
 
+void ServerInfo::Memory::SetValueByIndex(unsigned char index, const char* value, size_t size) {
+  switch (index) {
+    case 0:
+      ParseNumber(value, size, &used_memory_);
+      break;
+    case 1:
+      used_memory_human_.assign(value, size);
+      break;
+    case 2:
+      ParseNumber(value, size, &used_memory_rss_);
+      break;
+    case 3:
+      ParseNumber(value, size, &used_memory_peak_);
+      break;
+    case 4:
+      used_memory_peak_human_.assign(value, size);
+      break;
+    case 5:
+      ParseNumber(value, size, &used_memory_lua_);
+      break;
+    case 6:
+      ParseNumber(value, size, &mem_fragmentation_ratio_);
+      break;
+    case 7:
+      mem_allocator_.assign(value, size);
+      break;
+    default:
+      break;
+  }
+}
+
 ServerInfo::Persistence::Persistence()
     : loading_(0),
       rdb_changes_since_last_save_(0),
@@ -444,77 +555,7 @@ ServerInfo::Persistence::Persistence(const std::string& persistence_text)
       aof_current_rewrite_time_sec_(0),
       aof_last_bgrewrite_status_(),
       aof_last_write_status_() {
-  size_t pos = 0;
-  size_t start = 0;
-  while ((pos = persistence_text.find(("\r\n"), start)) != std::string::npos) {
-    std::string line = persistence_text.substr(start, pos - start);
-    size_t delem = line.find_first_of(':');
-    std::string field = line.substr(0, delem);
-    std::string value = line.substr(delem + 1);
-    if (field == REDIS_LOADING_LABEL) {
-      uint32_t loading;
-      if (common::ConvertFromString(value, &loading)) {
-        loading_ = loading;
-      }
-    } else if (field == REDIS_RDB_CHANGES_SINCE_LAST_SAVE_LABEL) {
-      uint32_t rdb_changes_since_last_save;
-      if (common::ConvertFromString(value, &rdb_changes_since_last_save)) {
-        rdb_changes_since_last_save_ = rdb_changes_since_last_save;
-      }
-    } else if (field == REDIS_RDB_DGSAVE_IN_PROGRESS_LABEL) {
-      uint32_t rdb_bgsave_in_progress;
-      if (common::ConvertFromString(value, &rdb_bgsave_in_progress)) {
-        rdb_bgsave_in_progress_ = rdb_bgsave_in_progress;
-      }
-    } else if (field == REDIS_RDB_LAST_SAVE_TIME_LABEL) {
-      uint32_t rdb_last_save_time;
-      if (common::ConvertFromString(value, &rdb_last_save_time)) {
-        rdb_last_save_time_ = rdb_last_save_time;
-      }
-    } else if (field == REDIS_RDB_LAST_DGSAVE_STATUS_LABEL) {
-      rdb_last_bgsave_status_ = value;
-    } else if (field == REDIS_RDB_LAST_DGSAVE_TIME_SEC_LABEL) {
-      int rdb_last_bgsave_time_sec;
-      if (common::ConvertFromString(value, &rdb_last_bgsave_time_sec)) {
-        rdb_last_bgsave_time_sec_ = rdb_last_bgsave_time_sec;
-      }
-    } else if (field == REDIS_RDB_CURRENT_DGSAVE_TIME_SEC_LABEL) {
-      int rdb_current_bgsave_time_sec;
-      if (common::ConvertFromString(value, &rdb_current_bgsave_time_sec)) {
-        rdb_current_bgsave_time_sec_ = rdb_current_bgsave_time_sec;
-      }
-    } else if (field == REDIS_AOF_ENABLED_LABEL) {
-      uint32_t aof_enabled;
-      if (common::ConvertFromString(value, &aof_enabled)) {
-        aof_enabled_ = aof_enabled;
-      }
-    } else if (field == REDIS_AOF_REWRITE_IN_PROGRESS_LABEL) {
-      uint32_t aof_rewrite_in_progress;
-      if (common::ConvertFromString(value, &aof_rewrite_in_progress)) {
-        aof_rewrite_in_progress_ = aof_rewrite_in_progress;
-      }
-    } else if (field == REDIS_AOF_REWRITE_SHEDULED_LABEL) {
-      uint32_t aof_rewrite_scheduled;
-      if (common::ConvertFromString(value, &aof_rewrite_scheduled)) {
-        aof_rewrite_scheduled_ = aof_rewrite_scheduled;
-      }
-    } else if (field == REDIS_AOF_LAST_REWRITE_TIME_SEC_LABEL) {
-      int aof_last_rewrite_time_sec;
-      if (common::ConvertFromString(value, &aof_last_rewrite_time_sec)) {
-        aof_last_rewrite_time_sec_ = aof_last_rewrite_time_sec;
-      }
-    } else if (field == REDIS_AOF_CURRENT_REWRITE_TIME_SEC_LABEL) {
-      int aof_current_rewrite_time_sec;
-      if (common::ConvertFromString(value, &aof_current_rewrite_time_sec)) {
-        aof_current_rewrite_time_sec_ = aof_current_rewrite_time_sec;
-      }
-    } else if (field == REDIS_AOF_LAST_DGREWRITE_STATUS_LABEL) {
-      aof_last_bgrewrite_status_ = value;
-    } else if (field == REDIS_AOF_LAST_WRITE_STATUS_LABEL) {
-      aof_last_write_status_ = value;
-    }
-    start = pos + 2;
-  }
+  ParseInfoSection(persistence_text, 3, this);
 }
 
 common::Value* ServerInfo::Persistence::GetValueByIndex(unsigned char index) const {
@@ -555,6 +596,55 @@ common::Value* ServerInfo::Persistence::GetValueByIndex(unsigned char index) con
   return nullptr;
 }
 
+void ServerInfo::Persistence::SetValueByIndex(unsigned char index, const char* value, size_t size) {
+  switch (index) {
+    case 0:
+      ParseNumber(value, size, &loading_);
+      break;
+    case 1:
+      ParseNumber(value, size, &rdb_changes_since_last_save_);
+      break;
+    case 2:
+      ParseNumber(value, size, &rdb_bgsave_in_progress_);
+      break;
+    case 3:
+      ParseNumber(value, size, &rdb_last_save_time_);
+      break;
+    case 4:
+      rdb_last_bgsave_status_.assign(value, size);
+      break;
+    case 5:
+      ParseNumber(value, size, &rdb_last_bgsave_time_sec_);
+      break;
+    case 6:
+      ParseNumber(value, size, &rdb_current_bgsave_time_sec_);
+      break;
+    case 7:
+      ParseNumber(value, size, &aof_enabled_);
+      break;
+    case 8:
+      ParseNumber(value, size, &aof_rewrite_in_progress_);
+      break;
+    case 9:
+      ParseNumber(value, size, &aof_rewrite_scheduled_);
+      break;
+    case 10:
+      ParseNumber(value, size, &aof_last_rewrite_time_sec_);
+      break;
+    case 11:
+      ParseNumber(value, size, &aof_current_rewrite_time_sec_);
+      break;
+    case 12:
+      aof_last_bgrewrite_status_.assign(value, size);
+      break;
+    case 13:
+      aof_last_write_status_.assign(value, size);
+      break;
+    default:
+      break;
+  }
+}
+
 ServerInfo::Stats::Stats()
     : total_connections_received_(0),
       total_commands_processed_(0),
@@ -586,86 +676,7 @@ ServerInfo::Stats::Stats(const std::string& stats_text)
       pubsub_channels_(0),
       pubsub_patterns_(0),
       latest_fork_usec_(0) {
-  size_t pos = 0;
-  size_t start = 0;
-  while ((pos = stats_text.find(("\r\n"), start)) != std::string::npos) {
-    std::string line = stats_text.substr(start, pos - start);
-    size_t delem = line.find_first_of(':');
-    std::string field = line.substr(0, delem);
-    std::string value = line.substr(delem + 1);
-    if (field == REDIS_TOTAL_CONNECTIONS_RECEIVED_LABEL) {
-      uint32_t total_connections_received;
-      if (common::ConvertFromString(value, &total_connections_received)) {
-        total_connections_received_ = total_connections_received;
-      }
-    } else if (field == REDIS_TOTAL_COMMANDS_PROCESSED_LABEL) {
-      uint32_t total_commands_processed;
-      if (common::ConvertFromString(value, &total_commands_processed)) {
-        total_commands_processed_ = total_commands_processed;
-      }
-    } else if (field == REDIS_INSTANTANEOUS_OPS_PER_SEC_LABEL) {
-      uint32_t instantaneous_ops_per_sec;
-      if (common::ConvertFromString(value, &instantaneous_ops_per_sec)) {
-        instantaneous_ops_per_sec_ = instantaneous_ops_per_sec;
-      }
-    } else if (field == REDIS_REJECTED_CONNECTIONS_LABEL) {
-      uint32_t rejected_connections;
-      if (common::ConvertFromString(value, &rejected_connections)) {
-        rejected_connections_ = rejected_connections;
-      }
-    } else if (field == REDIS_SYNC_FULL_LABEL) {
-      uint32_t sync_full;
-      if (common::ConvertFromString(value, &sync_full)) {
-        sync_full_ = sync_full;
-      }
-    } else if (field == REDIS_SYNC_PARTIAL_OK_LABEL) {
-      uint32_t sync_partial_ok;
-      if (common::ConvertFromString(value, &sync_partial_ok)) {
-        sync_partial_ok_ = sync_partial_ok;
-      }
-    } else if (field == REDIS_SYNC_PARTIAL_ERR_LABEL) {
-      uint32_t sync_partial_err;
-      if (common::ConvertFromString(value, &sync_partial_err)) {
-        sync_partial_err_ = sync_partial_err;
-      }
-    } else if (field == REDIS_EXPIRED_KEYS_LABEL) {
-      uint32_t expired_keys;
-      if (common::ConvertFromString(value, &expired_keys)) {
-        expired_keys_ = expired_keys;
-      }
-    } else if (field == REDIS_EVICTED_KEYS_LABEL) {
-      uint32_t evicted_keys;
-      if (common::ConvertFromString(value, &evicted_keys)) {
-        evicted_keys_ = evicted_keys;
-      }
-    } else if (field == REDIS_KEYSPACE_HITS_LABEL) {
-      uint32_t keyspace_hits;
-      if (common::ConvertFromString(value, &keyspace_hits)) {
-        keyspace_hits_ = keyspace_hits;
-      }
-    } else if (field == REDIS_KEYSPACE_MISSES_LABEL) {
-      uint32_t keyspace_misses;
-      if (common::ConvertFromString(value, &keyspace_misses)) {
-        keyspace_misses_ = keyspace_misses;
-      }
-    } else if (field == REDIS_PUBSUB_CHANNELS_LABEL) {
-      uint32_t pubsub_channels;
-      if (common::ConvertFromString(value, &pubsub_channels)) {
-        pubsub_channels_ = pubsub_channels;
-      }
-    } else if (field == REDIS_PUBSUB_PATTERNS_LABEL) {
-      uint32_t pubsub_patterns;
-      if (common::ConvertFromString(value, &pubsub_patterns)) {
-        pubsub_patterns_ = pubsub_patterns;
-      }
-    } else if (field == REDIS_LATEST_FORK_USEC_LABEL) {
-      uint32_t latest_fork_usec;
-      if (common::ConvertFromString(value, &latest_fork_usec)) {
-        latest_fork_usec_ = latest_fork_usec;
-      }
-    }
-    start = pos + 2;
-  }
+  ParseInfoSection(stats_text, 4, this);
 }
 
 common::Value* ServerInfo::Stats::GetValueByIndex(unsigned char index) const {
@@ -706,6 +717,55 @@ common::Value* ServerInfo::Stats::GetValueByIndex(unsigned char index) const {
   return nullptr;
 }
 
+void ServerInfo::Stats::SetValueByIndex(unsigned char index, const char* value, size_t size) {
+  switch (index) {
+    case 0:
+      ParseNumber(value, size, &total_connections_received_);
+      break;
+    case 1:
+      ParseNumber(value, size, &total_commands_processed_);
+      break;
+    case 2:
+      ParseNumber(value, size, &instantaneous_ops_per_sec_);
+      break;
+    case 3:
+      ParseNumber(value, size, &rejected_connections_);
+      break;
+    case 4:
+      ParseNumber(value, size, &sync_full_);
+      break;
+    case 5:
+      ParseNumber(value, size, &sync_partial_ok_);
+      break;
+    case 6:
+      ParseNumber(value, size, &sync_partial_err_);
+      break;
+    case 7:
+      ParseNumber(value, size, &expired_keys_);
+      break;
+    case 8:
+      ParseNumber(value, size, &evicted_keys_);
+      break;
+    case 9:
+      ParseNumber(value, size, &keyspace_hits_);
+      break;
+    case 10:
+      ParseNumber(value, size, &keyspace_misses_);
+      break;
+    case 11:
+      ParseNumber(value, size, &pubsub_channels_);
+      break;
+    case 12:
+      ParseNumber(value, size, &pubsub_patterns_);
+      break;
+    case 13:
+      ParseNumber(value, size, &latest_fork_usec_);
+      break;
+    default:
+      break;
+  }
+}
+
 ServerInfo::Replication::Replication()
     : role_(),
       connected_slaves_(0),
@@ -723,49 +783,7 @@ ServerInfo::Replication::Replication(const std::string& replication_text)
       backlog_size_(0),
       backlog_first_byte_offset_(0),
       backlog_histen_(0) {
-  size_t pos = 0;
-  size_t start = 0;
-
-  while ((pos = replication_text.find(("\r\n"), start)) != std::string::npos) {
-    std::string line = replication_text.substr(start, pos - start);
-    size_t delem = line.find_first_of(':');
-    std::string field = line.substr(0, delem);
-    std::string value = line.substr(delem + 1);
-    if (field == REDIS_ROLE_LABEL) {
-      role_ = value;
-    } else if (field == REDIS_CONNECTED_SLAVES_LABEL) {
-      uint32_t connected_slaves;
-      if (common::ConvertFromString(value, &connected_slaves)) {
-        connected_slaves_ = connected_slaves;
-      }
-    } else if (field == REDIS_MASTER_REPL_OFFSET_LABEL) {
-      uint32_t master_repl_offset;
-      if (common::ConvertFromString(value, &master_repl_offset)) {
-        master_repl_offset_ = master_repl_offset;
-      }
-    } else if (field == REDIS_BACKLOG_ACTIVE_LABEL) {
-      uint32_t backlog_active;
-      if (common::ConvertFromString(value, &backlog_active)) {
-        backlog_active_ = backlog_active;
-      }
-    } else if (field == REDIS_BACKLOG_SIZE_LABEL) {
-      uint32_t backlog_size;
-      if (common::ConvertFromString(value, &backlog_size)) {
-        backlog_size_ = backlog_size;
-      }
-    } else if (field == REDIS_BACKLOG_FIRST_BYTE_OFFSET_LABEL) {
-      uint32_t backlog_first_byte_offset;
-      if (common::ConvertFromString(value, &backlog_first_byte_offset)) {
-        backlog_first_byte_offset_ = backlog_first_byte_offset;
-      }
-    } else if (field == REDIS_BACKLOG_HISTEN_LABEL) {
-      uint32_t backlog_histen;
-      if (common::ConvertFromString(value, &backlog_histen)) {
-        backlog_histen_ = backlog_histen;
-      }
-    }
-    start = pos + 2;
-  }
+  ParseInfoSection(replication_text, 5, this);
 }
 
 common::Value* ServerInfo::Replication::GetValueByIndex(unsigned char index) const {
@@ -792,40 +810,39 @@ common::Value* ServerInfo::Replication::GetValueByIndex(unsigned char index) con
   return nullptr;
 }
 
+void ServerInfo::Replication::SetValueByIndex(unsigned char index, const char* value, size_t size) {
+  switch (index) {
+    case 0:
+      role_.assign(value, size);
+      break;
+    case 1:
+      ParseNumber(value, size, &connected_slaves_);
+      break;
+    case 2:
+      ParseNumber(value, size, &master_repl_offset_);
+      break;
+    case 3:
+      ParseNumber(value, size, &backlog_active_);
+      break;
+    case 4:
+      ParseNumber(value, size, &backlog_size_);
+      break;
+    case 5:
+      ParseNumber(value, size, &backlog_first_byte_offset_);
+      break;
+    case 6:
+      ParseNumber(value, size, &backlog_histen_);
+      break;
+    default:
+      break;
+  }
+}
+
 ServerInfo::Cpu::Cpu() : used_cpu_sys_(0), used_cpu_user_(0), used_cpu_sys_children_(0), used_cpu_user_children_(0) {}
 
 ServerInfo::Cpu::Cpu(const std::string& cpu_text)
     : used_cpu_sys_(0), used_cpu_user_(0), used_cpu_sys_children_(0), used_cpu_user_children_(0) {
-  size_t pos = 0;
-  size_t start = 0;
-  while ((pos = cpu_text.find(("\r\n"), start)) != std::string::npos) {
-    std::string line = cpu_text.substr(start, pos - start);
-    size_t delem = line.find_first_of(':');
-    std::string field = line.substr(0, delem);
-    std::string value = line.substr(delem + 1);
-    if (field == (REDIS_USED_CPU_SYS_LABEL)) {
-      float used_cpu_sys;
-      if (common::ConvertFromString(value, &used_cpu_sys)) {
-        used_cpu_sys_ = used_cpu_sys;
-      }
-    } else if (field == REDIS_USED_CPU_USER_LABEL) {
-      float used_cpu_user;
-      if (common::ConvertFromString(value, &used_cpu_user)) {
-        used_cpu_user_ = used_cpu_user;
-      }
-    } else if (field == REDIS_USED_CPU_SYS_CHILDREN_LABEL) {
-      float used_cpu_sys_children;
-      if (common::ConvertFromString(value, &used_cpu_sys_children)) {
-        used_cpu_sys_children_ = used_cpu_sys_children;
-      }
-    } else if (field == REDIS_USED_CPU_USER_CHILDREN_LABEL) {
-      float used_cpu_user_children;
-      if (common::ConvertFromString(value, &used_cpu_user_children)) {
-        used_cpu_user_children_ = used_cpu_user_children;
-      }
-    }
-    start = pos + 2;
-  }
+  ParseInfoSection(cpu_text, 6, this);
 }
 
 common::Value* ServerInfo::Cpu::GetValueByIndex(unsigned char index) const {
@@ -846,6 +863,25 @@ common::Value* ServerInfo::Cpu::GetValueByIndex(unsigned char index) const {
   return nullptr;
 }
 
+void ServerInfo::Cpu::SetValueByIndex(unsigned char index, const char* value, size_t size) {
+  switch (index) {
+    case 0:
+      ParseNumber(value, size, &used_cpu_sys_);
+      break;
+    case 1:
+      ParseNumber(value, size, &used_cpu_user_);
+      break;
+    case 2:
+      ParseNumber(value, size, &used_cpu_sys_children_);
+      break;
+    case 3:
+      ParseNumber(value, size, &used_cpu_user_children_);
+      break;
+    default:
+      break;
+  }
+}
+
 common::Value* ServerInfo::Keyspace::GetValueByIndex(unsigned char index) const {
   UNUSED(index);
 
@@ -898,6 +934,34 @@ common::Value* ServerInfo::GetValueByIndexes(unsigned char property, unsigned ch
   return nullptr;
 }
 
+void ServerInfo::SetValueByIndexes(unsigned char property, unsigned char field, const char* value, size_t size) {
+  switch (property) {
+    case 0:
+      server_.SetValueByIndex(field, value, size);
+      break;
+    case 1:
+      clients_.SetValueByIndex(field, value, size);
+      break;
+    case 2:
+      memory_.SetValueByIndex(field, value, size);
+      break;
+    case 3:
+      persistence_.SetValueByIndex(field, value, size);
+      break;
+    case 4:
+      stats_.SetValueByIndex(field, value, size);
+      break;
+    case 5:
+      replication_.SetValueByIndex(field, value, size);
+      break;
+    case 6:
+      cpu_.SetValueByIndex(field, value, size);
+      break;
+    default:
+      break;
+  }
+}
+
 std::ostream& operator<<(std::ostream& out, const ServerInfo::Server& value) {
   return out << REDIS_VERSION_LABEL ":" << value.redis_version_ << ("\r\n") << REDIS_GIT_SHA1_LABEL ":"
              << value.redis_git_sha1_ << ("\r\n") << REDIS_GIT_DIRTY_LABEL ":" << value.redis_git_dirty_ << ("\r\n")
@@ -1005,55 +1069,16 @@ ServerInfo* MakeRedisServerInfo(const std::string& content) {
     return nullptr;
   }
 
+  // single pass, labels are unique across sections
   ServerInfo* result = new ServerInfo;
-  size_t j = 0;
-  std::string word;
-  size_t pos = 0;
-  static const std::vector<core::info_field_t> fields = DBTraits<REDIS>::GetInfoFields();
-  for (size_t i = 0; i < content.size(); ++i) {
-    char ch = content[i];
-    word += ch;
-    if (word == fields[j].first) {
-      if (j + 1 != fields.size()) {
-        pos = content.find(fields[j + 1].first, pos);
-      } else {
-        break;
-      }
-
-      if (pos != std::string::npos) {
-        std::string part = content.substr(i + 1, pos - i - 1);
-        switch (j) {
-          case 0:
-            result->server_ = ServerInfo::Server(part);
-            break;
-          case 1:
-            result->clients_ = ServerInfo::Clients(part);
-            break;
-          case 2:
-            result->memory_ = ServerInfo::Memory(part);
-            break;
-          case 3:
-            result->persistence_ = ServerInfo::Persistence(part);
-            break;
-          case 4:
-            result->stats_ = ServerInfo::Stats(part);
-            break;
-          case 5:
-            result->replication_ = ServerInfo::Replication(part);
-            break;
-          case 6:
-            result->cpu_ = ServerInfo::Cpu(part);
-            break;
-          default:
-            break;
-        }
-        i = pos - 1;
-        ++j;
-      }
-      word.clear();
+  const InfoFieldsTable& table = GetInfoFieldsTable();
+  ForEachInfoLine(content, [&table, result](const char* label, size_t label_size, const char* value,
+                                            size_t value_size) {
+    const InfoFieldsTable::Entry* entry = table.Find(label, label_size);
+    if (entry) {
+      result->SetValueByIndexes(entry->property, entry->field, value, value_size);
     }
-  }
-
+  });
   return result;
 }
 
@@ -119,6 +119,7 @@ struct ServerInfo : public IServerInfo {
     Server();
     explicit Server(const std::string& server_text);
     common::Value* GetValueByIndex(unsigned char index) const override;
+    void SetValueByIndex(unsigned char index, const char* value, size_t size);
 
     std::string redis_version_;
     std::string redis_git_sha1_;
@@ -142,6 +143,7 @@ struct ServerInfo : public IServerInfo {
     Clients();
     explicit Clients(const std::string& client_text);
     common::Value* GetValueByIndex(unsigned char index) const override;
+    void SetValueByIndex(unsigned char index, const char* value, size_t size);
 
     uint32_t connected_clients_;
     uint32_t client_longest_output_list_;
@@ -153,6 +155,7 @@ struct ServerInfo : public IServerInfo {
     Memory();
     explicit Memory(const std::string& memory_text);
     common::Value* GetValueByIndex(unsigned char index) const override;
+    void SetValueByIndex(unsigned char index, const char* value, size_t size);
 
     uint32_t used_memory_;
     std::string used_memory_human_;
@@ -168,6 +171,7 @@ struct ServerInfo : public IServerInfo {
     Persistence();
     explicit Persistence(const std::string& persistence_text);
     common::Value* GetValueByIndex(unsigned char index) const override;
+    void SetValueByIndex(unsigned char index, const char* value, size_t size);
 
     uint32_t loading_;
     uint32_t rdb_changes_since_last_save_;
@@ -189,6 +193,7 @@ struct ServerInfo : public IServerInfo {
     Stats();
     explicit Stats(const std::string& stats_text);
     common::Value* GetValueByIndex(unsigned char index) const override;
+    void SetValueByIndex(unsigned char index, const char* value, size_t size);
 
     uint32_t total_connections_received_;
     uint32_t total_commands_processed_;
@@ -210,6 +215,7 @@ struct ServerInfo : public IServerInfo {
     Replication();
     explicit Replication(const std::string& replication_text);
     common::Value* GetValueByIndex(unsigned char index) const override;
+    void SetValueByIndex(unsigned char index, const char* value, size_t size);
 
     std::string role_;
     uint32_t connected_slaves_;
@@ -224,6 +230,7 @@ struct ServerInfo : public IServerInfo {
     Cpu();
     explicit Cpu(const std::string& cpu_text);
     common::Value* GetValueByIndex(unsigned char index) const override;
+    void SetValueByIndex(unsigned char index, const char* value, size_t size);
 
     float used_cpu_sys_;
     float used_cpu_user_;
@@ -246,13 +253,14 @@ struct ServerInfo : public IServerInfo {
              const Keyspace& key);
 
   virtual common::Value* GetValueByIndexes(unsigned char property, unsigned char field) const override;
+  void SetValueByIndexes(unsigned char property, unsigned char field, const char* value, size_t size);
   virtual std::string ToString() const override;
   virtual uint32_t GetVersion() const override;
 };
 
 std::ostream& operator<<(std::ostream& out, const ServerInfo& value);
 
-ServerInfo* MakeRedisServerInfo(const std::string& content);
+ServerInfo* MakeRedisServerInfo(const std::string& content);  // parses INFO output in one pass
 
 }  // namespace redis
 }  // namespace core
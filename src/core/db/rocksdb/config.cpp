@@ -32,6 +32,7 @@ namespace core {
 namespace rocksdb {
 
 const std::vector<const char*> g_comparator_types = {"BYTEWISE", "REVERSE_BYTEWISE"};
+const std::vector<const char*> g_open_modes = {"READ_WRITE", "READ_ONLY", "SECONDARY"};
 
 namespace {
 
@@ -51,6 +52,15 @@ Config ParseOptions(int argc, char** argv) {
       if (common::ConvertFromString(argv[++i], &lcomparator)) {
         cfg.comparator = lcomparator;
       }
+    } else if (!strcmp(argv[i], "-n") && !lastarg) {
+      cfg.db_name = argv[++i];
+    } else if (!strcmp(argv[i], "-mode") && !lastarg) {
+      OpenMode lmode;
+      if (common::ConvertFromString(argv[++i], &lmode)) {
+        cfg.open_mode = lmode;
+      }
+    } else if (!strcmp(argv[i], "-s") && !lastarg) {
+      cfg.secondary_path = argv[++i];
     } else {
       if (argv[i][0] == '-') {
         const std::string buff = common::MemSPrintf(
@@ -70,10 +80,15 @@ Config ParseOptions(int argc, char** argv) {
 
 }  // namespace
 
+const std::string Config::default_db_name = "default";
+
 Config::Config()
     : LocalConfig(common::file_system::prepare_path("~/test.rocksdb")),
       create_if_missing(true),
-      comparator(COMP_BYTEWISE) {}
+      comparator(COMP_BYTEWISE),
+      db_name(default_db_name),
+      open_mode(OPEN_READ_WRITE),
+      secondary_path() {}
 
 }  // namespace rocksdb
 }  // namespace core
@@ -90,6 +105,21 @@ std::string ConvertToString(const fastonosql::core::rocksdb::Config& conf) {
 
   argv.push_back("-comp");
   argv.push_back(common::ConvertToString(conf.comparator));
+
+  if (!conf.db_name.empty()) {
+    argv.push_back("-n");
+    argv.push_back(conf.db_name);
+  }
+
+  if (conf.open_mode != fastonosql::core::rocksdb::OPEN_READ_WRITE) {
+    argv.push_back("-mode");
+    argv.push_back(common::ConvertToString(conf.open_mode));
+  }
+
+  if (!conf.secondary_path.empty()) {
+    argv.push_back("-s");
+    argv.push_back(conf.secondary_path);
+  }
   return fastonosql::core::ConvertToStringConfigArgs(argv);
 }
 
@@ -129,4 +159,24 @@ bool ConvertFromString(const std::string& from, fastonosql::core::rocksdb::Compa
   return false;
 }
 
+std::string ConvertToString(fastonosql::core::rocksdb::OpenMode mode) {
+  return fastonosql::core::rocksdb::g_open_modes[mode];
+}
+
+bool ConvertFromString(const std::string& from, fastonosql::core::rocksdb::OpenMode* out) {
+  if (!out || from.empty()) {
+    return false;
+  }
+
+  for (size_t i = 0; i < fastonosql::core::rocksdb::g_open_modes.size(); ++i) {
+    if (from == fastonosql::core::rocksdb::g_open_modes[i]) {
+      *out = static_cast<fastonosql::core::rocksdb::OpenMode>(i);
+      return true;
+    }
+  }
+
+  NOTREACHED();
+  return false;
+}
+
 }  // namespace common
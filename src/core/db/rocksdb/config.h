@@ -27,11 +27,19 @@ namespace rocksdb {
 enum ComparatorType { COMP_BYTEWISE, COMP_REVERSE_BYTEWISE };
 extern const std::vector<const char*> g_comparator_types;
 
+// read only and secondary instances don't take db lock, so live database of other process can be browsed
+enum OpenMode { OPEN_READ_WRITE, OPEN_READ_ONLY, OPEN_SECONDARY };
+extern const std::vector<const char*> g_open_modes;
+
 struct Config : public LocalConfig {
+  static const std::string default_db_name;  // default column family
   Config();
 
   bool create_if_missing;
   ComparatorType comparator;
+  std::string db_name;  // column family selected after connect
+  OpenMode open_mode;
+  std::string secondary_path;  // info log and manifest copy of secondary instance
 };
 
 }  // namespace rocksdb
@@ -44,4 +52,7 @@ bool ConvertFromString(const std::string& from, fastonosql::core::rocksdb::Confi
 
 std::string ConvertToString(fastonosql::core::rocksdb::ComparatorType comp);
 bool ConvertFromString(const std::string& from, fastonosql::core::rocksdb::ComparatorType* out);
+
+std::string ConvertToString(fastonosql::core::rocksdb::OpenMode mode);
+bool ConvertFromString(const std::string& from, fastonosql::core::rocksdb::OpenMode* out);
 }  // namespace common
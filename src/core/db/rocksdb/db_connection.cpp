@@ -18,9 +18,13 @@
 
 #include "core/db/rocksdb/db_connection.h"
 
+#include <algorithm>
+
 #include <common/file_system/string_path_utils.h>
 
 #include <rocksdb/db.h>
+#include <rocksdb/utilities/backupable_db.h>  // for BackupEngine
+#include <rocksdb/write_batch.h>
 
 #include "core/db/rocksdb/command_translator.h"
 #include "core/db/rocksdb/database_info.h"
@@ -41,6 +45,58 @@
 
 namespace fastonosql {
 namespace core {
+namespace rocksdb {
+
+struct rocksdb {
+  ::rocksdb::DB* db;
+  std::vector< ::rocksdb::ColumnFamilyHandle*> families;  // all column families, opened on connect
+  ::rocksdb::ColumnFamilyHandle* current;                 // selected database
+  bool secondary;
+};
+
+namespace {
+
+::rocksdb::Options rocksdb_make_options(const Config& config) {
+  ::rocksdb::Options rs;
+  rs.create_if_missing = config.create_if_missing;
+  if (config.comparator == COMP_BYTEWISE) {
+    rs.comparator = ::rocksdb::BytewiseComparator();
+  } else if (config.comparator == COMP_REVERSE_BYTEWISE) {
+    rs.comparator = ::rocksdb::ReverseBytewiseComparator();
+  }
+  return rs;
+}
+
+::rocksdb::ColumnFamilyHandle* rocksdb_find_family(rocksdb* context, const std::string& name) {
+  for (size_t i = 0; i < context->families.size(); ++i) {
+    if (context->families[i]->GetName() == name) {
+      return context->families[i];
+    }
+  }
+
+  return nullptr;
+}
+
+void rocksdb_close(rocksdb** context) {
+  if (!context) {
+    return;
+  }
+
+  rocksdb* lcontext = *context;
+  if (!lcontext) {
+    return;
+  }
+
+  for (size_t i = 0; i < lcontext->families.size(); ++i) {
+    lcontext->db->DestroyColumnFamilyHandle(lcontext->families[i]);
+  }
+  delete lcontext->db;
+  delete lcontext;
+  *context = nullptr;
+}
+
+}  // namespace
+}  // namespace rocksdb
 
 template <>
 const char* ConnectionTraits<ROCKSDB>::GetBasedOn() {
@@ -70,7 +126,7 @@ common::Error ConnectionAllocatorTraits<rocksdb::NativeConnection, rocksdb::Conf
 template <>
 common::Error ConnectionAllocatorTraits<rocksdb::NativeConnection, rocksdb::Config>::Disconnect(
     rocksdb::NativeConnection** handle) {
-  destroy(handle);
+  rocksdb::rocksdb_close(handle);
   return common::Error();
 }
 
@@ -98,38 +154,66 @@ common::Error CreateConnection(const Config& config, NativeConnection** context)
   }
 
   DCHECK(*context == nullptr);
-  ::rocksdb::DB* lcontext = nullptr;
   std::string folder = config.db_path;  // start point must be folder
   common::tribool is_dir = common::file_system::is_directory(folder);
   if (is_dir != common::SUCCESS && !config.create_if_missing) {
     return common::make_error(common::MemSPrintf("Invalid input path(%s)", folder));
   }
 
-  ::rocksdb::Options rs;
-  rs.create_if_missing = config.create_if_missing;
-  if (config.comparator == COMP_BYTEWISE) {
-    rs.comparator = ::rocksdb::BytewiseComparator();
-  } else if (config.comparator == COMP_REVERSE_BYTEWISE) {
-    rs.comparator = ::rocksdb::ReverseBytewiseComparator();
+  if (config.open_mode == OPEN_SECONDARY && config.secondary_path.empty()) {
+    return common::make_error("Secondary instance requires secondary path");
+  }
+
+  // all column families must be opened, otherwise open fails
+  ::rocksdb::Options rs = rocksdb_make_options(config);
+  std::vector<std::string> names;
+  auto st = ::rocksdb::DB::ListColumnFamilies(rs, folder, &names);
+  if (!st.ok() || names.empty()) {  // not created yet
+    names = {::rocksdb::kDefaultColumnFamilyName};
+  }
+
+  std::vector< ::rocksdb::ColumnFamilyDescriptor> descriptors;
+  for (size_t i = 0; i < names.size(); ++i) {
+    descriptors.push_back(::rocksdb::ColumnFamilyDescriptor(names[i], ::rocksdb::ColumnFamilyOptions(rs)));
+  }
+
+  ::rocksdb::DB* ldb = nullptr;
+  std::vector< ::rocksdb::ColumnFamilyHandle*> handles;
+  if (config.open_mode == OPEN_READ_ONLY) {
+    st = ::rocksdb::DB::OpenForReadOnly(rs, folder, descriptors, &handles, &ldb);
+  } else if (config.open_mode == OPEN_SECONDARY) {
+    rs.max_open_files = -1;  // secondary instance keeps all table files open
+    st = ::rocksdb::DB::OpenAsSecondary(rs, folder, config.secondary_path, descriptors, &handles, &ldb);
+  } else {
+    st = ::rocksdb::DB::Open(rs, folder, descriptors, &handles, &ldb);
   }
-  auto st = ::rocksdb::DB::Open(rs, folder, &lcontext);
   if (!st.ok()) {
     std::string buff = common::MemSPrintf("Fail open database: %s!", st.ToString());
     return common::make_error(buff);
   }
 
+  rocksdb* lcontext = new rocksdb;
+  lcontext->db = ldb;
+  lcontext->families = handles;
+  lcontext->secondary = config.open_mode == OPEN_SECONDARY;
+  lcontext->current = rocksdb_find_family(lcontext, config.db_name);
+  if (!lcontext->current) {  // removed since last session
+    lcontext->current = rocksdb_find_family(lcontext, ::rocksdb::kDefaultColumnFamilyName);
+  }
+  DCHECK(lcontext->current);
+
   *context = lcontext;
   return common::Error();
 }
 
 common::Error TestConnection(const Config& config) {
-  ::rocksdb::DB* ldb = nullptr;
+  rocksdb* ldb = nullptr;
   common::Error err = CreateConnection(config, &ldb);
   if (err) {
     return err;
   }
 
-  delete ldb;
+  rocksdb_close(&ldb);
   return common::Error();
 }
 
@@ -149,7 +233,7 @@ common::Error DBConnection::Info(const std::string& args, ServerInfo::Stats* sta
   }
 
   std::string rets;
-  bool isok = connection_.handle_->GetProperty("rocksdb.stats", &rets);
+  bool isok = connection_.handle_->db->GetProperty("rocksdb.stats", &rets);
   if (!isok) {
     return common::make_error("info function failed");
   }
@@ -207,9 +291,78 @@ common::Error DBConnection::Info(const std::string& args, ServerInfo::Stats* sta
   return common::Error();
 }
 
+common::Error DBConnection::Backup(const std::string& path, internal::backup_progress_callback_t progress) {
+  UNUSED(progress);  // backup engine doesn't report percents
+
+  common::Error err = TestIsAuthenticated();
+  if (err) {
+    return err;
+  }
+
+  err = TestIsWritable(DB_BACKUP_COMMAND);
+  if (err) {
+    return err;
+  }
+
+  ::rocksdb::BackupableDBOptions options(path);
+  options.backup_rate_limit = BACKUP_DEFAULT_RATE_LIMIT;
+  ::rocksdb::BackupEngine* engine = nullptr;
+  err = CheckResultCommand(DB_BACKUP_COMMAND,
+                           ::rocksdb::BackupEngine::Open(::rocksdb::Env::Default(), options, &engine));
+  if (err) {
+    return err;
+  }
+
+  // incremental, shares sst files with previous backups in path
+  auto st = engine->CreateNewBackup(connection_.handle_->db, true);
+  delete engine;
+  return CheckResultCommand(DB_BACKUP_COMMAND, st);
+}
+
+common::Error DBConnection::Restore(const std::string& path, internal::backup_progress_callback_t progress) {
+  UNUSED(progress);
+
+  common::Error err = TestIsAuthenticated();
+  if (err) {
+    return err;
+  }
+
+  err = TestIsWritable(DB_RESTORE_COMMAND);
+  if (err) {
+    return err;
+  }
+
+  ::rocksdb::BackupableDBOptions options(path);
+  options.restore_rate_limit = BACKUP_DEFAULT_RATE_LIMIT;
+  ::rocksdb::BackupEngineReadOnly* engine = nullptr;
+  err = CheckResultCommand(DB_RESTORE_COMMAND,
+                           ::rocksdb::BackupEngineReadOnly::Open(::rocksdb::Env::Default(), options, &engine));
+  if (err) {
+    return err;
+  }
+
+  // files of opened database are replaced, so reopen it
+  const config_t config = GetConfig();
+  err = Disconnect();
+  if (err) {
+    delete engine;
+    return err;
+  }
+
+  auto st = engine->RestoreDBFromLatestBackup(config->db_path, config->db_path);
+  delete engine;
+  ResetCaches();
+  common::Error connect_err = Connect(config);
+  if (connect_err) {
+    return connect_err;
+  }
+
+  return CheckResultCommand(DB_RESTORE_COMMAND, st);
+}
+
 std::string DBConnection::GetCurrentDBName() const {
   if (IsConnected()) {
-    ::rocksdb::ColumnFamilyHandle* fam = connection_.handle_->DefaultColumnFamily();
+    ::rocksdb::ColumnFamilyHandle* fam = connection_.handle_->current;
     if (fam) {
       return fam->GetName();
     }
@@ -223,7 +376,8 @@ common::Error DBConnection::GetInner(key_t key, std::string* ret_val) {
   ::rocksdb::ReadOptions ro;
   const string_key_t key_str = key.GetKeyData();
   const ::rocksdb::Slice key_slice(reinterpret_cast<const char*>(key_str.data()), key_str.size());
-  return CheckResultCommand(DB_GET_KEY_COMMAND, connection_.handle_->Get(ro, key_slice, ret_val));
+  auto st = connection_.handle_->db->Get(ro, connection_.handle_->current, key_slice, ret_val);
+  return CheckResultCommand(DB_GET_KEY_COMMAND, st);
 }
 
 common::Error DBConnection::Mget(const std::vector<std::string>& keys, std::vector<std::string>* ret) {
@@ -241,7 +395,8 @@ common::Error DBConnection::Mget(const std::vector<std::string>& keys, std::vect
     rslice.push_back(key);
   }
   ::rocksdb::ReadOptions ro;
-  auto sts = connection_.handle_->MultiGet(ro, rslice, ret);
+  const std::vector< ::rocksdb::ColumnFamilyHandle*> families(rslice.size(), connection_.handle_->current);
+  auto sts = connection_.handle_->db->MultiGet(ro, families, rslice, ret);
   for (size_t i = 0; i < sts.size(); ++i) {
     common::Error err = CheckResultCommand("MGET", sts[i]);
     if (err) {
@@ -262,15 +417,42 @@ common::Error DBConnection::Merge(const std::string& key, const std::string& val
     return err;
   }
 
+  err = TestIsWritable("MERGE");
+  if (err) {
+    return err;
+  }
+
   ::rocksdb::WriteOptions wo;
-  return CheckResultCommand("MERGE", connection_.handle_->Merge(wo, key, value));
+  return CheckResultCommand("MERGE", connection_.handle_->db->Merge(wo, connection_.handle_->current, key, value));
+}
+
+common::Error DBConnection::ConfigGetDatabases(std::vector<std::string>* dbs) {
+  if (!dbs) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  common::Error err = TestIsAuthenticated();
+  if (err) {
+    return err;
+  }
+
+  // handles are opened for every column family, so names are known without reading manifest
+  std::vector<std::string> ldbs;
+  for (size_t i = 0; i < connection_.handle_->families.size(); ++i) {
+    ldbs.push_back(connection_.handle_->families[i]->GetName());
+  }
+
+  *dbs = ldbs;
+  return common::Error();
 }
 
 common::Error DBConnection::SetInner(key_t key, const std::string& value) {
   ::rocksdb::WriteOptions wo;
   const string_key_t key_str = key.GetKeyData();
   const ::rocksdb::Slice key_slice(reinterpret_cast<const char*>(key_str.data()), key_str.size());
-  return CheckResultCommand(DB_SET_KEY_COMMAND, connection_.handle_->Put(wo, key_slice, value));
+  auto st = connection_.handle_->db->Put(wo, connection_.handle_->current, key_slice, value);
+  return CheckResultCommand(DB_SET_KEY_COMMAND, st);
 }
 
 common::Error DBConnection::DelInner(key_t key) {
@@ -283,7 +465,8 @@ common::Error DBConnection::DelInner(key_t key) {
   ::rocksdb::WriteOptions wo;
   const string_key_t key_str = key.GetKeyData();
   const ::rocksdb::Slice key_slice(reinterpret_cast<const char*>(key_str.data()), key_str.size());
-  return CheckResultCommand(DB_DELETE_KEY_COMMAND, connection_.handle_->Delete(wo, key_slice));
+  auto st = connection_.handle_->db->Delete(wo, connection_.handle_->current, key_slice);
+  return CheckResultCommand(DB_DELETE_KEY_COMMAND, st);
 }
 
 common::Error DBConnection::ScanImpl(uint64_t cursor_in,
@@ -291,12 +474,29 @@ common::Error DBConnection::ScanImpl(uint64_t cursor_in,
                                      uint64_t count_keys,
                                      std::vector<std::string>* keys_out,
                                      uint64_t* cursor_out) {
+  std::string last_key;
+  bool is_resumed = scan_cursors_.Find(cursor_in, pattern, &last_key);
+  if (!is_resumed) {  // catch up once per scan, not on every page
+    common::Error err = CatchUpWithPrimary(DB_SCAN_COMMAND);
+    if (err) {
+      return err;
+    }
+  }
+
   ::rocksdb::ReadOptions ro;
-  ::rocksdb::Iterator* it = connection_.handle_->NewIterator(ro);  // keys(key_start, key_end, limit, ret);
-  uint64_t offset_pos = cursor_in;
+  ::rocksdb::Iterator* it = connection_.handle_->db->NewIterator(ro, connection_.handle_->current);
+  uint64_t offset_pos = is_resumed ? 0 : cursor_in;
   uint64_t lcursor_out = 0;
   std::vector<std::string> lkeys_out;
-  for (it->SeekToFirst(); it->Valid(); it->Next()) {
+  if (is_resumed) {
+    it->Seek(last_key);
+    if (it->Valid() && it->key() == last_key) {
+      it->Next();
+    }
+  } else {
+    it->SeekToFirst();
+  }
+  for (; it->Valid(); it->Next()) {
     std::string key = it->key().ToString();
     if (lkeys_out.size() < count_keys) {
       if (common::MatchPattern(key, pattern)) {
@@ -320,6 +520,10 @@ common::Error DBConnection::ScanImpl(uint64_t cursor_in,
     return err;
   }
 
+  if (lcursor_out != 0 && !lkeys_out.empty()) {
+    scan_cursors_.Register(lcursor_out, pattern, lkeys_out.back());
+  }
+
   *keys_out = lkeys_out;
   *cursor_out = lcursor_out;
   return common::Error();
@@ -330,7 +534,7 @@ common::Error DBConnection::KeysImpl(const std::string& key_start,
                                      uint64_t limit,
                                      std::vector<std::string>* ret) {
   ::rocksdb::ReadOptions ro;
-  ::rocksdb::Iterator* it = connection_.handle_->NewIterator(ro);  // keys(key_start, key_end, limit, ret);
+  ::rocksdb::Iterator* it = connection_.handle_->db->NewIterator(ro, connection_.handle_->current);
   for (it->Seek(key_start); it->Valid(); it->Next()) {
     std::string key = it->key().ToString();
     if (ret->size() < limit) {
@@ -349,8 +553,13 @@ common::Error DBConnection::KeysImpl(const std::string& key_start,
 }
 
 common::Error DBConnection::DBkcountImpl(size_t* size) {
+  common::Error err = CatchUpWithPrimary(DB_DBKCOUNT_COMMAND);
+  if (err) {
+    return err;
+  }
+
   ::rocksdb::ReadOptions ro;
-  ::rocksdb::Iterator* it = connection_.handle_->NewIterator(ro);
+  ::rocksdb::Iterator* it = connection_.handle_->db->NewIterator(ro, connection_.handle_->current);
   size_t sz = 0;
   for (it->SeekToFirst(); it->Valid(); it->Next()) {
     sz++;
@@ -359,7 +568,7 @@ common::Error DBConnection::DBkcountImpl(size_t* size) {
   auto st = it->status();
   delete it;
 
-  common::Error err = CheckResultCommand(DB_DBKCOUNT_COMMAND, st);
+  err = CheckResultCommand(DB_DBKCOUNT_COMMAND, st);
   if (err) {
     return err;
   }
@@ -368,42 +577,132 @@ common::Error DBConnection::DBkcountImpl(size_t* size) {
   return common::Error();
 }
 
+common::Error DBConnection::DBkcountEstimateImpl(size_t* size) {
+  uint64_t sz = 0;
+  if (!connection_.handle_->db->GetIntProperty(connection_.handle_->current, "rocksdb.estimate-num-keys", &sz)) {
+    return DBkcountImpl(size);
+  }
+
+  *size = sz;
+  return common::Error();
+}
+
 common::Error DBConnection::FlushDBImpl() {
-  ::rocksdb::ReadOptions ro;
-  ::rocksdb::WriteOptions wo;
-  ::rocksdb::Iterator* it = connection_.handle_->NewIterator(ro);
-  for (it->SeekToFirst(); it->Valid(); it->Next()) {
-    std::string key = it->key().ToString();
-    common::Error err = CheckResultCommand(DB_FLUSHDB_COMMAND, connection_.handle_->Delete(wo, key));
-    if (err) {
-      delete it;
-      return err;
-    }
+  common::Error err = TestIsWritable(DB_FLUSHDB_COMMAND);
+  if (err) {
+    return err;
   }
 
+  ::rocksdb::ReadOptions ro;
+  ro.fill_cache = false;
+  ::rocksdb::ColumnFamilyHandle* fam = connection_.handle_->current;
+  ::rocksdb::Iterator* it = connection_.handle_->db->NewIterator(ro, fam);
+  it->SeekToFirst();
+  if (!it->Valid()) {  // empty database
+    auto st = it->status();
+    delete it;
+    return CheckResultCommand(DB_FLUSHDB_COMMAND, st);
+  }
+
+  const std::string first_key = it->key().ToString();
+  it->SeekToLast();
+  const std::string last_key = it->Valid() ? it->key().ToString() : first_key;
   auto st = it->status();
   delete it;
 
-  return CheckResultCommand(DB_FLUSHDB_COMMAND, st);
+  err = CheckResultCommand(DB_FLUSHDB_COMMAND, st);
+  if (err) {
+    return err;
+  }
+
+  // one range tombstone plus the last key (end of range is exclusive)
+  ::rocksdb::WriteOptions wo;
+  err = CheckResultCommand(DB_FLUSHDB_COMMAND, connection_.handle_->db->DeleteRange(wo, fam, first_key, last_key));
+  if (err) {
+    return err;
+  }
+
+  err = CheckResultCommand(DB_FLUSHDB_COMMAND, connection_.handle_->db->Delete(wo, fam, last_key));
+  if (err) {
+    return err;
+  }
+
+  // drop tombstoned data from sst files
+  ::rocksdb::CompactRangeOptions co;
+  return CheckResultCommand(DB_FLUSHDB_COMMAND, connection_.handle_->db->CompactRange(co, fam, nullptr, nullptr));
+}
+
+common::Error DBConnection::CreateDBImpl(const std::string& name, IDataBaseInfo** info) {
+  common::Error err = TestIsWritable(DB_CREATEDB_COMMAND);
+  if (err) {
+    return err;
+  }
+
+  auto conf = GetConfig();
+  ::rocksdb::ColumnFamilyOptions options(rocksdb_make_options(*conf));
+  ::rocksdb::ColumnFamilyHandle* fam = nullptr;
+  err = CheckResultCommand(DB_CREATEDB_COMMAND, connection_.handle_->db->CreateColumnFamily(options, name, &fam));
+  if (err) {
+    return err;
+  }
+
+  connection_.handle_->families.push_back(fam);
+  *info = new DataBaseInfo(name, false, 0);
+  return common::Error();
+}
+
+common::Error DBConnection::RemoveDBImpl(const std::string& name, IDataBaseInfo** info) {
+  common::Error err = TestIsWritable(DB_REMOVEDB_COMMAND);
+  if (err) {
+    return err;
+  }
+
+  ::rocksdb::ColumnFamilyHandle* fam = rocksdb_find_family(connection_.handle_, name);
+  if (!fam || fam == connection_.handle_->current) {
+    return ICommandTranslator::InvalidInputArguments(DB_REMOVEDB_COMMAND);
+  }
+
+  err = CheckResultCommand(DB_REMOVEDB_COMMAND, connection_.handle_->db->DropColumnFamily(fam));
+  if (err) {
+    return err;
+  }
+
+  std::vector< ::rocksdb::ColumnFamilyHandle*>& families = connection_.handle_->families;
+  families.erase(std::remove(families.begin(), families.end(), fam), families.end());
+  connection_.handle_->db->DestroyColumnFamilyHandle(fam);
+  *info = new DataBaseInfo(name, false, 0);
+  return common::Error();
 }
 
 common::Error DBConnection::SelectImpl(const std::string& name, IDataBaseInfo** info) {
-  if (name != GetCurrentDBName()) {
+  ::rocksdb::ColumnFamilyHandle* fam = rocksdb_find_family(connection_.handle_, name);
+  if (!fam) {
     return ICommandTranslator::InvalidInputArguments(DB_SELECTDB_COMMAND);
   }
 
+  if (fam != connection_.handle_->current) {
+    connection_.handle_->current = fam;
+    connection_.config_->db_name = name;
+    scan_cursors_.Clear();
+  }
+
   size_t kcount = 0;
-  common::Error err = DBkcount(&kcount);
+  common::Error err = DBkcount(&kcount, ESTIMATE_KEYS_COUNT);
   DCHECK(!err);
   *info = new DataBaseInfo(name, true, kcount);
   return common::Error();
 }
 
 common::Error DBConnection::SetImpl(const NDbKValue& key, NDbKValue* added_key) {
+  common::Error err = TestIsWritable(DB_SET_KEY_COMMAND);
+  if (err) {
+    return err;
+  }
+
   const NKey cur = key.GetKey();
   key_t key_str = cur.GetKey();
   std::string value_str = key.GetValueString();
-  common::Error err = SetInner(key_str, value_str);
+  err = SetInner(key_str, value_str);
   if (err) {
     return err;
   }
@@ -426,24 +725,68 @@ common::Error DBConnection::GetImpl(const NKey& key, NDbKValue* loaded_key) {
 }
 
 common::Error DBConnection::DeleteImpl(const NKeys& keys, NKeys* deleted_keys) {
-  for (size_t i = 0; i < keys.size(); ++i) {
-    NKey key = keys[i];
-    key_t key_str = key.GetKey();
-    common::Error err = DelInner(key_str);
-    if (err) {
+  common::Error err = TestIsWritable(DB_DELETE_KEY_COMMAND);
+  if (err) {
+    return err;
+  }
+
+  // existence by MultiGet, then one WriteBatch per DELETE_BATCH_SIZE keys
+  ::rocksdb::ReadOptions ro;
+  ::rocksdb::WriteOptions wo;
+  for (size_t start = 0; start < keys.size(); start += DELETE_BATCH_SIZE) {
+    const size_t end = std::min(keys.size(), start + DELETE_BATCH_SIZE);
+    std::vector<string_key_t> keys_data;  // slices point into it
+    keys_data.reserve(end - start);
+    std::vector< ::rocksdb::Slice> rslice;
+    rslice.reserve(end - start);
+    for (size_t i = start; i < end; ++i) {
+      keys_data.push_back(keys[i].GetKey().GetKeyData());
+      const string_key_t& key_str = keys_data.back();
+      rslice.push_back(::rocksdb::Slice(reinterpret_cast<const char*>(key_str.data()), key_str.size()));
+    }
+
+    std::vector<std::string> values;
+    const std::vector< ::rocksdb::ColumnFamilyHandle*> families(rslice.size(), connection_.handle_->current);
+    auto sts = connection_.handle_->db->MultiGet(ro, families, rslice, &values);
+    ::rocksdb::WriteBatch batch;
+    NKeys batch_keys;
+    for (size_t i = 0; i < sts.size(); ++i) {
+      if (sts[i].IsNotFound()) {
+        continue;
+      }
+
+      err = CheckResultCommand(DB_DELETE_KEY_COMMAND, sts[i]);
+      if (err) {
+        return err;
+      }
+
+      batch.Delete(connection_.handle_->current, rslice[i]);
+      batch_keys.push_back(keys[start + i]);
+    }
+
+    if (batch_keys.empty()) {
       continue;
     }
 
-    deleted_keys->push_back(key);
+    err = CheckResultCommand(DB_DELETE_KEY_COMMAND, connection_.handle_->db->Write(wo, &batch));
+    if (err) {
+      return err;
+    }
+    deleted_keys->insert(deleted_keys->end(), batch_keys.begin(), batch_keys.end());
   }
 
   return common::Error();
 }
 
 common::Error DBConnection::RenameImpl(const NKey& key, string_key_t new_key) {
+  common::Error err = TestIsWritable(DB_RENAME_KEY_COMMAND);
+  if (err) {
+    return err;
+  }
+
   key_t key_str = key.GetKey();
   std::string value_str;
-  common::Error err = GetInner(key_str, &value_str);
+  err = GetInner(key_str, &value_str);
   if (err) {
     return err;
   }
@@ -478,6 +821,25 @@ common::Error DBConnection::CheckResultCommand(const std::string& cmd, const ::r
   return common::Error();
 }
 
+common::Error DBConnection::TestIsWritable(const std::string& cmd) {
+  const config_t conf = GetConfig();
+  if (conf->open_mode != OPEN_READ_WRITE) {
+    return GenerateError(cmd, common::MemSPrintf("Not allowed, database is opened in %s mode",
+                                                 common::ConvertToString(conf->open_mode)));
+  }
+
+  return common::Error();
+}
+
+common::Error DBConnection::CatchUpWithPrimary(const std::string& cmd) {
+  if (!connection_.handle_->secondary) {
+    return common::Error();
+  }
+
+  // replays new manifest and wal records of primary, column families created after open are not visible
+  return CheckResultCommand(cmd, connection_.handle_->db->TryCatchUpWithPrimary());
+}
+
 }  // namespace rocksdb
 }  // namespace core
 }  // namespace fastonosql
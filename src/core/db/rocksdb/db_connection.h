@@ -18,13 +18,13 @@
 
 #pragma once
 
+#include "core/internal/backup.h"  // for backup_progress_callback_t
 #include "core/internal/cdb_connection.h"
 
 #include "core/db/rocksdb/config.h"
 #include "core/db/rocksdb/server_info.h"
 
 namespace rocksdb {
-class DB;
 class Status;
 }  // namespace rocksdb
 
@@ -32,7 +32,8 @@ namespace fastonosql {
 namespace core {
 namespace rocksdb {
 
-typedef ::rocksdb::DB NativeConnection;
+struct rocksdb;
+typedef rocksdb NativeConnection;
 
 common::Error CreateConnection(const Config& config, NativeConnection** context);
 common::Error TestConnection(const Config& config);
@@ -45,11 +46,16 @@ class DBConnection : public core::internal::CDBConnection<NativeConnection, Conf
   virtual std::string GetCurrentDBName() const override;
 
   common::Error Info(const std::string& args, ServerInfo::Stats* statsout) WARN_UNUSED_RESULT;
+  common::Error Backup(const std::string& path, internal::backup_progress_callback_t progress) WARN_UNUSED_RESULT;
+  common::Error Restore(const std::string& path, internal::backup_progress_callback_t progress) WARN_UNUSED_RESULT;
   common::Error Mget(const std::vector<std::string>& keys, std::vector<std::string>* ret);
   common::Error Merge(const std::string& key, const std::string& value) WARN_UNUSED_RESULT;
+  common::Error ConfigGetDatabases(std::vector<std::string>* dbs) WARN_UNUSED_RESULT;  // column families
 
  private:
   common::Error CheckResultCommand(const std::string& cmd, const ::rocksdb::Status& err) WARN_UNUSED_RESULT;
+  common::Error CatchUpWithPrimary(const std::string& cmd) WARN_UNUSED_RESULT;  // only for secondary instance
+  common::Error TestIsWritable(const std::string& cmd) WARN_UNUSED_RESULT;  // read only and secondary are not
 
   common::Error SetInner(key_t key, const std::string& value) WARN_UNUSED_RESULT;
   common::Error GetInner(key_t key, std::string* ret_val) WARN_UNUSED_RESULT;
@@ -65,7 +71,10 @@ class DBConnection : public core::internal::CDBConnection<NativeConnection, Conf
                                  uint64_t limit,
                                  std::vector<std::string>* ret) override;
   virtual common::Error DBkcountImpl(size_t* size) override;
+  virtual common::Error DBkcountEstimateImpl(size_t* size) override;
   virtual common::Error FlushDBImpl() override;
+  virtual common::Error CreateDBImpl(const std::string& name, IDataBaseInfo** info) override;
+  virtual common::Error RemoveDBImpl(const std::string& name, IDataBaseInfo** info) override;
   virtual common::Error SelectImpl(const std::string& name, IDataBaseInfo** info) override;
   virtual common::Error SetImpl(const NDbKValue& key, NDbKValue* added_key) override;
   virtual common::Error GetImpl(const NKey& key, NDbKValue* loaded_key) override;
@@ -42,6 +42,33 @@ const internal::ConstantCommandsArray g_commands = {CommandHolder(DB_HELP_COMMAN
                                                                   1,
                                                                   CommandInfo::Native,
                                                                   &CommandsApi::Info),
+                                                    CommandHolder("CONFIG GET",
+                                                                  "<parameter>",
+                                                                  "Get the value of a configuration parameter",
+                                                                  UNDEFINED_SINCE,
+                                                                  UNDEFINED_EXAMPLE_STR,
+                                                                  1,
+                                                                  0,
+                                                                  CommandInfo::Native,
+                                                                  &CommandsApi::ConfigGet),
+                                                    CommandHolder(DB_CREATEDB_COMMAND,
+                                                                  "<name>",
+                                                                  "Create database",
+                                                                  UNDEFINED_SINCE,
+                                                                  UNDEFINED_EXAMPLE_STR,
+                                                                  1,
+                                                                  0,
+                                                                  CommandInfo::Native,
+                                                                  &CommandsApi::CreateDatabase),
+                                                    CommandHolder(DB_REMOVEDB_COMMAND,
+                                                                  "<name>",
+                                                                  "Remove database",
+                                                                  UNDEFINED_SINCE,
+                                                                  UNDEFINED_EXAMPLE_STR,
+                                                                  1,
+                                                                  0,
+                                                                  CommandInfo::Native,
+                                                                  &CommandsApi::RemoveDatabase),
                                                     CommandHolder(DB_SCAN_COMMAND,
                                                                   "<cursor> [MATCH pattern] [COUNT count]",
                                                                   "Incrementally iterate the keys space",
@@ -154,7 +181,7 @@ const internal::ConstantCommandsArray g_commands = {CommandHolder(DB_HELP_COMMAN
                                                                   CommandInfo::Native,
                                                                   &CommandsApi::Quit)};
 
-common::Error CommandsApi::Info(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Info(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* rocks = static_cast<DBConnection*>(handler);
   ServerInfo::Stats statsout;
   common::Error err = rocks->Info(argv.size() == 1 ? argv[0] : std::string(), &statsout);
@@ -168,7 +195,26 @@ common::Error CommandsApi::Info(internal::CommandHandler* handler, commands_args
   return common::Error();
 }
 
-common::Error CommandsApi::Mget(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::ConfigGet(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
+  DBConnection* rocks = static_cast<DBConnection*>(handler);
+  if (argv[0] != "databases") {
+    return common::make_error_inval();
+  }
+
+  std::vector<std::string> dbs;
+  common::Error err = rocks->ConfigGetDatabases(&dbs);
+  if (err) {
+    return err;
+  }
+
+  common::ArrayValue* arr = new common::ArrayValue;
+  arr->AppendStrings(dbs);
+  FastoObject* child = new FastoObject(out, arr, rocks->GetDelimiter());
+  out->AddChildren(child);
+  return common::Error();
+}
+
+common::Error CommandsApi::Mget(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* rocks = static_cast<DBConnection*>(handler);
   std::vector<std::string> keysget;
   for (size_t i = 0; i < argv.size(); ++i) {
@@ -191,7 +237,7 @@ common::Error CommandsApi::Mget(internal::CommandHandler* handler, commands_args
   return common::Error();
 }
 
-common::Error CommandsApi::Merge(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Merge(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* rocks = static_cast<DBConnection*>(handler);
   common::Error err = rocks->Merge(argv[0], argv[1]);
   if (err) {
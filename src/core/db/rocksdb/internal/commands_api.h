@@ -26,9 +26,10 @@ namespace rocksdb {
 
 class DBConnection;
 struct CommandsApi : public internal::ApiTraits<DBConnection> {
-  static common::Error Info(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out);
-  static common::Error Mget(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out);
-  static common::Error Merge(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out);
+  static common::Error Info(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out);
+  static common::Error ConfigGet(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out);
+  static common::Error Mget(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out);
+  static common::Error Merge(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out);
 };
 
 extern const internal::ConstantCommandsArray g_commands;
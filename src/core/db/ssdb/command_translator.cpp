@@ -18,7 +18,10 @@
 
 #include "core/db/ssdb/command_translator.h"
 
+#include <common/convert2string.h>
+
 #include "core/connection_types.h"
+#include "core/value.h"  // for ConvertValueToArgs
 
 #define SSDB_SET_KEY_COMMAND DB_SET_KEY_COMMAND
 #define SSDB_SET_KEY_ARRAY_COMMAND "LPUSH"
@@ -47,64 +50,56 @@ const char* CommandTranslator::GetDBName() const {
   return ConnectionTraits<SSDB>::GetDBName();
 }
 
-common::Error CommandTranslator::CreateKeyCommandImpl(const NDbKValue& key, command_buffer_t* cmdstring) const {
-  command_buffer_writer_t wr;
+common::Error CommandTranslator::CreateKeyCommandImpl(const NDbKValue& key, commands_args_t* argv) const {
   const NKey cur = key.GetKey();
   key_t key_str = cur.GetKey();
-  std::string value_str = key.GetValueForCommandLine();
   common::Value::Type type = key.GetType();
+  const char* command = SSDB_SET_KEY_COMMAND;
   if (type == common::Value::TYPE_ARRAY) {
-    wr << SSDB_SET_KEY_ARRAY_COMMAND " " << key_str.GetKeyForCommandLine() << " " << value_str;
+    command = SSDB_SET_KEY_ARRAY_COMMAND;
   } else if (type == common::Value::TYPE_SET) {
-    wr << SSDB_SET_KEY_SET_COMMAND " " << key_str.GetKeyForCommandLine() << " " << value_str;
+    command = SSDB_SET_KEY_SET_COMMAND;
   } else if (type == common::Value::TYPE_ZSET) {
-    wr << SSDB_SET_KEY_ZSET_COMMAND " " << key_str.GetKeyForCommandLine() << " " << value_str;
+    command = SSDB_SET_KEY_ZSET_COMMAND;
   } else if (type == common::Value::TYPE_HASH) {
-    wr << SSDB_SET_KEY_HASH_COMMAND " " << key_str.GetKeyForCommandLine() << " " << value_str;
-  } else {
-    wr << SSDB_SET_KEY_COMMAND " " << key_str.GetKeyForCommandLine() << " " << value_str;
+    command = SSDB_SET_KEY_HASH_COMMAND;
   }
 
-  *cmdstring = wr.str();
+  *argv = {command, key_str.GetKeyData()};
+  ConvertValueToArgs(key.GetValue().get(), argv);  // elements as separate arguments
   return common::Error();
 }
 
 common::Error CommandTranslator::LoadKeyCommandImpl(const NKey& key,
                                                     common::Value::Type type,
-                                                    command_buffer_t* cmdstring) const {
-  command_buffer_writer_t wr;
+                                                    commands_args_t* argv) const {
   key_t key_str = key.GetKey();
   if (type == common::Value::TYPE_ARRAY) {
-    wr << SSDB_GET_KEY_ARRAY_COMMAND " " << key_str.GetKeyForCommandLine() << " 0 -1";
+    *argv = {SSDB_GET_KEY_ARRAY_COMMAND, key_str.GetKeyData(), "0", "-1"};
   } else if (type == common::Value::TYPE_SET) {
-    wr << SSDB_GET_KEY_SET_COMMAND " " << key_str.GetKeyForCommandLine();
+    *argv = {SSDB_GET_KEY_SET_COMMAND, key_str.GetKeyData()};
   } else if (type == common::Value::TYPE_ZSET) {
-    wr << SSDB_GET_KEY_ZSET_COMMAND " " << key_str.GetKeyForCommandLine() << " 0 -1";
+    *argv = {SSDB_GET_KEY_ZSET_COMMAND, key_str.GetKeyData(), "0", "-1"};
   } else if (type == common::Value::TYPE_HASH) {
-    wr << SSDB_GET_KEY_HASH_COMMAND " " << key_str.GetKeyForCommandLine();
+    *argv = {SSDB_GET_KEY_HASH_COMMAND, key_str.GetKeyData()};
   } else {
-    wr << SSDB_GET_KEY_COMMAND " " << key_str.GetKeyForCommandLine();
+    *argv = {SSDB_GET_KEY_COMMAND, key_str.GetKeyData()};
   }
 
-  *cmdstring = wr.str();
   return common::Error();
 }
 
-common::Error CommandTranslator::DeleteKeyCommandImpl(const NKey& key, command_buffer_t* cmdstring) const {
+common::Error CommandTranslator::DeleteKeyCommandImpl(const NKey& key, commands_args_t* argv) const {
   key_t key_str = key.GetKey();
-  command_buffer_writer_t wr;
-  wr << SSDB_DELETE_KEY_COMMAND " " << key_str.GetKeyForCommandLine();
-  *cmdstring = wr.str();
+  *argv = {SSDB_DELETE_KEY_COMMAND, key_str.GetKeyData()};
   return common::Error();
 }
 
 common::Error CommandTranslator::RenameKeyCommandImpl(const NKey& key,
                                                       const key_t& new_name,
-                                                      command_buffer_t* cmdstring) const {
+                                                      commands_args_t* argv) const {
   key_t key_str = key.GetKey();
-  command_buffer_writer_t wr;
-  wr << SSDB_RENAME_KEY_COMMAND " " << key_str.GetKeyForCommandLine() << " " << new_name.GetKeyForCommandLine();
-  *cmdstring = wr.str();
+  *argv = {SSDB_RENAME_KEY_COMMAND, key_str.GetKeyData(), new_name.GetKeyData()};
   return common::Error();
 }
 
@@ -114,21 +109,15 @@ bool CommandTranslator::IsLoadKeyCommandImpl(const CommandInfo& cmd) const {
          cmd.IsEqualName(SSDB_GET_KEY_HASH_COMMAND);
 }
 
-common::Error CommandTranslator::ChangeKeyTTLCommandImpl(const NKey& key,
-                                                         ttl_t ttl,
-                                                         command_buffer_t* cmdstring) const {
+common::Error CommandTranslator::ChangeKeyTTLCommandImpl(const NKey& key, ttl_t ttl, commands_args_t* argv) const {
   key_t key_str = key.GetKey();
-  command_buffer_writer_t wr;
-  wr << SSDB_CHANGE_TTL_COMMAND " " << key_str.GetKeyForCommandLine() << " " << ttl;
-  *cmdstring = wr.str();
+  *argv = {SSDB_CHANGE_TTL_COMMAND, key_str.GetKeyData(), common::ConvertToString(ttl)};
   return common::Error();
 }
 
-common::Error CommandTranslator::LoadKeyTTLCommandImpl(const NKey& key, command_buffer_t* cmdstring) const {
+common::Error CommandTranslator::LoadKeyTTLCommandImpl(const NKey& key, commands_args_t* argv) const {
   key_t key_str = key.GetKey();
-  command_buffer_writer_t wr;
-  wr << SSDB_GET_TTL_COMMAND " " << key_str.GetKeyForCommandLine();
-  *cmdstring = wr.str();
+  *argv = {SSDB_GET_TTL_COMMAND, key_str.GetKeyData()};
   return common::Error();
 }
 
@@ -30,19 +30,19 @@ class CommandTranslator : public ICommandTranslatorBase {
   virtual const char* GetDBName() const override;
 
  private:
-  virtual common::Error CreateKeyCommandImpl(const NDbKValue& key, command_buffer_t* cmdstring) const override;
+  virtual common::Error CreateKeyCommandImpl(const NDbKValue& key, commands_args_t* argv) const override;
   virtual common::Error LoadKeyCommandImpl(const NKey& key,
                                            common::Value::Type type,
-                                           command_buffer_t* cmdstring) const override;
-  virtual common::Error DeleteKeyCommandImpl(const NKey& key, command_buffer_t* cmdstring) const override;
+                                           commands_args_t* argv) const override;
+  virtual common::Error DeleteKeyCommandImpl(const NKey& key, commands_args_t* argv) const override;
   virtual common::Error RenameKeyCommandImpl(const NKey& key,
                                              const key_t& new_name,
-                                             command_buffer_t* cmdstring) const override;
+                                             commands_args_t* argv) const override;
 
   virtual bool IsLoadKeyCommandImpl(const CommandInfo& cmd) const override;
 
-  virtual common::Error ChangeKeyTTLCommandImpl(const NKey& key, ttl_t ttl, command_buffer_t* cmdstring) const override;
-  virtual common::Error LoadKeyTTLCommandImpl(const NKey& key, command_buffer_t* cmdstring) const override;
+  virtual common::Error ChangeKeyTTLCommandImpl(const NKey& key, ttl_t ttl, commands_args_t* argv) const override;
+  virtual common::Error LoadKeyTTLCommandImpl(const NKey& key, commands_args_t* argv) const override;
 };
 
 }  // namespace ssdb
@@ -20,6 +20,8 @@
 
 #include <SSDB.h>  // for Status, Client
 
+#include <algorithm>
+
 #include "core/db/ssdb/command_translator.h"
 #include "core/db/ssdb/database_info.h"
 #include "core/db/ssdb/internal/commands_api.h"
@@ -39,6 +41,8 @@ namespace {
 std::string ConvertToSSDBSlice(const key_t& key) {
   return key.GetKeyData();
 }
+
+const uint64_t keys_batch_size = 1000;  // keys per request for paging over whole keyspace
 }  // namespace
 namespace internal {
 template <>
@@ -878,30 +882,45 @@ common::Error DBConnection::ScanImpl(uint64_t cursor_in,
                                      uint64_t count_keys,
                                      std::vector<std::string>* keys_out,
                                      uint64_t* cursor_out) {
-  std::vector<std::string> ret;
-  common::Error err =
-      CheckResultCommand(DB_SCAN_COMMAND, connection_.handle_->keys(std::string(), std::string(), count_keys, &ret));
-  if (err) {
-    return err;
-  }
-
-  uint64_t offset_pos = cursor_in;
+  // keys are ordered, so next page continues after last returned key
+  std::string key_start;
+  bool is_resumed = scan_cursors_.Find(cursor_in, pattern, &key_start);
+  uint64_t offset_pos = is_resumed ? 0 : cursor_in;
   uint64_t lcursor_out = 0;
   std::vector<std::string> lkeys_out;
-  for (size_t i = 0; i < ret.size(); ++i) {
-    std::string key = ret[i];
-    if (lkeys_out.size() < count_keys) {
-      if (common::MatchPattern(key, pattern)) {
-        if (offset_pos == 0) {
-          lkeys_out.push_back(key);
-        } else {
-          offset_pos--;
+  const uint64_t batch_size = std::max(count_keys, keys_batch_size);
+  while (lcursor_out == 0) {
+    std::vector<std::string> ret;
+    common::Error err =
+        CheckResultCommand(DB_SCAN_COMMAND, connection_.handle_->keys(key_start, std::string(), batch_size, &ret));
+    if (err) {
+      return err;
+    }
+
+    for (size_t i = 0; i < ret.size(); ++i) {
+      std::string key = ret[i];
+      if (lkeys_out.size() < count_keys) {
+        if (common::MatchPattern(key, pattern)) {
+          if (offset_pos == 0) {
+            lkeys_out.push_back(key);
+          } else {
+            offset_pos--;
+          }
         }
+      } else {
+        lcursor_out = cursor_in + count_keys;
+        break;
       }
-    } else {
-      lcursor_out = cursor_in + count_keys;
+    }
+
+    if (ret.size() < batch_size) {
       break;
     }
+    key_start = ret.back();
+  }
+
+  if (lcursor_out != 0 && !lkeys_out.empty()) {
+    scan_cursors_.Register(lcursor_out, pattern, lkeys_out.back());
   }
 
   *keys_out = lkeys_out;
@@ -917,28 +936,74 @@ common::Error DBConnection::KeysImpl(const std::string& key_start,
 }
 
 common::Error DBConnection::DBkcountImpl(size_t* size) {
-  std::vector<std::string> ret;
-  common::Error err = CheckResultCommand(DB_DBKCOUNT_COMMAND,
-                                         connection_.handle_->keys(std::string(), std::string(), UINT64_MAX, &ret));
-  if (err) {
-    return err;
+  // ssdb dbsize is size of data in bytes, so keys are counted by pages without holding them
+  size_t count = 0;
+  std::string key_start;
+  while (true) {
+    std::vector<std::string> ret;
+    common::Error err = CheckResultCommand(
+        DB_DBKCOUNT_COMMAND, connection_.handle_->keys(key_start, std::string(), keys_batch_size, &ret));
+    if (err) {
+      return err;
+    }
+
+    count += ret.size();
+    if (ret.size() < keys_batch_size) {
+      break;
+    }
+    key_start = ret.back();
   }
 
-  *size = ret.size();
+  *size = count;
   return common::Error();
 }
 
-common::Error DBConnection::FlushDBImpl() {
-  std::vector<std::string> ret;
-  common::Error err =
-      CheckResultCommand(DB_FLUSHDB_COMMAND, connection_.handle_->keys(std::string(), std::string(), 0, &ret));
+common::Error DBConnection::DBkcountEstimateImpl(size_t* size) {
+  // one page of key, value pairs gives bytes per key, dbsize divided by it gives approximate count
+  std::vector<std::string> kvs;
+  common::Error err = CheckResultCommand(
+      DB_DBKCOUNT_COMMAND, connection_.handle_->scan(std::string(), std::string(), keys_batch_size, &kvs));
+  if (err) {
+    return err;
+  }
+
+  const size_t sampled = kvs.size() / 2;
+  if (sampled < keys_batch_size) {  // whole keyspace in sample
+    *size = sampled;
+    return common::Error();
+  }
+
+  uint64_t sampled_bytes = 0;
+  for (size_t i = 0; i < kvs.size(); ++i) {
+    sampled_bytes += kvs[i].size();
+  }
+
+  int64_t db_bytes = 0;
+  err = CheckResultCommand(DB_DBKCOUNT_COMMAND, connection_.handle_->dbsize(&db_bytes));
   if (err) {
     return err;
   }
 
-  for (size_t i = 0; i < ret.size(); ++i) {
-    key_t key(ret[i]);
-    common::Error err = DelInner(key);
+  const uint64_t estimated =
+      db_bytes > 0 && sampled_bytes ? static_cast<uint64_t>(db_bytes) * sampled / sampled_bytes : 0;
+  *size = std::max<uint64_t>(estimated, sampled);  // dbsize misses data not yet flushed to disk
+  return common::Error();
+}
+
+common::Error DBConnection::FlushDBImpl() {
+  while (true) {
+    std::vector<std::string> ret;
+    common::Error err = CheckResultCommand(
+        DB_FLUSHDB_COMMAND, connection_.handle_->keys(std::string(), std::string(), keys_batch_size, &ret));
+    if (err) {
+      return err;
+    }
+
+    if (ret.empty()) {
+      break;
+    }
+
+    err = CheckResultCommand(DB_FLUSHDB_COMMAND, connection_.handle_->multi_del(ret));
     if (err) {
       return err;
     }
@@ -960,15 +1025,44 @@ common::Error DBConnection::SelectImpl(const std::string& name, IDataBaseInfo**
 }
 
 common::Error DBConnection::DeleteImpl(const NKeys& keys, NKeys* deleted_keys) {
-  for (size_t i = 0; i < keys.size(); ++i) {
-    NKey key = keys[i];
-    key_t key_str = key.GetKey();
-    common::Error err = DelInner(key_str);
+  // multi_get to find existing keys, then multi_del per DELETE_BATCH_SIZE keys
+  for (size_t start = 0; start < keys.size(); start += DELETE_BATCH_SIZE) {
+    const size_t end = std::min(keys.size(), start + DELETE_BATCH_SIZE);
+    std::vector<std::string> keys_str;
+    std::map<std::string, size_t> indexes;
+    for (size_t i = start; i < end; ++i) {
+      const std::string key_str = keys[i].GetKey().GetKeyData();
+      keys_str.push_back(key_str);
+      indexes[key_str] = i;
+    }
+
+    std::vector<std::string> kvs;  // key, value pairs of existing keys
+    common::Error err = CheckResultCommand(DB_DELETE_KEY_COMMAND, connection_.handle_->multi_get(keys_str, &kvs));
     if (err) {
+      return err;
+    }
+
+    std::vector<std::string> exist_keys;
+    NKeys batch_keys;
+    for (size_t i = 0; i + 1 < kvs.size(); i += 2) {
+      auto it = indexes.find(kvs[i]);
+      if (it == indexes.end()) {
+        continue;
+      }
+
+      exist_keys.push_back(kvs[i]);
+      batch_keys.push_back(keys[it->second]);
+    }
+
+    if (exist_keys.empty()) {
       continue;
     }
 
-    deleted_keys->push_back(key);
+    err = CheckResultCommand(DB_DELETE_KEY_COMMAND, connection_.handle_->multi_del(exist_keys));
+    if (err) {
+      return err;
+    }
+    deleted_keys->insert(deleted_keys->end(), batch_keys.begin(), batch_keys.end());
   }
 
   return common::Error();
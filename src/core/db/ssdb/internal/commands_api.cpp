@@ -594,7 +594,7 @@ const internal::ConstantCommandsArray g_commands = {CommandHolder(DB_HELP_COMMAN
                                                                   CommandInfo::Native,
                                                                   &CommandsApi::DBsize)};
 
-common::Error CommandsApi::Info(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Info(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   ServerInfo::Stats statsout;
   common::Error err = ssdb->Info(argv.size() == 1 ? argv[0] : std::string(), &statsout);
@@ -609,7 +609,7 @@ common::Error CommandsApi::Info(internal::CommandHandler* handler, commands_args
   return common::Error();
 }
 
-common::Error CommandsApi::ScanSSDB(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::ScanSSDB(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   uint64_t limit;
   if (!common::ConvertFromString(argv[2], &limit)) {
@@ -631,7 +631,7 @@ common::Error CommandsApi::ScanSSDB(internal::CommandHandler* handler, commands_
   return common::Error();
 }
 
-common::Error CommandsApi::DBsize(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::DBsize(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   UNUSED(argv);
 
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
@@ -647,7 +647,7 @@ common::Error CommandsApi::DBsize(internal::CommandHandler* handler, commands_ar
   return common::Error();
 }
 
-common::Error CommandsApi::Auth(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Auth(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   common::Error err = ssdb->Auth(argv[0]);
   if (err) {
@@ -660,7 +660,7 @@ common::Error CommandsApi::Auth(internal::CommandHandler* handler, commands_args
   return common::Error();
 }
 
-common::Error CommandsApi::Setx(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Setx(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   ttl_t ttl;
   if (!common::ConvertFromString(argv[2], &ttl)) {
@@ -677,7 +677,7 @@ common::Error CommandsApi::Setx(internal::CommandHandler* handler, commands_args
   return common::Error();
 }
 
-common::Error CommandsApi::Incr(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Incr(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   int64_t incrby;
   if (!common::ConvertFromString(argv[1], &incrby)) {
@@ -695,7 +695,7 @@ common::Error CommandsApi::Incr(internal::CommandHandler* handler, commands_args
   return common::Error();
 }
 
-common::Error CommandsApi::Rscan(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Rscan(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   uint64_t limit;
   if (!common::ConvertFromString(argv[2], &limit)) {
@@ -717,7 +717,7 @@ common::Error CommandsApi::Rscan(internal::CommandHandler* handler, commands_arg
   return common::Error();
 }
 
-common::Error CommandsApi::MultiGet(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::MultiGet(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   std::vector<std::string> keysget;
   for (size_t i = 0; i < argv.size(); ++i) {
@@ -740,7 +740,7 @@ common::Error CommandsApi::MultiGet(internal::CommandHandler* handler, commands_
   return common::Error();
 }
 
-common::Error CommandsApi::MultiSet(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::MultiSet(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   std::map<std::string, std::string> keysset;
   for (size_t i = 0; i < argv.size(); i += 2) {
@@ -758,7 +758,7 @@ common::Error CommandsApi::MultiSet(internal::CommandHandler* handler, commands_
   return common::Error();
 }
 
-common::Error CommandsApi::MultiDel(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::MultiDel(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   std::vector<std::string> keysget;
   for (size_t i = 0; i < argv.size(); ++i) {
@@ -776,7 +776,7 @@ common::Error CommandsApi::MultiDel(internal::CommandHandler* handler, commands_
   return common::Error();
 }
 
-common::Error CommandsApi::Hget(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Hget(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   std::string ret;
   common::Error err = ssdb->Hget(argv[0], argv[1], &ret);
@@ -790,7 +790,7 @@ common::Error CommandsApi::Hget(internal::CommandHandler* handler, commands_args
   return common::Error();
 }
 
-common::Error CommandsApi::Hgetall(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Hgetall(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   std::vector<std::string> keysout;
   common::Error err = ssdb->Hgetall(argv[0], &keysout);
@@ -808,7 +808,7 @@ common::Error CommandsApi::Hgetall(internal::CommandHandler* handler, commands_a
   return common::Error();
 }
 
-common::Error CommandsApi::Hset(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Hset(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   common::Error err = ssdb->Hset(argv[0], argv[1], argv[2]);
   if (err) {
@@ -821,7 +821,7 @@ common::Error CommandsApi::Hset(internal::CommandHandler* handler, commands_args
   return common::Error();
 }
 
-common::Error CommandsApi::Hdel(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Hdel(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   common::Error err = ssdb->Hdel(argv[0], argv[1]);
   if (err) {
@@ -834,7 +834,7 @@ common::Error CommandsApi::Hdel(internal::CommandHandler* handler, commands_args
   return common::Error();
 }
 
-common::Error CommandsApi::Hincr(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Hincr(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   int64_t incrby;
   if (!common::ConvertFromString(argv[2], &incrby)) {
@@ -852,7 +852,7 @@ common::Error CommandsApi::Hincr(internal::CommandHandler* handler, commands_arg
   return common::Error();
 }
 
-common::Error CommandsApi::Hsize(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Hsize(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   int64_t res = 0;
   common::Error err = ssdb->Hsize(argv[0], &res);
@@ -866,7 +866,7 @@ common::Error CommandsApi::Hsize(internal::CommandHandler* handler, commands_arg
   return common::Error();
 }
 
-common::Error CommandsApi::Hclear(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Hclear(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   int64_t res = 0;
   common::Error err = ssdb->Hclear(argv[0], &res);
@@ -880,7 +880,7 @@ common::Error CommandsApi::Hclear(internal::CommandHandler* handler, commands_ar
   return common::Error();
 }
 
-common::Error CommandsApi::Hkeys(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Hkeys(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   uint64_t limit;
   if (!common::ConvertFromString(argv[3], &limit)) {
@@ -902,7 +902,7 @@ common::Error CommandsApi::Hkeys(internal::CommandHandler* handler, commands_arg
   return common::Error();
 }
 
-common::Error CommandsApi::Hscan(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Hscan(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   uint64_t limit;
   if (!common::ConvertFromString(argv[3], &limit)) {
@@ -924,7 +924,7 @@ common::Error CommandsApi::Hscan(internal::CommandHandler* handler, commands_arg
   return common::Error();
 }
 
-common::Error CommandsApi::Hrscan(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Hrscan(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   uint64_t limit;
   if (!common::ConvertFromString(argv[3], &limit)) {
@@ -946,7 +946,7 @@ common::Error CommandsApi::Hrscan(internal::CommandHandler* handler, commands_ar
   return common::Error();
 }
 
-common::Error CommandsApi::MultiHget(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::MultiHget(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   std::vector<std::string> keysget;
   for (size_t i = 1; i < argv.size(); ++i) {
@@ -969,7 +969,7 @@ common::Error CommandsApi::MultiHget(internal::CommandHandler* handler, commands
   return common::Error();
 }
 
-common::Error CommandsApi::MultiHset(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::MultiHset(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   std::map<std::string, std::string> keys;
   for (size_t i = 1; i < argv.size(); i += 2) {
@@ -987,7 +987,7 @@ common::Error CommandsApi::MultiHset(internal::CommandHandler* handler, commands
   return common::Error();
 }
 
-common::Error CommandsApi::Zget(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Zget(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   int64_t ret;
   common::Error err = ssdb->Zget(argv[0], argv[1], &ret);
@@ -1001,7 +1001,7 @@ common::Error CommandsApi::Zget(internal::CommandHandler* handler, commands_args
   return common::Error();
 }
 
-common::Error CommandsApi::Zset(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Zset(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   int64_t score;
   if (!common::ConvertFromString(argv[2], &score)) {
@@ -1019,7 +1019,7 @@ common::Error CommandsApi::Zset(internal::CommandHandler* handler, commands_args
   return common::Error();
 }
 
-common::Error CommandsApi::Zdel(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Zdel(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   common::Error err = ssdb->Zdel(argv[0], argv[1]);
   if (err) {
@@ -1032,7 +1032,7 @@ common::Error CommandsApi::Zdel(internal::CommandHandler* handler, commands_args
   return common::Error();
 }
 
-common::Error CommandsApi::Zincr(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Zincr(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   int64_t incrby;
   if (!common::ConvertFromString(argv[2], &incrby)) {
@@ -1051,7 +1051,7 @@ common::Error CommandsApi::Zincr(internal::CommandHandler* handler, commands_arg
   return common::Error();
 }
 
-common::Error CommandsApi::Zsize(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Zsize(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   int64_t res = 0;
   common::Error err = ssdb->Zsize(argv[0], &res);
@@ -1065,7 +1065,7 @@ common::Error CommandsApi::Zsize(internal::CommandHandler* handler, commands_arg
   return common::Error();
 }
 
-common::Error CommandsApi::Zclear(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Zclear(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   int64_t res = 0;
   common::Error err = ssdb->Zclear(argv[0], &res);
@@ -1079,7 +1079,7 @@ common::Error CommandsApi::Zclear(internal::CommandHandler* handler, commands_ar
   return common::Error();
 }
 
-common::Error CommandsApi::Zrank(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Zrank(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   int64_t res = 0;
   common::Error err = ssdb->Zrank(argv[0], argv[1], &res);
@@ -1093,7 +1093,7 @@ common::Error CommandsApi::Zrank(internal::CommandHandler* handler, commands_arg
   return common::Error();
 }
 
-common::Error CommandsApi::Zrrank(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Zrrank(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   int64_t res = 0;
   common::Error err = ssdb->Zrrank(argv[0], argv[1], &res);
@@ -1107,7 +1107,7 @@ common::Error CommandsApi::Zrrank(internal::CommandHandler* handler, commands_ar
   return common::Error();
 }
 
-common::Error CommandsApi::Zrange(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Zrange(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   uint64_t offset;
   if (!common::ConvertFromString(argv[1], &offset)) {
@@ -1135,7 +1135,7 @@ common::Error CommandsApi::Zrange(internal::CommandHandler* handler, commands_ar
   return common::Error();
 }
 
-common::Error CommandsApi::Zrrange(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Zrrange(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   uint64_t offset;
   if (!common::ConvertFromString(argv[1], &offset)) {
@@ -1163,7 +1163,7 @@ common::Error CommandsApi::Zrrange(internal::CommandHandler* handler, commands_a
   return common::Error();
 }
 
-common::Error CommandsApi::Zkeys(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Zkeys(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   std::vector<std::string> res;
   int64_t st;
@@ -1196,7 +1196,7 @@ common::Error CommandsApi::Zkeys(internal::CommandHandler* handler, commands_arg
   return common::Error();
 }
 
-common::Error CommandsApi::Zscan(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Zscan(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   std::vector<std::string> res;
   int64_t st;
@@ -1228,7 +1228,7 @@ common::Error CommandsApi::Zscan(internal::CommandHandler* handler, commands_arg
   return common::Error();
 }
 
-common::Error CommandsApi::Zrscan(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Zrscan(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   std::vector<std::string> res;
   int64_t st;
@@ -1260,7 +1260,7 @@ common::Error CommandsApi::Zrscan(internal::CommandHandler* handler, commands_ar
   return common::Error();
 }
 
-common::Error CommandsApi::MultiZget(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::MultiZget(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   std::vector<std::string> keysget;
   for (size_t i = 1; i < argv.size(); ++i) {
@@ -1283,7 +1283,7 @@ common::Error CommandsApi::MultiZget(internal::CommandHandler* handler, commands
   return common::Error();
 }
 
-common::Error CommandsApi::MultiZset(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::MultiZset(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   std::map<std::string, int64_t> keysget;
   for (size_t i = 1; i < argv.size(); i += 2) {
@@ -1304,7 +1304,7 @@ common::Error CommandsApi::MultiZset(internal::CommandHandler* handler, commands
   return common::Error();
 }
 
-common::Error CommandsApi::MultiZdel(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::MultiZdel(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   std::vector<std::string> keysget;
   for (size_t i = 1; i < argv.size(); ++i) {
@@ -1322,7 +1322,7 @@ common::Error CommandsApi::MultiZdel(internal::CommandHandler* handler, commands
   return common::Error();
 }
 
-common::Error CommandsApi::Qpush(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Qpush(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   common::Error err = ssdb->Qpush(argv[0], argv[1]);
   if (err) {
@@ -1335,7 +1335,7 @@ common::Error CommandsApi::Qpush(internal::CommandHandler* handler, commands_arg
   return common::Error();
 }
 
-common::Error CommandsApi::Qpop(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Qpop(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   std::string ret;
   common::Error err = ssdb->Qpop(argv[0], &ret);
@@ -1349,7 +1349,7 @@ common::Error CommandsApi::Qpop(internal::CommandHandler* handler, commands_args
   return common::Error();
 }
 
-common::Error CommandsApi::Qslice(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Qslice(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   int64_t begin;
   if (!common::ConvertFromString(argv[1], &begin)) {
@@ -1377,7 +1377,7 @@ common::Error CommandsApi::Qslice(internal::CommandHandler* handler, commands_ar
   return common::Error();
 }
 
-common::Error CommandsApi::Qclear(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Qclear(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* ssdb = static_cast<DBConnection*>(handler);
   int64_t res = 0;
   common::Error err = ssdb->Qclear(argv[0], &res);
@@ -235,11 +235,20 @@ common::Error DBConnection::ScanImpl(uint64_t cursor_in,
   if (err) {
     return err;
   }
-  /* Point to the first record */
-  unqlite_kv_cursor_first_entry(pCur);
+  std::string last_key;
+  bool is_resumed = scan_cursors_.Find(cursor_in, pattern, &last_key);
+  if (is_resumed && unqlite_kv_cursor_seek(pCur, last_key.data(), static_cast<int>(last_key.size()),
+                                           UNQLITE_CURSOR_MATCH_EXACT) == UNQLITE_OK) {
+    /* Point to the record after the last returned one */
+    unqlite_kv_cursor_next_entry(pCur);
+  } else {
+    /* Point to the first record */
+    is_resumed = false;
+    unqlite_kv_cursor_first_entry(pCur);
+  }
 
   /* Iterate over the entries */
-  uint64_t offset_pos = cursor_in;
+  uint64_t offset_pos = is_resumed ? 0 : cursor_in;
   uint64_t lcursor_out = 0;
   std::vector<std::string> lkeys_out;
   while (unqlite_kv_cursor_valid_entry(pCur)) {
@@ -264,6 +273,10 @@ common::Error DBConnection::ScanImpl(uint64_t cursor_in,
   /* Finally, Release our cursor */
   unqlite_kv_cursor_release(connection_.handle_, pCur);
 
+  if (lcursor_out != 0 && !lkeys_out.empty()) {
+    scan_cursors_.Register(lcursor_out, pattern, lkeys_out.back());
+  }
+
   *keys_out = lkeys_out;
   *cursor_out = lcursor_out;
   return common::Error();
@@ -135,7 +135,7 @@ const internal::ConstantCommandsArray g_commands = {CommandHolder(DB_HELP_COMMAN
                                                                   CommandInfo::Native,
                                                                   &CommandsApi::Quit)};
 
-common::Error CommandsApi::Info(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error CommandsApi::Info(internal::CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   DBConnection* unq = static_cast<DBConnection*>(handler);
   ServerInfo::Stats statsout;
   common::Error err = unq->Info(argv.size() == 1 ? argv[0] : std::string(), &statsout);
@@ -310,15 +310,35 @@ common::Error DBConnection::ScanImpl(uint64_t cursor_in,
     return err;
   }
 
-  ups_status_t st = UPS_SUCCESS;
-  uint64_t offset_pos = cursor_in;
+  std::string last_key;
+  bool is_resumed = scan_cursors_.Find(cursor_in, pattern, &last_key);
+  bool is_positioned = false;
+  if (is_resumed) {
+    /* position the cursor on the first key after the last returned one */
+    key.data = const_cast<char*>(last_key.data());
+    key.size = static_cast<uint16_t>(last_key.size());
+    ups_status_t fst = ups_cursor_find(cursor, &key, &rec, UPS_FIND_GT_MATCH);
+    if (fst == UPS_SUCCESS) {
+      is_positioned = true;
+    } else if (fst != UPS_KEY_NOT_FOUND) {
+      ups_cursor_close(cursor);
+      return CheckResultCommand(DB_SCAN_COMMAND, fst);
+    }
+  }
+
+  ups_status_t st = is_resumed && !is_positioned ? UPS_KEY_NOT_FOUND : UPS_SUCCESS;
+  uint64_t offset_pos = is_resumed ? 0 : cursor_in;
   uint64_t lcursor_out = 0;
   std::vector<std::string> lkeys_out;
   while (st == UPS_SUCCESS) {
     if (lkeys_out.size() < count_keys) {
       /* fetch the next item, and repeat till we've reached the end
        * of the database */
-      st = ups_cursor_move(cursor, &key, &rec, UPS_CURSOR_NEXT | UPS_SKIP_DUPLICATES);
+      if (is_positioned) {
+        is_positioned = false;
+      } else {
+        st = ups_cursor_move(cursor, &key, &rec, UPS_CURSOR_NEXT | UPS_SKIP_DUPLICATES);
+      }
       if (st == UPS_SUCCESS) {
         std::string skey(reinterpret_cast<const char*>(key.data), key.size);
         if (common::MatchPattern(skey, pattern)) {
@@ -340,6 +360,10 @@ common::Error DBConnection::ScanImpl(uint64_t cursor_in,
   }
 
   ups_cursor_close(cursor);
+  if (lcursor_out != 0 && !lkeys_out.empty()) {
+    scan_cursors_.Register(lcursor_out, pattern, lkeys_out.back());
+  }
+
   *keys_out = lkeys_out;
   *cursor_out = lcursor_out;
   return common::Error();
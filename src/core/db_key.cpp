@@ -81,6 +81,17 @@ bool KeyString::Equals(const KeyString& other) const {
   return key_ == other.key_;
 }
 
+command_buffer_t ConvertArgsToCommandLine(const commands_args_t& argv) {
+  command_buffer_t result;
+  for (size_t i = 0; i < argv.size(); ++i) {
+    if (i != 0) {
+      result += ' ';
+    }
+    result += argv[i].empty() ? command_buffer_t("\"\"") : KeyString(argv[i]).GetKeyForCommandLine();
+  }
+  return result;
+}
+
 NKey::NKey() : key_(), ttl_(NO_TTL) {}
 
 NKey::NKey(key_t key, ttl_t ttl_sec) : key_(key), ttl_(ttl_sec) {}
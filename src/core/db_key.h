@@ -69,6 +69,9 @@ inline bool operator!=(const KeyString& r, const KeyString& l) {
   return !(r == l);
 }
 
+// arguments joined by space, each escaped as GetKeyForCommandLine, empty as ""
+command_buffer_t ConvertArgsToCommandLine(const commands_args_t& argv);
+
 typedef KeyString key_t;
 
 class NKey {
@@ -26,13 +26,34 @@ namespace core {
 FastoObject::IFastoObjectObserver::~IFastoObjectObserver() {}
 
 FastoObject::FastoObject(FastoObject* parent, common::Value* val, const std::string& delimiter)
-    : observer_(nullptr), value_(val), parent_(parent), childrens_(), delimiter_(delimiter) {
+    : observer_(nullptr),
+      value_(val),
+      parent_(parent),
+      childrens_(),
+      childrens_limit_(0),
+      childrens_head_(0),
+      dropped_childrens_(0),
+      delimiter_(delimiter) {
   DCHECK(value_);
   if (parent_) {
     observer_ = parent_->observer_;
   }
 }
 
+FastoObject::FastoObject(FastoObject* parent, const std::string& delimiter)
+    : observer_(nullptr),
+      value_(),
+      parent_(parent),
+      childrens_(),
+      childrens_limit_(0),
+      childrens_head_(0),
+      dropped_childrens_(0),
+      delimiter_(delimiter) {
+  if (parent_) {
+    observer_ = parent_->observer_;
+  }
+}
+
 FastoObject::~FastoObject() {
   Clear();
 }
@@ -56,7 +77,15 @@ FastoObject* FastoObject::CreateRoot(const command_buffer_t& text, IFastoObjectO
 }
 
 FastoObject::childs_t FastoObject::GetChildrens() const {
-  return childrens_;
+  if (childrens_head_ == 0) {
+    return childrens_;
+  }
+
+  childs_t ordered;
+  ordered.reserve(childrens_.size());
+  ordered.insert(ordered.end(), childrens_.begin() + childrens_head_, childrens_.end());
+  ordered.insert(ordered.end(), childrens_.begin(), childrens_.begin() + childrens_head_);
+  return ordered;
 }
 
 void FastoObject::AddChildren(child_t child) {
@@ -65,18 +94,59 @@ void FastoObject::AddChildren(child_t child) {
   }
 
   CHECK(child->parent_ == this);
-  childrens_.push_back(child);
+  if (childrens_limit_ == 0 || childrens_.size() < childrens_limit_) {
+    childrens_.push_back(child);
+    if (observer_) {
+      observer_->ChildrenAdded(child);
+    }
+    return;
+  }
+
+  // overwrite oldest
+  child_t oldest = childrens_[childrens_head_];
+  childrens_[childrens_head_] = child;
+  childrens_head_ = (childrens_head_ + 1) % childrens_limit_;
+  dropped_childrens_++;
   if (observer_) {
+    observer_->ChildrenRemoved(oldest);
     observer_->ChildrenAdded(child);
   }
 }
 
+void FastoObject::SetChildrensLimit(size_t limit) {
+  childs_t ordered = GetChildrens();
+  childrens_head_ = 0;
+  childrens_limit_ = limit;
+  if (limit == 0 || ordered.size() <= limit) {
+    childrens_.swap(ordered);
+    return;
+  }
+
+  const size_t drop = ordered.size() - limit;
+  childrens_.assign(ordered.begin() + drop, ordered.end());
+  dropped_childrens_ += drop;
+  if (observer_) {
+    for (size_t i = 0; i < drop; ++i) {
+      observer_->ChildrenRemoved(ordered[i]);
+    }
+  }
+}
+
+size_t FastoObject::GetChildrensLimit() const {
+  return childrens_limit_;
+}
+
+uint64_t FastoObject::GetDroppedChildrensCount() const {
+  return dropped_childrens_;
+}
+
 FastoObject* FastoObject::GetParent() const {
   return parent_;
 }
 
 void FastoObject::Clear() {
   childrens_.clear();
+  childrens_head_ = 0;
 }
 
 std::string FastoObject::GetDelimiter() const {
@@ -99,7 +169,7 @@ FastoObjectCommand::FastoObjectCommand(FastoObject* parent,
                                        CmdLoggingType ct,
                                        const std::string& delimiter,
                                        core::connectionTypes type)
-    : FastoObject(parent, cmd, delimiter), type_(type), ct_(ct) {}
+    : FastoObject(parent, cmd, delimiter), type_(type), ct_(ct), error_() {}
 
 FastoObjectCommand::~FastoObjectCommand() {}
 
@@ -124,6 +194,14 @@ CmdLoggingType FastoObjectCommand::GetCommandLoggingType() const {
   return ct_;
 }
 
+common::Error FastoObjectCommand::GetError() const {
+  return error_;
+}
+
+void FastoObjectCommand::SetError(common::Error err) {
+  error_ = err;
+}
+
 }  // namespace core
 }  // namespace fastonosql
 
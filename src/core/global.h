@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <common/error.h>          // for Error
 #include <common/intrusive_ptr.h>  // for intrusive_ptr, etc
 #include <common/value.h>
 
@@ -49,6 +50,7 @@ class FastoObject : public common::intrusive_ptr_base<FastoObject> {
   class IFastoObjectObserver {
    public:
     virtual void ChildrenAdded(child_t child) = 0;
+    virtual void ChildrenRemoved(child_t child) = 0;
     virtual void Updated(FastoObject* item, value_t val) = 0;
     virtual ~IFastoObjectObserver();
   };
@@ -56,21 +58,27 @@ class FastoObject : public common::intrusive_ptr_base<FastoObject> {
   FastoObject(FastoObject* parent, common::Value* val, const std::string& delimiter);  // val take ownerships
   virtual ~FastoObject();
 
-  common::Value::Type GetType() const;
+  virtual common::Value::Type GetType() const;
   virtual std::string ToString() const;
 
   static FastoObject* CreateRoot(const command_buffer_t& text, IFastoObjectObserver* observer = nullptr);
 
-  childs_t GetChildrens() const;
+  childs_t GetChildrens() const;  // oldest first
   void AddChildren(child_t child);
+  // keep only last limit childrens (ring buffer), 0 - unlimited
+  void SetChildrensLimit(size_t limit);
+  size_t GetChildrensLimit() const;
+  uint64_t GetDroppedChildrensCount() const;
   FastoObject* GetParent() const;
   void Clear();
   std::string GetDelimiter() const;
 
-  value_t GetValue() const;
+  virtual value_t GetValue() const;
   void SetValue(value_t val);
 
  protected:
+  FastoObject(FastoObject* parent, const std::string& delimiter);  // value is provided by subclass
+
   IFastoObjectObserver* observer_;
   value_t value_;
 
@@ -79,6 +87,9 @@ class FastoObject : public common::intrusive_ptr_base<FastoObject> {
 
   FastoObject* const parent_;
   childs_t childrens_;
+  size_t childrens_limit_;
+  size_t childrens_head_;  // index of oldest child when ring is full
+  uint64_t dropped_childrens_;
   const std::string delimiter_;
 };
 
@@ -92,6 +103,9 @@ class FastoObjectCommand : public FastoObject {
   command_buffer_t GetInputCommand() const;
   CmdLoggingType GetCommandLoggingType() const;
 
+  common::Error GetError() const;  // of this command when it was executed in batch
+  void SetError(common::Error err);
+
  protected:
   FastoObjectCommand(FastoObject* parent,
                      common::StringValue* cmd,
@@ -104,6 +118,7 @@ class FastoObjectCommand : public FastoObject {
 
   const core::connectionTypes type_;
   const CmdLoggingType ct_;
+  common::Error error_;
 };
 
 }  // namespace core
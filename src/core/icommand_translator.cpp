@@ -18,12 +18,11 @@
 
 #include "core/icommand_translator.h"
 
-extern "C" {
-#include "sds.h"
-}
+#include <cctype>
 
 #include <common/convert2string.h>
 #include <common/sprintf.h>
+#include <common/string_util.h>  // for FullEqualsASCII
 
 namespace fastonosql {
 namespace core {
@@ -52,7 +51,27 @@ common::Error ParseCommands(const command_buffer_t& cmd, std::vector<command_buf
   return common::Error();
 }
 
-ICommandTranslator::ICommandTranslator(const std::vector<CommandHolder>& commands) : commands_(commands) {}
+size_t ICommandTranslator::CommandNameHash::operator()(const std::string& name) const {
+  size_t hash = 2166136261U;  // FNV-1a
+  for (size_t i = 0; i < name.size(); ++i) {
+    hash ^= static_cast<size_t>(std::tolower(static_cast<unsigned char>(name[i])));
+    hash *= 16777619U;
+  }
+  return hash;
+}
+
+bool ICommandTranslator::CommandNameEqual::operator()(const std::string& lhs, const std::string& rhs) const {
+  return common::FullEqualsASCII(lhs, rhs, false);
+}
+
+ICommandTranslator::ICommandTranslator(const std::vector<CommandHolder>& commands)
+    : commands_(commands), commands_index_() {
+  for (size_t i = 0; i < commands_.size(); ++i) {
+    const std::string& name = commands_[i].name;
+    const std::string first_name = name.substr(0, name.find(' '));
+    commands_index_[first_name].push_back(i);
+  }
+}
 
 ICommandTranslator::~ICommandTranslator() {}
 
@@ -98,22 +117,62 @@ common::Error ICommandTranslator::FlushDBCommand(command_buffer_t* cmdstring) co
   return common::Error();
 }
 
-common::Error ICommandTranslator::DeleteKeyCommand(const NKey& key, command_buffer_t* cmdstring) const {
-  if (!cmdstring) {
+common::Error ICommandTranslator::CreateKeyCommand(const NDbKValue& key, commands_args_t* argv) const {
+  if (!argv) {
+    return common::make_error_inval();
+  }
+
+  argv->clear();
+  return CreateKeyCommandImpl(key, argv);
+}
+
+common::Error ICommandTranslator::LoadKeyCommand(const NKey& key,
+                                                 common::Value::Type type,
+                                                 commands_args_t* argv) const {
+  if (!argv) {
+    return common::make_error_inval();
+  }
+
+  argv->clear();
+  return LoadKeyCommandImpl(key, type, argv);
+}
+
+common::Error ICommandTranslator::DeleteKeyCommand(const NKey& key, commands_args_t* argv) const {
+  if (!argv) {
     return common::make_error_inval();
   }
 
-  return DeleteKeyCommandImpl(key, cmdstring);
+  argv->clear();
+  return DeleteKeyCommandImpl(key, argv);
 }
 
 common::Error ICommandTranslator::RenameKeyCommand(const NKey& key,
                                                    const key_t& new_name,
-                                                   command_buffer_t* cmdstring) const {
-  if (!cmdstring) {
+                                                   commands_args_t* argv) const {
+  if (!argv) {
+    return common::make_error_inval();
+  }
+
+  argv->clear();
+  return RenameKeyCommandImpl(key, new_name, argv);
+}
+
+common::Error ICommandTranslator::ChangeKeyTTLCommand(const NKey& key, ttl_t ttl, commands_args_t* argv) const {
+  if (!argv) {
     return common::make_error_inval();
   }
 
-  return RenameKeyCommandImpl(key, new_name, cmdstring);
+  argv->clear();
+  return ChangeKeyTTLCommandImpl(key, ttl, argv);
+}
+
+common::Error ICommandTranslator::LoadKeyTTLCommand(const NKey& key, commands_args_t* argv) const {
+  if (!argv) {
+    return common::make_error_inval();
+  }
+
+  argv->clear();
+  return LoadKeyTTLCommandImpl(key, argv);
 }
 
 common::Error ICommandTranslator::CreateKeyCommand(const NDbKValue& key, command_buffer_t* cmdstring) const {
@@ -121,7 +180,14 @@ common::Error ICommandTranslator::CreateKeyCommand(const NDbKValue& key, command
     return common::make_error_inval();
   }
 
-  return CreateKeyCommandImpl(key, cmdstring);
+  commands_args_t argv;
+  common::Error err = CreateKeyCommand(key, &argv);
+  if (err) {
+    return err;
+  }
+
+  *cmdstring = ConvertArgsToCommandLine(argv);
+  return common::Error();
 }
 
 common::Error ICommandTranslator::LoadKeyCommand(const NKey& key,
@@ -131,7 +197,46 @@ common::Error ICommandTranslator::LoadKeyCommand(const NKey& key,
     return common::make_error_inval();
   }
 
-  return LoadKeyCommandImpl(key, type, cmdstring);
+  commands_args_t argv;
+  common::Error err = LoadKeyCommand(key, type, &argv);
+  if (err) {
+    return err;
+  }
+
+  *cmdstring = ConvertArgsToCommandLine(argv);
+  return common::Error();
+}
+
+common::Error ICommandTranslator::DeleteKeyCommand(const NKey& key, command_buffer_t* cmdstring) const {
+  if (!cmdstring) {
+    return common::make_error_inval();
+  }
+
+  commands_args_t argv;
+  common::Error err = DeleteKeyCommand(key, &argv);
+  if (err) {
+    return err;
+  }
+
+  *cmdstring = ConvertArgsToCommandLine(argv);
+  return common::Error();
+}
+
+common::Error ICommandTranslator::RenameKeyCommand(const NKey& key,
+                                                   const key_t& new_name,
+                                                   command_buffer_t* cmdstring) const {
+  if (!cmdstring) {
+    return common::make_error_inval();
+  }
+
+  commands_args_t argv;
+  common::Error err = RenameKeyCommand(key, new_name, &argv);
+  if (err) {
+    return err;
+  }
+
+  *cmdstring = ConvertArgsToCommandLine(argv);
+  return common::Error();
 }
 
 common::Error ICommandTranslator::ChangeKeyTTLCommand(const NKey& key, ttl_t ttl, command_buffer_t* cmdstring) const {
@@ -139,7 +244,14 @@ common::Error ICommandTranslator::ChangeKeyTTLCommand(const NKey& key, ttl_t ttl
     return common::make_error_inval();
   }
 
-  return ChangeKeyTTLCommandImpl(key, ttl, cmdstring);
+  commands_args_t argv;
+  common::Error err = ChangeKeyTTLCommand(key, ttl, &argv);
+  if (err) {
+    return err;
+  }
+
+  *cmdstring = ConvertArgsToCommandLine(argv);
+  return common::Error();
 }
 
 common::Error ICommandTranslator::LoadKeyTTLCommand(const NKey& key, command_buffer_t* cmdstring) const {
@@ -147,7 +259,14 @@ common::Error ICommandTranslator::LoadKeyTTLCommand(const NKey& key, command_buf
     return common::make_error_inval();
   }
 
-  return LoadKeyTTLCommandImpl(key, cmdstring);
+  commands_args_t argv;
+  common::Error err = LoadKeyTTLCommand(key, &argv);
+  if (err) {
+    return err;
+  }
+
+  *cmdstring = ConvertArgsToCommandLine(argv);
+  return common::Error();
 }
 
 bool ICommandTranslator::IsLoadKeyCommand(const command_buffer_t& cmd, string_key_t* key) const {
@@ -160,32 +279,23 @@ bool ICommandTranslator::IsLoadKeyCommand(const command_buffer_t& cmd, string_ke
     return false;
   }
 
-  int argc;
-  sds* argv = sdssplitargslong(stabled_command.data(), &argc);
-  if (!argv) {
+  commands_args_t argv;
+  if (!SplitCommandArgs(stabled_command, &argv)) {
     return false;
   }
 
-  commands_args_t standart_argv;
-  for (int i = 0; i < argc; ++i) {
-    standart_argv.push_back(command_buffer_t(argv[i], sdslen(argv[i])));
-  }
-
   const CommandHolder* cmdh = nullptr;
   size_t off = 0;
-  common::Error err = TestCommandLineArgs(standart_argv, &cmdh, &off);
+  common::Error err = TestCommandLineArgs(argv, &cmdh, &off);
   if (err) {
-    sdsfreesplitres(argv, argc);
     return false;
   }
 
   if (IsLoadKeyCommandImpl(*cmdh)) {
-    *key = command_buffer_t(argv[off], strlen(argv[off]));
-    sdsfreesplitres(argv, argc);
+    *key = argv[off];
     return true;
   }
 
-  sdsfreesplitres(argv, argc);
   return false;
 }
 
@@ -222,7 +332,7 @@ common::Error ICommandTranslator::UnknownCommand(const std::string& cmd) {
   return common::make_error(buff);
 }
 
-common::Error ICommandTranslator::UnknownSequence(commands_args_t argv) {
+common::Error ICommandTranslator::UnknownSequence(const commands_args_t& argv) {
   std::string result;
   for (size_t i = 0; i < argv.size(); ++i) {
     result += common::ConvertToString(argv[i]);
@@ -248,24 +358,35 @@ common::Error ICommandTranslator::FindCommand(const std::string& command_first_n
     return common::make_error_inval();
   }
 
-  for (size_t i = 0; i < commands_.size(); ++i) {
-    const CommandHolder* cmd = &commands_[i];
-    if (cmd->IsEqualFirstName(command_first_name)) {
-      *info = cmd;
-      return common::Error();
-    }
+  auto it = commands_index_.find(command_first_name);
+  if (it == commands_index_.end()) {
+    return UnknownCommand(command_first_name);
   }
 
-  return UnknownCommand(command_first_name);
+  const std::vector<size_t>& candidates = it->second;
+  *info = &commands_[candidates.front()];
+  return common::Error();
 }
 
-common::Error ICommandTranslator::FindCommand(commands_args_t argv, const CommandHolder** info, size_t* off) const {
+common::Error ICommandTranslator::FindCommand(const commands_args_t& argv,
+                                              const CommandHolder** info,
+                                              size_t* off) const {
   if (!info || !off) {
     return common::make_error_inval();
   }
 
-  for (size_t i = 0; i < commands_.size(); ++i) {
-    const CommandHolder* cmd = &commands_[i];
+  if (argv.empty()) {
+    return UnknownSequence(argv);
+  }
+
+  auto it = commands_index_.find(argv[0]);
+  if (it == commands_index_.end()) {
+    return UnknownSequence(argv);
+  }
+
+  const std::vector<size_t>& candidates = it->second;
+  for (size_t i = 0; i < candidates.size(); ++i) {
+    const CommandHolder* cmd = &commands_[candidates[i]];
     size_t loff = 0;
     if (cmd->IsCommand(argv, &loff)) {
       *info = cmd;
@@ -277,7 +398,7 @@ common::Error ICommandTranslator::FindCommand(commands_args_t argv, const Comman
   return UnknownSequence(argv);
 }
 
-common::Error ICommandTranslator::TestCommandArgs(const CommandHolder* cmd, commands_args_t argv) const {
+common::Error ICommandTranslator::TestCommandArgs(const CommandHolder* cmd, const commands_args_t& argv) const {
   if (!cmd) {
     return common::make_error_inval();
   }
@@ -291,28 +412,17 @@ common::Error ICommandTranslator::TestCommandLine(const command_buffer_t& cmd) c
     return common::make_error_inval();
   }
 
-  int argc;
-  sds* argv = sdssplitargslong(stabled_command.data(), &argc);
-  if (!argv) {
+  commands_args_t argv;
+  if (!SplitCommandArgs(stabled_command, &argv)) {
     return common::make_error_inval();
   }
 
-  commands_args_t standart_argv;
-  for (int i = 0; i < argc; ++i) {
-    standart_argv.push_back(command_buffer_t(argv[i], sdslen(argv[i])));
-  }
   const CommandHolder* cmdh = nullptr;
   size_t loff = 0;
-  common::Error err = TestCommandLineArgs(standart_argv, &cmdh, &loff);
-  if (err) {
-    sdsfreesplitres(argv, argc);
-    return err;
-  }
-
-  return common::Error();
+  return TestCommandLineArgs(argv, &cmdh, &loff);
 }
 
-common::Error ICommandTranslator::TestCommandLineArgs(commands_args_t argv,
+common::Error ICommandTranslator::TestCommandLineArgs(const commands_args_t& argv,
                                                       const CommandHolder** info,
                                                       size_t* off) const {
   const CommandHolder* cmd = nullptr;
@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <unordered_map>
+
 #include "core/command_holder.h"
 #include "core/db_key.h"  // for NKey, NDbKValue, ttl_t
 #include "core/db_ps_channel.h"
@@ -64,6 +66,20 @@ class ICommandTranslator {
 
   common::Error SelectDBCommand(const std::string& name, command_buffer_t* cmdstring) const WARN_UNUSED_RESULT;
   common::Error FlushDBCommand(command_buffer_t* cmdstring) const WARN_UNUSED_RESULT;
+
+  // key commands as argument vectors, binary safe and passed to engine api as is
+  common::Error CreateKeyCommand(const NDbKValue& key, commands_args_t* argv) const WARN_UNUSED_RESULT;
+  common::Error LoadKeyCommand(const NKey& key,
+                               common::Value::Type type,
+                               commands_args_t* argv) const WARN_UNUSED_RESULT;
+  common::Error DeleteKeyCommand(const NKey& key, commands_args_t* argv) const WARN_UNUSED_RESULT;
+  common::Error RenameKeyCommand(const NKey& key,
+                                 const key_t& new_name,
+                                 commands_args_t* argv) const WARN_UNUSED_RESULT;
+  common::Error ChangeKeyTTLCommand(const NKey& key, ttl_t ttl, commands_args_t* argv) const WARN_UNUSED_RESULT;
+  common::Error LoadKeyTTLCommand(const NKey& key, commands_args_t* argv) const WARN_UNUSED_RESULT;
+
+  // same commands as text for console, arguments are escaped by ConvertArgsToCommandLine
   common::Error CreateKeyCommand(const NDbKValue& key, command_buffer_t* cmdstring) const WARN_UNUSED_RESULT;
   common::Error LoadKeyCommand(const NKey& key,
                                common::Value::Type type,
@@ -85,30 +101,28 @@ class ICommandTranslator {
 
   std::vector<CommandInfo> Commands() const;
   common::Error FindCommand(const std::string& command_first_name, const CommandHolder** info) const WARN_UNUSED_RESULT;
-  common::Error FindCommand(commands_args_t argv, const CommandHolder** info, size_t* off) const WARN_UNUSED_RESULT;
+  common::Error FindCommand(const commands_args_t& argv,
+                            const CommandHolder** info,
+                            size_t* off) const WARN_UNUSED_RESULT;
 
-  common::Error TestCommandArgs(const CommandHolder* cmd, commands_args_t argv) const WARN_UNUSED_RESULT;
+  common::Error TestCommandArgs(const CommandHolder* cmd, const commands_args_t& argv) const WARN_UNUSED_RESULT;
   common::Error TestCommandLine(const command_buffer_t& cmd) const WARN_UNUSED_RESULT;
-  common::Error TestCommandLineArgs(commands_args_t argv,
+  common::Error TestCommandLineArgs(const commands_args_t& argv,
                                     const CommandHolder** info,
                                     size_t* off) const WARN_UNUSED_RESULT;
 
   static common::Error InvalidInputArguments(const std::string& cmd);
   static common::Error NotSupported(const std::string& cmd);
   static common::Error UnknownCommand(const std::string& cmd);
-  static common::Error UnknownSequence(commands_args_t argv);
+  static common::Error UnknownSequence(const commands_args_t& argv);
 
  private:
-  virtual common::Error CreateKeyCommandImpl(const NDbKValue& key, command_buffer_t* cmdstring) const = 0;
-  virtual common::Error LoadKeyCommandImpl(const NKey& key,
-                                           common::Value::Type type,
-                                           command_buffer_t* cmdstring) const = 0;
-  virtual common::Error DeleteKeyCommandImpl(const NKey& key, command_buffer_t* cmdstring) const = 0;
-  virtual common::Error RenameKeyCommandImpl(const NKey& key,
-                                             const key_t& new_name,
-                                             command_buffer_t* cmdstring) const = 0;
-  virtual common::Error ChangeKeyTTLCommandImpl(const NKey& key, ttl_t ttl, command_buffer_t* cmdstring) const = 0;
-  virtual common::Error LoadKeyTTLCommandImpl(const NKey& key, command_buffer_t* cmdstring) const = 0;
+  virtual common::Error CreateKeyCommandImpl(const NDbKValue& key, commands_args_t* argv) const = 0;
+  virtual common::Error LoadKeyCommandImpl(const NKey& key, common::Value::Type type, commands_args_t* argv) const = 0;
+  virtual common::Error DeleteKeyCommandImpl(const NKey& key, commands_args_t* argv) const = 0;
+  virtual common::Error RenameKeyCommandImpl(const NKey& key, const key_t& new_name, commands_args_t* argv) const = 0;
+  virtual common::Error ChangeKeyTTLCommandImpl(const NKey& key, ttl_t ttl, commands_args_t* argv) const = 0;
+  virtual common::Error LoadKeyTTLCommandImpl(const NKey& key, commands_args_t* argv) const = 0;
   virtual common::Error PublishCommandImpl(const NDbPSChannel& channel,
                                            const std::string& message,
                                            command_buffer_t* cmdstring) const = 0;
@@ -116,7 +130,17 @@ class ICommandTranslator {
 
   virtual bool IsLoadKeyCommandImpl(const CommandInfo& cmd) const = 0;
 
+  struct CommandNameHash {
+    size_t operator()(const std::string& name) const;
+  };
+  struct CommandNameEqual {
+    bool operator()(const std::string& lhs, const std::string& rhs) const;
+  };
+  // case insensitive first word of command name => indexes in commands_, in declaration order
+  typedef std::unordered_map<std::string, std::vector<size_t>, CommandNameHash, CommandNameEqual> commands_index_t;
+
   const std::vector<CommandHolder> commands_;
+  commands_index_t commands_index_;
 };
 
 typedef std::shared_ptr<ICommandTranslator> translator_t;
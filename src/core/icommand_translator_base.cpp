@@ -28,21 +28,19 @@ ICommandTranslatorBase::ICommandTranslatorBase(const std::vector<CommandHolder>&
 
 ICommandTranslatorBase::~ICommandTranslatorBase() {}
 
-common::Error ICommandTranslatorBase::ChangeKeyTTLCommandImpl(const NKey& key,
-                                                              ttl_t ttl,
-                                                              command_buffer_t* cmdstring) const {
+common::Error ICommandTranslatorBase::ChangeKeyTTLCommandImpl(const NKey& key, ttl_t ttl, commands_args_t* argv) const {
   UNUSED(key);
   UNUSED(ttl);
-  UNUSED(cmdstring);
+  UNUSED(argv);
 
   const std::string error_msg =
       common::MemSPrintf("Sorry, but now " PROJECT_NAME_TITLE " not supported change ttl command for %s.", GetDBName());
   return common::make_error(error_msg);
 }
 
-common::Error ICommandTranslatorBase::LoadKeyTTLCommandImpl(const NKey& key, command_buffer_t* cmdstring) const {
+common::Error ICommandTranslatorBase::LoadKeyTTLCommandImpl(const NKey& key, commands_args_t* argv) const {
   UNUSED(key);
-  UNUSED(cmdstring);
+  UNUSED(argv);
 
   const std::string error_msg =
       common::MemSPrintf("Sorry, but now " PROJECT_NAME_TITLE " not supported get ttl command for %s.", GetDBName());
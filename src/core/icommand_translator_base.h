@@ -31,8 +31,8 @@ class ICommandTranslatorBase : public ICommandTranslator {
   virtual const char* GetDBName() const override = 0;
 
  private:
-  virtual common::Error ChangeKeyTTLCommandImpl(const NKey& key, ttl_t ttl, command_buffer_t* cmdstring) const override;
-  virtual common::Error LoadKeyTTLCommandImpl(const NKey& key, command_buffer_t* cmdstring) const override;
+  virtual common::Error ChangeKeyTTLCommandImpl(const NKey& key, ttl_t ttl, commands_args_t* argv) const override;
+  virtual common::Error LoadKeyTTLCommandImpl(const NKey& key, commands_args_t* argv) const override;
   virtual common::Error PublishCommandImpl(const NDbPSChannel& channel,
                                            const std::string& message,
                                            command_buffer_t* cmdstring) const override;
@@ -0,0 +1,301 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "core/internal/backup.h"
+
+#include <errno.h>
+#include <string.h>
+#if defined(OS_WIN)
+#include <io.h>  // for _commit
+#else
+#include <unistd.h>  // for fsync
+#endif
+
+#include <common/sprintf.h>
+#include <common/threads/platform_thread.h>
+
+#define DUMP_MAGIC "FNSD0001"
+#define DUMP_MAGIC_SIZE 8
+
+namespace {
+
+int SyncFile(FILE* file) {
+#if defined(OS_WIN)
+  return _commit(_fileno(file));
+#else
+  return fsync(fileno(file));
+#endif
+}
+
+common::Error MakeFileError(const std::string& path) {
+  return common::make_error(common::MemSPrintf("File %s error: %s", path, strerror(errno)));
+}
+
+void EncodeUInt32(uint32_t value, unsigned char* out) {
+  out[0] = static_cast<unsigned char>(value);
+  out[1] = static_cast<unsigned char>(value >> 8);
+  out[2] = static_cast<unsigned char>(value >> 16);
+  out[3] = static_cast<unsigned char>(value >> 24);
+}
+
+uint32_t DecodeUInt32(const unsigned char* in) {
+  return static_cast<uint32_t>(in[0]) | (static_cast<uint32_t>(in[1]) << 8) | (static_cast<uint32_t>(in[2]) << 16) |
+         (static_cast<uint32_t>(in[3]) << 24);
+}
+
+}  // namespace
+
+namespace fastonosql {
+namespace core {
+namespace internal {
+
+ThroughputLimiter::ThroughputLimiter(uint64_t bytes_per_sec)
+    : bytes_per_sec_(bytes_per_sec), start_msec_(common::time::current_mstime()), consumed_(0) {}
+
+void ThroughputLimiter::Consume(uint64_t bytes) {
+  if (bytes_per_sec_ == 0) {
+    return;
+  }
+
+  consumed_ += bytes;
+  const common::time64_t expected_msec = consumed_ * 1000 / bytes_per_sec_;
+  const common::time64_t elapsed_msec = common::time::current_mstime() - start_msec_;
+  if (expected_msec > elapsed_msec) {
+    common::threads::PlatformThread::Sleep(expected_msec - elapsed_msec);
+  }
+}
+
+DumpWriter::DumpWriter(const std::string& path, uint64_t bytes_per_sec)
+    : path_(path), file_(nullptr), limiter_(bytes_per_sec), records_count_(0) {}
+
+DumpWriter::~DumpWriter() {
+  if (file_) {
+    fclose(file_);
+    file_ = nullptr;
+  }
+}
+
+common::Error DumpWriter::Open() {
+  if (file_) {
+    return common::Error();
+  }
+
+  file_ = fopen(path_.c_str(), "wb");
+  if (!file_) {
+    return MakeFileError(path_);
+  }
+
+  return WriteRaw(DUMP_MAGIC, DUMP_MAGIC_SIZE);
+}
+
+common::Error DumpWriter::Write(const std::string& key, const std::string& value) {
+  if (!file_) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  unsigned char len[4];
+  EncodeUInt32(key.size(), len);
+  common::Error err = WriteRaw(len, sizeof(len));
+  if (err) {
+    return err;
+  }
+
+  err = WriteRaw(key.data(), key.size());
+  if (err) {
+    return err;
+  }
+
+  EncodeUInt32(value.size(), len);
+  err = WriteRaw(len, sizeof(len));
+  if (err) {
+    return err;
+  }
+
+  err = WriteRaw(value.data(), value.size());
+  if (err) {
+    return err;
+  }
+
+  records_count_++;
+  limiter_.Consume(sizeof(len) * 2 + key.size() + value.size());
+  return common::Error();
+}
+
+common::Error DumpWriter::Close() {
+  if (!file_) {
+    return common::Error();
+  }
+
+  bool is_ok = fflush(file_) == 0 && SyncFile(file_) == 0;
+  is_ok = fclose(file_) == 0 && is_ok;
+  file_ = nullptr;
+  if (!is_ok) {
+    return MakeFileError(path_);
+  }
+
+  return common::Error();
+}
+
+uint64_t DumpWriter::GetRecordsCount() const {
+  return records_count_;
+}
+
+common::Error DumpWriter::WriteRaw(const void* data, size_t size) {
+  if (size && fwrite(data, 1, size, file_) != size) {
+    return MakeFileError(path_);
+  }
+
+  return common::Error();
+}
+
+DumpReader::DumpReader(const std::string& path) : path_(path), file_(nullptr), file_size_(0), readed_(0) {}
+
+DumpReader::~DumpReader() {
+  if (file_) {
+    fclose(file_);
+    file_ = nullptr;
+  }
+}
+
+common::Error DumpReader::Open() {
+  if (file_) {
+    return common::Error();
+  }
+
+  file_ = fopen(path_.c_str(), "rb");
+  if (!file_) {
+    return MakeFileError(path_);
+  }
+
+  if (fseek(file_, 0, SEEK_END) == 0) {
+    long size = ftell(file_);
+    file_size_ = size > 0 ? size : 0;
+  }
+  rewind(file_);
+
+  char magic[DUMP_MAGIC_SIZE];
+  if (fread(magic, 1, sizeof(magic), file_) != sizeof(magic) || memcmp(magic, DUMP_MAGIC, DUMP_MAGIC_SIZE) != 0) {
+    return common::make_error(common::MemSPrintf("File %s is not a backup dump", path_));
+  }
+
+  readed_ = sizeof(magic);
+  return common::Error();
+}
+
+common::Error DumpReader::Validate() {
+  if (!file_) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  common::Error err = SkipRecords();
+  if (fseek(file_, DUMP_MAGIC_SIZE, SEEK_SET) != 0) {
+    return MakeFileError(path_);
+  }
+
+  readed_ = DUMP_MAGIC_SIZE;
+  return err;
+}
+
+common::Error DumpReader::Read(std::string* key, std::string* value, bool* eof) {
+  if (!file_ || !key || !value || !eof) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  int c = fgetc(file_);
+  if (c == EOF) {
+    *eof = true;
+    return common::Error();
+  }
+  ungetc(c, file_);
+
+  common::Error err = ReadString(key);
+  if (err) {
+    return err;
+  }
+
+  err = ReadString(value);
+  if (err) {
+    return err;
+  }
+
+  *eof = false;
+  return common::Error();
+}
+
+int DumpReader::GetProgress() const {
+  if (file_size_ == 0) {
+    return 100;
+  }
+
+  return static_cast<int>(readed_ * 100 / file_size_);
+}
+
+common::Error DumpReader::ReadString(std::string* out) {
+  unsigned char len[4];
+  if (fread(len, 1, sizeof(len), file_) != sizeof(len)) {
+    return MakeTruncatedError();
+  }
+
+  const uint32_t size = DecodeUInt32(len);
+  if (readed_ + sizeof(len) + size > file_size_) {  // corrupt length, don't allocate it
+    return MakeTruncatedError();
+  }
+
+  out->resize(size);
+  if (size && fread(&(*out)[0], 1, size, file_) != size) {
+    return MakeTruncatedError();
+  }
+
+  readed_ += sizeof(len) + size;
+  return common::Error();
+}
+
+common::Error DumpReader::SkipRecords() {
+  uint64_t pos = DUMP_MAGIC_SIZE;
+  if (fseek(file_, pos, SEEK_SET) != 0) {
+    return MakeFileError(path_);
+  }
+
+  while (pos < file_size_) {
+    for (size_t i = 0; i < 2; ++i) {  // key, value
+      unsigned char len[4];
+      if (fread(len, 1, sizeof(len), file_) != sizeof(len)) {
+        return MakeTruncatedError();
+      }
+
+      const uint32_t size = DecodeUInt32(len);
+      pos += sizeof(len) + size;
+      if (pos > file_size_ || fseek(file_, size, SEEK_CUR) != 0) {
+        return MakeTruncatedError();
+      }
+    }
+  }
+
+  return common::Error();
+}
+
+common::Error DumpReader::MakeTruncatedError() const {
+  return common::make_error(common::MemSPrintf("File %s is truncated", path_));
+}
+
+}  // namespace internal
+}  // namespace core
+}  // namespace fastonosql
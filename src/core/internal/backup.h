@@ -0,0 +1,99 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdio.h>  // for FILE
+
+#include <functional>
+#include <string>
+
+#include <common/error.h>  // for Error
+#include <common/time.h>   // for time64_t
+
+#define BACKUP_DEFAULT_RATE_LIMIT 64 * 1024 * 1024  // bytes per second
+#define BACKUP_BATCH_SIZE 1000                      // records per write batch and progress report
+
+#define DB_BACKUP_COMMAND "BACKUP"
+#define DB_RESTORE_COMMAND "RESTORE"
+
+namespace fastonosql {
+namespace core {
+namespace internal {
+
+typedef std::function<void(int percent)> backup_progress_callback_t;
+
+// sleeps in Consume when data is produced faster than bytes_per_sec, 0 means unlimited
+class ThroughputLimiter {
+ public:
+  explicit ThroughputLimiter(uint64_t bytes_per_sec);
+
+  void Consume(uint64_t bytes);
+
+ private:
+  const uint64_t bytes_per_sec_;
+  common::time64_t start_msec_;
+  uint64_t consumed_;
+};
+
+// portable dump for engines without native backup:
+// magic, then records of (uint32 key length, key, uint32 value length, value), little endian
+class DumpWriter {
+ public:
+  explicit DumpWriter(const std::string& path, uint64_t bytes_per_sec = BACKUP_DEFAULT_RATE_LIMIT);
+  ~DumpWriter();
+
+  common::Error Open() WARN_UNUSED_RESULT;
+  common::Error Write(const std::string& key, const std::string& value) WARN_UNUSED_RESULT;
+  common::Error Close() WARN_UNUSED_RESULT;  // flush and sync
+
+  uint64_t GetRecordsCount() const;
+
+ private:
+  common::Error WriteRaw(const void* data, size_t size) WARN_UNUSED_RESULT;
+
+  const std::string path_;
+  FILE* file_;
+  ThroughputLimiter limiter_;
+  uint64_t records_count_;
+};
+
+class DumpReader {
+ public:
+  explicit DumpReader(const std::string& path);
+  ~DumpReader();
+
+  common::Error Open() WARN_UNUSED_RESULT;
+  common::Error Validate() WARN_UNUSED_RESULT;  // walks all records without reading them, then rewinds to first
+  common::Error Read(std::string* key, std::string* value, bool* eof) WARN_UNUSED_RESULT;
+  int GetProgress() const;  // percent of file read
+
+ private:
+  common::Error ReadString(std::string* out) WARN_UNUSED_RESULT;
+  common::Error SkipRecords() WARN_UNUSED_RESULT;
+  common::Error MakeTruncatedError() const;
+
+  const std::string path_;
+  FILE* file_;
+  uint64_t file_size_;
+  uint64_t readed_;
+};
+
+}  // namespace internal
+}  // namespace core
+}  // namespace fastonosql
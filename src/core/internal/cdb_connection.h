@@ -19,13 +19,17 @@
 #pragma once
 
 #include <common/sprintf.h>
+#include <common/time.h>  // for current_mstime
 
 #include "core/internal/cdb_connection_client.h"
 #include "core/internal/command_handler.h"  // for CommandHandler, etc
 #include "core/internal/db_connection.h"    // for DBConnection
+#include "core/internal/scan_cursors.h"     // for ScanCursors
 
 #include "core/database/idatabase_info.h"
 
+#define DELETE_BATCH_SIZE 1000  // keys per write batch or multi key command of Delete
+
 namespace fastonosql {
 namespace core {
 namespace internal {
@@ -53,15 +57,22 @@ class CDBConnection : public DBConnection<NConnection, Config, ContType>,
   typedef DBConnection<NConnection, Config, ContType> db_base_class;
   typedef ConnectionTraits<ContType> connection_traits_class;
 
+  enum { keys_count_cache_msec = 5000 };  // staleness bound of cached keys count
+
   CDBConnection(CDBConnectionClient* client, ICommandTranslator* translator)
-      : db_base_class(), CommandHandler(translator), client_(client) {}
+      : db_base_class(),
+        CommandHandler(translator),
+        client_(client),
+        scan_cursors_(),
+        keys_count_cache_(0),
+        keys_count_cache_time_(0) {}
   virtual ~CDBConnection() {}
 
   static const char* GetDBName() { return ConnectionTraits<ContType>::GetDBName(); }
   static const ConstantCommandsArray& GetCommands();
 
   virtual std::string GetCurrentDBName() const;                                      //
-  common::Error Help(commands_args_t argv, std::string* answer) WARN_UNUSED_RESULT;  //
+  common::Error Help(const commands_args_t& argv, std::string* answer) WARN_UNUSED_RESULT;  //
 
   common::Error Scan(uint64_t cursor_in,
                      const std::string& pattern,
@@ -72,7 +83,7 @@ class CDBConnection : public DBConnection<NConnection, Config, ContType>,
                      const std::string& key_end,
                      uint64_t limit,
                      std::vector<std::string>* ret) WARN_UNUSED_RESULT;                    // nvi
-  common::Error DBkcount(size_t* size) WARN_UNUSED_RESULT;                                 // nvi
+  common::Error DBkcount(size_t* size, keysCountMode mode = EXACT_KEYS_COUNT) WARN_UNUSED_RESULT;  // nvi
   common::Error FlushDB() WARN_UNUSED_RESULT;                                              // nvi
   common::Error Select(const std::string& name, IDataBaseInfo** info) WARN_UNUSED_RESULT;  // nvi
   common::Error CreateDB(const std::string& name) WARN_UNUSED_RESULT;                      // nvi
@@ -92,7 +103,10 @@ class CDBConnection : public DBConnection<NConnection, Config, ContType>,
     const std::string buff = common::MemSPrintf("%s function error: %s", cmd, descr);
     return common::make_error(buff);
   }
+  void ResetCaches();  // scan cursors and keys count, after data replaced not by nvi methods (restore)
+
   CDBConnectionClient* client_;
+  ScanCursors scan_cursors_;  // resumable SCAN positions
 
  private:
   virtual common::Error ScanImpl(uint64_t cursor_in,
@@ -105,6 +119,7 @@ class CDBConnection : public DBConnection<NConnection, Config, ContType>,
                                  uint64_t limit,
                                  std::vector<std::string>* ret) = 0;
   virtual common::Error DBkcountImpl(size_t* size) = 0;
+  virtual common::Error DBkcountEstimateImpl(size_t* size);  // optional
   virtual common::Error FlushDBImpl() = 0;
 
   virtual common::Error SelectImpl(const std::string& name, IDataBaseInfo** info) = 0;
@@ -120,6 +135,9 @@ class CDBConnection : public DBConnection<NConnection, Config, ContType>,
   virtual common::Error ModuleLoadImpl(const ModuleInfo& module);    // optional
   virtual common::Error ModuleUnLoadImpl(const ModuleInfo& module);  // optional
   virtual common::Error QuitImpl() = 0;
+
+  size_t keys_count_cache_;
+  common::time64_t keys_count_cache_time_;
 };
 
 template <typename NConnection, typename Config, connectionTypes ContType>
@@ -128,7 +146,7 @@ std::string CDBConnection<NConnection, Config, ContType>::GetCurrentDBName() con
 }
 
 template <typename NConnection, typename Config, connectionTypes ContType>
-common::Error CDBConnection<NConnection, Config, ContType>::Help(commands_args_t argv, std::string* answer) {
+common::Error CDBConnection<NConnection, Config, ContType>::Help(const commands_args_t& argv, std::string* answer) {
   size_t argc = argv.size();
   if (!answer) {
     DNOTREACHED();
@@ -233,11 +251,23 @@ common::Error CDBConnection<NConnection, Config, ContType>::DBkcount(size_t* siz
     return err;
   }
 
-  err = DBkcountImpl(size);
+  const common::time64_t now = common::time::current_mstime();
+  if (mode == ESTIMATE_KEYS_COUNT) {
+    if (keys_count_cache_time_ != 0 && now - keys_count_cache_time_ <= keys_count_cache_msec) {
+      *size = keys_count_cache_;
+      return common::Error();
+    }
+
+    err = DBkcountEstimateImpl(size);
+  } else {
+    err = DBkcountImpl(size);
+  }
   if (err) {
     return err;
   }
 
+  keys_count_cache_ = *size;
+  keys_count_cache_time_ = now;
   return common::Error();
 }
 
@@ -253,6 +283,9 @@ common::Error CDBConnection<NConnection, Config, ContType>::FlushDB() {
     return err;
   }
 
+  scan_cursors_.Clear();
+  keys_count_cache_time_ = 0;
+
   if (client_) {
     client_->OnFlushedCurrentDB();
   }
@@ -323,6 +356,12 @@ common::Error CDBConnection<NConnection, Config, ContType>::RemoveDB(const std::
   return common::Error();
 }
 
+template <typename NConnection, typename Config, connectionTypes ContType>
+void CDBConnection<NConnection, Config, ContType>::ResetCaches() {
+  scan_cursors_.Clear();
+  keys_count_cache_time_ = 0;
+}
+
 template <typename NConnection, typename Config, connectionTypes ContType>
 common::Error CDBConnection<NConnection, Config, ContType>::Select(const std::string& name, IDataBaseInfo** info) {
   common::Error err = CDBConnection<NConnection, Config, ContType>::TestIsAuthenticated();
@@ -331,6 +370,8 @@ common::Error CDBConnection<NConnection, Config, ContType>::Select(const std::st
   }
 
   IDataBaseInfo* linfo = nullptr;
+  scan_cursors_.Clear();
+  keys_count_cache_time_ = 0;
   err = SelectImpl(name, &linfo);
   if (err) {
     return err;
@@ -362,15 +403,11 @@ common::Error CDBConnection<NConnection, Config, ContType>::Delete(const NKeys&
   }
 
   err = DeleteImpl(keys, deleted_keys);
-  if (err) {
-    return err;
-  }
-
-  if (client_) {
+  if (client_) {  // keys of batches written before error are removed too
     client_->OnRemovedKeys(*deleted_keys);
   }
 
-  return common::Error();
+  return err;
 }
 
 template <typename NConnection, typename Config, connectionTypes ContType>
@@ -540,6 +577,11 @@ common::Error CDBConnection<NConnection, Config, ContType>::Quit() {
   return common::Error();
 }
 
+template <typename NConnection, typename Config, connectionTypes ContType>
+common::Error CDBConnection<NConnection, Config, ContType>::DBkcountEstimateImpl(size_t* size) {
+  return DBkcountImpl(size);
+}
+
 template <typename NConnection, typename Config, connectionTypes ContType>
 common::Error CDBConnection<NConnection, Config, ContType>::SetTTLImpl(const NKey& key, ttl_t ttl) {
   UNUSED(key);
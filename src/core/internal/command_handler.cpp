@@ -18,9 +18,7 @@
 
 #include "core/internal/command_handler.h"
 
-extern "C" {
-#include "sds.h"
-}
+#include <utility>
 
 #include "core/command_holder.h"  // for CommandHolder
 
@@ -36,35 +34,29 @@ common::Error CommandHandler::Execute(const command_buffer_t& command, FastoObje
     return common::make_error_inval();
   }
 
-  int argc;
-  sds* argv = sdssplitargslong(stabled_command.data(), &argc);
-  if (!argv) {
+  commands_args_t argv;
+  if (!SplitCommandArgs(stabled_command, &argv)) {
     return common::make_error_inval();
   }
 
-  commands_args_t argvv;
-  for (int i = 0; i < argc; ++i) {
-    std::string str(argv[i], sdslen(argv[i]));
-    argvv.push_back(str);
-  }
-  common::Error err = Execute(argvv, out);
-  sdsfreesplitres(argv, argc);
-  return err;
+  return Execute(std::move(argv), out);
 }
 
 common::Error CommandHandler::Execute(commands_args_t argv, FastoObject* out) {
   const CommandHolder* cmd = nullptr;
   size_t off = 0;
-  common::Error err = translator_->TestCommandLineArgs(argv, &cmd, &off);
+  common::Error err = translator_->FindCommand(argv, &cmd, &off);
   if (err) {
     return err;
   }
 
-  commands_args_t stabled;
-  for (size_t i = off; i < argv.size(); ++i) {
-    stabled.push_back(argv[i]);
+  argv.erase(argv.begin(), argv.begin() + off);  // drop command name, arguments are passed in place
+  err = translator_->TestCommandArgs(cmd, argv);
+  if (err) {
+    return err;
   }
-  return cmd->func_(this, stabled, out);
+
+  return cmd->func_(this, argv, out);
 }
 
 }  // namespace internal
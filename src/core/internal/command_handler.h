@@ -31,7 +31,7 @@ class CommandHandler {
  public:
   explicit CommandHandler(ICommandTranslator* translator);  // take ownerships
   common::Error Execute(const command_buffer_t& command, FastoObject* out) WARN_UNUSED_RESULT;
-  common::Error Execute(commands_args_t argv, FastoObject* out) WARN_UNUSED_RESULT;
+  common::Error Execute(commands_args_t argv, FastoObject* out) WARN_UNUSED_RESULT;  // argv consumed
 
   translator_t GetTranslator() const { return translator_; }
 
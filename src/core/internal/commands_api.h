@@ -31,29 +31,29 @@ namespace internal {
 template <class CDBConnection>
 struct ApiTraits {
   typedef CDBConnection cdb_connection_t;
-  static common::Error Help(CommandHandler* handler, commands_args_t argv, FastoObject* out);
-
-  static common::Error Scan(CommandHandler* handler, commands_args_t argv, FastoObject* out);
-  static common::Error Keys(CommandHandler* handler, commands_args_t argv, FastoObject* out);
-  static common::Error DBkcount(CommandHandler* handler, commands_args_t argv, FastoObject* out);
-  static common::Error CreateDatabase(CommandHandler* handler, commands_args_t argv, FastoObject* out);
-  static common::Error RemoveDatabase(CommandHandler* handler, commands_args_t argv, FastoObject* out);
-  static common::Error FlushDB(CommandHandler* handler, commands_args_t argv, FastoObject* out);
-  static common::Error Select(CommandHandler* handler, commands_args_t argv, FastoObject* out);
-  static common::Error Set(CommandHandler* handler, commands_args_t argv, FastoObject* out);
-  static common::Error Get(CommandHandler* handler, commands_args_t argv, FastoObject* out);
-  static common::Error Rename(CommandHandler* handler, commands_args_t argv, FastoObject* out);
-  static common::Error Delete(CommandHandler* handler, commands_args_t argv, FastoObject* out);
-  static common::Error SetTTL(CommandHandler* handler, commands_args_t argv, FastoObject* out);
-  static common::Error GetTTL(CommandHandler* handler, commands_args_t argv, FastoObject* out);
-  static common::Error ModuleLoad(CommandHandler* handler, commands_args_t argv, FastoObject* out);
-  static common::Error ModuleUnLoad(CommandHandler* handler, commands_args_t argv, FastoObject* out);
-  static common::Error Quit(CommandHandler* handler, commands_args_t argv, FastoObject* out);
+  static common::Error Help(CommandHandler* handler, const commands_args_t& argv, FastoObject* out);
+
+  static common::Error Scan(CommandHandler* handler, const commands_args_t& argv, FastoObject* out);
+  static common::Error Keys(CommandHandler* handler, const commands_args_t& argv, FastoObject* out);
+  static common::Error DBkcount(CommandHandler* handler, const commands_args_t& argv, FastoObject* out);
+  static common::Error CreateDatabase(CommandHandler* handler, const commands_args_t& argv, FastoObject* out);
+  static common::Error RemoveDatabase(CommandHandler* handler, const commands_args_t& argv, FastoObject* out);
+  static common::Error FlushDB(CommandHandler* handler, const commands_args_t& argv, FastoObject* out);
+  static common::Error Select(CommandHandler* handler, const commands_args_t& argv, FastoObject* out);
+  static common::Error Set(CommandHandler* handler, const commands_args_t& argv, FastoObject* out);
+  static common::Error Get(CommandHandler* handler, const commands_args_t& argv, FastoObject* out);
+  static common::Error Rename(CommandHandler* handler, const commands_args_t& argv, FastoObject* out);
+  static common::Error Delete(CommandHandler* handler, const commands_args_t& argv, FastoObject* out);
+  static common::Error SetTTL(CommandHandler* handler, const commands_args_t& argv, FastoObject* out);
+  static common::Error GetTTL(CommandHandler* handler, const commands_args_t& argv, FastoObject* out);
+  static common::Error ModuleLoad(CommandHandler* handler, const commands_args_t& argv, FastoObject* out);
+  static common::Error ModuleUnLoad(CommandHandler* handler, const commands_args_t& argv, FastoObject* out);
+  static common::Error Quit(CommandHandler* handler, const commands_args_t& argv, FastoObject* out);
 };
 
 template <class CDBConnection>
 common::Error ApiTraits<CDBConnection>::Help(internal::CommandHandler* handler,
-                                             commands_args_t argv,
+                                             const commands_args_t& argv,
                                              FastoObject* out) {
   CDBConnection* cdb = static_cast<CDBConnection*>(handler);
   std::string answer;
@@ -70,7 +70,7 @@ common::Error ApiTraits<CDBConnection>::Help(internal::CommandHandler* handler,
 
 template <class CDBConnection>
 common::Error ApiTraits<CDBConnection>::Scan(internal::CommandHandler* handler,
-                                             commands_args_t argv,
+                                             const commands_args_t& argv,
                                              FastoObject* out) {
   uint32_t cursor_in;
   if (!common::ConvertFromString(argv[0], &cursor_in)) {
@@ -112,7 +112,7 @@ common::Error ApiTraits<CDBConnection>::Scan(internal::CommandHandler* handler,
 
 template <class CDBConnection>
 common::Error ApiTraits<CDBConnection>::Keys(internal::CommandHandler* handler,
-                                             commands_args_t argv,
+                                             const commands_args_t& argv,
                                              FastoObject* out) {
   CDBConnection* cdb = static_cast<CDBConnection*>(handler);
 
@@ -139,7 +139,7 @@ common::Error ApiTraits<CDBConnection>::Keys(internal::CommandHandler* handler,
 
 template <class CDBConnection>
 common::Error ApiTraits<CDBConnection>::DBkcount(internal::CommandHandler* handler,
-                                                 commands_args_t argv,
+                                                 const commands_args_t& argv,
                                                  FastoObject* out) {
   UNUSED(argv);
 
@@ -159,7 +159,7 @@ common::Error ApiTraits<CDBConnection>::DBkcount(internal::CommandHandler* handl
 
 template <class CDBConnection>
 common::Error ApiTraits<CDBConnection>::CreateDatabase(CommandHandler* handler,
-                                                       commands_args_t argv,
+                                                       const commands_args_t& argv,
                                                        FastoObject* out) {
   CDBConnection* cdb = static_cast<CDBConnection*>(handler);
   common::Error err = cdb->CreateDB(argv[0]);
@@ -175,7 +175,7 @@ common::Error ApiTraits<CDBConnection>::CreateDatabase(CommandHandler* handler,
 
 template <class CDBConnection>
 common::Error ApiTraits<CDBConnection>::RemoveDatabase(CommandHandler* handler,
-                                                       commands_args_t argv,
+                                                       const commands_args_t& argv,
                                                        FastoObject* out) {
   CDBConnection* cdb = static_cast<CDBConnection*>(handler);
   common::Error err = cdb->RemoveDB(argv[0]);
@@ -191,7 +191,7 @@ common::Error ApiTraits<CDBConnection>::RemoveDatabase(CommandHandler* handler,
 
 template <class CDBConnection>
 common::Error ApiTraits<CDBConnection>::FlushDB(internal::CommandHandler* handler,
-                                                commands_args_t argv,
+                                                const commands_args_t& argv,
                                                 FastoObject* out) {
   UNUSED(argv);
 
@@ -208,7 +208,7 @@ common::Error ApiTraits<CDBConnection>::FlushDB(internal::CommandHandler* handle
 }
 
 template <class CDBConnection>
-common::Error ApiTraits<CDBConnection>::Select(CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error ApiTraits<CDBConnection>::Select(CommandHandler* handler, const commands_args_t& argv, FastoObject* out) {
   CDBConnection* cdb = static_cast<CDBConnection*>(handler);
   common::Error err = cdb->Select(argv[0], nullptr);
   if (err) {
@@ -222,7 +222,9 @@ common::Error ApiTraits<CDBConnection>::Select(CommandHandler* handler, commands
 }
 
 template <class CDBConnection>
-common::Error ApiTraits<CDBConnection>::Set(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error ApiTraits<CDBConnection>::Set(internal::CommandHandler* handler,
+                                            const commands_args_t& argv,
+                                            FastoObject* out) {
   key_t raw_key(argv[0]);
   NKey key(raw_key);
 
@@ -243,7 +245,9 @@ common::Error ApiTraits<CDBConnection>::Set(internal::CommandHandler* handler, c
 }
 
 template <class CDBConnection>
-common::Error ApiTraits<CDBConnection>::Get(internal::CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error ApiTraits<CDBConnection>::Get(internal::CommandHandler* handler,
+                                            const commands_args_t& argv,
+                                            FastoObject* out) {
   key_t raw_key(argv[0]);
   NKey key(raw_key);
 
@@ -263,7 +267,7 @@ common::Error ApiTraits<CDBConnection>::Get(internal::CommandHandler* handler, c
 
 template <class CDBConnection>
 common::Error ApiTraits<CDBConnection>::Delete(internal::CommandHandler* handler,
-                                               commands_args_t argv,
+                                               const commands_args_t& argv,
                                                FastoObject* out) {
   NKeys keysdel;
   for (size_t i = 0; i < argv.size(); ++i) {
@@ -287,7 +291,7 @@ common::Error ApiTraits<CDBConnection>::Delete(internal::CommandHandler* handler
 
 template <class CDBConnection>
 common::Error ApiTraits<CDBConnection>::Rename(internal::CommandHandler* handler,
-                                               commands_args_t argv,
+                                               const commands_args_t& argv,
                                                FastoObject* out) {
   key_t raw_key(argv[0]);
   NKey key(raw_key);
@@ -306,7 +310,7 @@ common::Error ApiTraits<CDBConnection>::Rename(internal::CommandHandler* handler
 
 template <class CDBConnection>
 common::Error ApiTraits<CDBConnection>::SetTTL(internal::CommandHandler* handler,
-                                               commands_args_t argv,
+                                               const commands_args_t& argv,
                                                FastoObject* out) {
   CDBConnection* cdb = static_cast<CDBConnection*>(handler);
   key_t raw_key(argv[0]);
@@ -330,7 +334,7 @@ common::Error ApiTraits<CDBConnection>::SetTTL(internal::CommandHandler* handler
 
 template <class CDBConnection>
 common::Error ApiTraits<CDBConnection>::GetTTL(internal::CommandHandler* handler,
-                                               commands_args_t argv,
+                                               const commands_args_t& argv,
                                                FastoObject* out) {
   CDBConnection* cdb = static_cast<CDBConnection*>(handler);
   key_t raw_key(argv[0]);
@@ -349,7 +353,9 @@ common::Error ApiTraits<CDBConnection>::GetTTL(internal::CommandHandler* handler
 }
 
 template <class CDBConnection>
-common::Error ApiTraits<CDBConnection>::ModuleLoad(CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error ApiTraits<CDBConnection>::ModuleLoad(CommandHandler* handler,
+                                                   const commands_args_t& argv,
+                                                   FastoObject* out) {
   CDBConnection* cdb = static_cast<CDBConnection*>(handler);
   ModuleInfo mod;
   mod.name = argv[0];
@@ -366,7 +372,9 @@ common::Error ApiTraits<CDBConnection>::ModuleLoad(CommandHandler* handler, comm
 }
 
 template <class CDBConnection>
-common::Error ApiTraits<CDBConnection>::ModuleUnLoad(CommandHandler* handler, commands_args_t argv, FastoObject* out) {
+common::Error ApiTraits<CDBConnection>::ModuleUnLoad(CommandHandler* handler,
+                                                     const commands_args_t& argv,
+                                                     FastoObject* out) {
   CDBConnection* cdb = static_cast<CDBConnection*>(handler);
   ModuleInfo mod;
   mod.name = argv[0];
@@ -384,7 +392,7 @@ common::Error ApiTraits<CDBConnection>::ModuleUnLoad(CommandHandler* handler, co
 
 template <class CDBConnection>
 common::Error ApiTraits<CDBConnection>::Quit(internal::CommandHandler* handler,
-                                             commands_args_t argv,
+                                             const commands_args_t& argv,
                                              FastoObject* out) {
   UNUSED(argv);
 
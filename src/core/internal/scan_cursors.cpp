@@ -0,0 +1,91 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "core/internal/scan_cursors.h"
+
+namespace fastonosql {
+namespace core {
+namespace internal {
+
+const common::time64_t ScanCursors::idle_timeout_msec = 5 * 60 * 1000;
+
+ScanCursors::ScanCursors() : cursors_() {}
+
+bool ScanCursors::Find(uint64_t cursor, const std::string& pattern, std::string* last_key) {
+  if (cursor == 0 || !last_key) {
+    return false;
+  }
+
+  const common::time64_t now = common::time::current_mstime();
+  EvictIdle(now);
+  auto it = cursors_.find(cursor);
+  if (it == cursors_.end()) {
+    return false;
+  }
+
+  ScanCursor& scur = it->second;
+  if (scur.pattern != pattern) {
+    return false;
+  }
+
+  scur.last_access = now;
+  *last_key = scur.last_key;
+  return true;
+}
+
+void ScanCursors::Register(uint64_t cursor, const std::string& pattern, const std::string& last_key) {
+  if (cursor == 0) {
+    return;
+  }
+
+  const common::time64_t now = common::time::current_mstime();
+  EvictIdle(now);
+  if (cursors_.size() >= max_cursors && cursors_.find(cursor) == cursors_.end()) {
+    auto oldest = cursors_.begin();
+    for (auto it = cursors_.begin(); it != cursors_.end(); ++it) {
+      if (it->second.last_access < oldest->second.last_access) {
+        oldest = it;
+      }
+    }
+    cursors_.erase(oldest);
+  }
+
+  ScanCursor scur;
+  scur.pattern = pattern;
+  scur.last_key = last_key;
+  scur.last_access = now;
+  cursors_[cursor] = scur;
+}
+
+void ScanCursors::Clear() {
+  cursors_.clear();
+}
+
+void ScanCursors::EvictIdle(common::time64_t now) {
+  for (auto it = cursors_.begin(); it != cursors_.end();) {
+    if (now - it->second.last_access > idle_timeout_msec) {
+      it = cursors_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+}  // namespace internal
+}  // namespace core
+}  // namespace fastonosql
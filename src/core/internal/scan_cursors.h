@@ -0,0 +1,58 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <map>
+#include <string>
+
+#include <common/time.h>  // for time64_t
+
+namespace fastonosql {
+namespace core {
+namespace internal {
+
+// registry of SCAN cursors for ordered embedded engines,
+// maps returned cursor to the last returned key, so next page can Seek instead of walking from first key
+class ScanCursors {
+ public:
+  enum { max_cursors = 64 };
+  static const common::time64_t idle_timeout_msec;
+
+  ScanCursors();
+
+  bool Find(uint64_t cursor, const std::string& pattern, std::string* last_key);
+  void Register(uint64_t cursor, const std::string& pattern, const std::string& last_key);
+  void Clear();
+
+ private:
+  struct ScanCursor {
+    std::string pattern;
+    std::string last_key;
+    common::time64_t last_access;
+  };
+  typedef std::map<uint64_t, ScanCursor> cursors_t;
+
+  void EvictIdle(common::time64_t now);
+
+  cursors_t cursors_;
+};
+
+}  // namespace internal
+}  // namespace core
+}  // namespace fastonosql
@@ -18,11 +18,32 @@
 
 #include "core/types.h"
 
+#include <ctype.h>
+
 #include <common/string_util.h>
 
 namespace fastonosql {
 namespace core {
 
+namespace {
+
+bool IsHexDigit(char c) {
+  return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+
+int HexDigitToInt(char c) {
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  } else if (c >= 'a' && c <= 'f') {
+    return c - 'a' + 10;
+  } else if (c >= 'A' && c <= 'F') {
+    return c - 'A' + 10;
+  }
+  return 0;
+}
+
+}  // namespace
+
 command_buffer_t StableCommand(const command_buffer_t& command) {
   if (command.empty()) {
     return command_buffer_t();
@@ -57,5 +78,110 @@ command_buffer_t StableCommand(const command_buffer_t& command) {
   return stabled_command;
 }
 
+bool SplitCommandArgs(const command_buffer_t& command, commands_args_t* argv) {
+  if (!argv) {
+    return false;
+  }
+
+  commands_args_t largv;
+  const command_buffer_char_t* p = command.c_str();
+  while (true) {
+    /* skip blanks */
+    while (*p && *p == ' ') {
+      p++;
+    }
+
+    if (!*p) {
+      break;
+    }
+
+    largv.push_back(command_buffer_t());
+    command_buffer_t& current = largv.back();
+    bool inq = false;   /* set to true if we are in "quotes" */
+    bool insq = false;  /* set to true if we are in 'single quotes' */
+    size_t inj = 0;     /* depth of {json} block */
+    bool done = false;
+    while (!done) {
+      if (inq) {
+        if (*p == '\\' && *(p + 1) == 'x' && IsHexDigit(*(p + 2)) && IsHexDigit(*(p + 3))) {
+          current += static_cast<command_buffer_char_t>(HexDigitToInt(*(p + 2)) * 16 + HexDigitToInt(*(p + 3)));
+          p += 3;
+        } else if (*p == '"') {
+          /* closing quote must be followed by a space or nothing at all */
+          if (*(p + 1) && !isspace(*(p + 1))) {
+            return false;
+          }
+          done = true;
+        } else if (!*p) {
+          /* unterminated quotes */
+          return false;
+        } else {
+          current += *p;
+        }
+      } else if (insq) {
+        if (*p == '\\' && *(p + 1) == '\'') {
+          p++;
+          current += '\'';
+        } else if (*p == '\'') {
+          /* closing quote must be followed by a space or nothing at all */
+          if (*(p + 1) && !isspace(*(p + 1))) {
+            return false;
+          }
+          done = true;
+        } else if (!*p) {
+          /* unterminated quotes */
+          return false;
+        } else {
+          current += *p;
+        }
+      } else if (inj) {
+        if (*p == '\\' && *(p + 1) == '}') {
+          p++;
+          current += '}';
+        } else if (*p == '{') {
+          inj++;
+          current += *p;
+        } else if (*p == '}') {
+          current += *p;
+          if (--inj == 0) {
+            done = true;
+          }
+        } else if (!*p) {
+          /* unterminated json */
+          return false;
+        } else {
+          current += *p;
+        }
+      } else {
+        switch (*p) {
+          case ' ':
+          case '\0':
+            done = true;
+            break;
+          case '"':
+            inq = true;
+            break;
+          case '\'':
+            insq = true;
+            break;
+          case '{':
+            inj = 1;
+            current += *p;
+            break;
+          default:
+            current += *p;
+            break;
+        }
+      }
+      if (*p) {
+        p++;
+      }
+    }
+  }
+
+  argv->swap(largv);
+  return true;
+}
+
 }  // namespace core
 }  // namespace fastonosql
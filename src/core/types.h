@@ -21,6 +21,8 @@
 #include <deque>
 #include <string>
 
+#include <common/macros.h>  // for WARN_UNUSED_RESULT
+
 namespace fastonosql {
 namespace core {
 
@@ -31,5 +33,9 @@ typedef std::deque<command_buffer_t> commands_args_t;
 
 command_buffer_t StableCommand(const command_buffer_t& command);
 
+// splits command line into arguments in place (quotes, \xNN escapes and {json} blocks are supported),
+// same rules as sdssplitargslong, but without intermediate sds buffers
+bool SplitCommandArgs(const command_buffer_t& command, commands_args_t* argv) WARN_UNUSED_RESULT;
+
 }  // namespace core
 }  // namespace fastonosql
@@ -18,46 +18,199 @@
 
 #include "core/value.h"
 
+#include <string.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define HAVE_AVX2_HEX
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define HAVE_SSE2_HEX
+#endif
+
 #include <algorithm>
+#include <deque>
 
 #include <common/convert2string.h>
 #include <common/utils.h>
 
 namespace {
 
+const char hex_digits[] = "0123456789abcdef";
+
+const struct HexTables {
+  HexTables() {
+    for (int i = 0; i < 256; ++i) {
+      encode[i][0] = hex_digits[i >> 4];
+      encode[i][1] = hex_digits[i & 0x0F];
+      decode[i] = -1;
+    }
+    for (int i = 0; i < 10; ++i) {
+      decode['0' + i] = i;
+    }
+    for (int i = 0; i < 6; ++i) {
+      decode['a' + i] = 10 + i;
+      decode['A' + i] = 10 + i;
+    }
+  }
+
+  char encode[256][2];
+  int8_t decode[256];
+} hex_tables;
+
+void hex_escape_scalar(const unsigned char* data, size_t size, char* out) {
+  for (size_t i = 0; i < size; ++i) {
+    *out++ = '\\';
+    *out++ = 'x';
+    *out++ = hex_tables.encode[data[i]][0];
+    *out++ = hex_tables.encode[data[i]][1];
+  }
+}
+
+bool hex_unescape_scalar(const unsigned char* data, size_t size, char* out) {
+  for (size_t i = 0; i < size; i += 4) {
+    if (data[i] != '\\' || data[i + 1] != 'x') {
+      return false;
+    }
+
+    const int8_t hi = hex_tables.decode[data[i + 2]];
+    const int8_t lo = hex_tables.decode[data[i + 3]];
+    if (hi < 0 || lo < 0) {
+      return false;
+    }
+    *out++ = static_cast<char>((hi << 4) | lo);
+  }
+
+  return true;
+}
+
+#if defined(HAVE_SSE2_HEX)
+// nibbles to lower case hex digits: n + '0' + (n > 9 ? 'a' - '0' - 10 : 0)
+inline __m128i nibbles_to_hex(__m128i nibbles) {
+  const __m128i over_nine = _mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9));
+  return _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')),
+                      _mm_and_si128(over_nine, _mm_set1_epi8('a' - '0' - 10)));
+}
+
+// 16 bytes to 64 chars, "\x" prefixes are interleaved as 16 bit words
+size_t hex_escape_sse2(const unsigned char* data, size_t size, char* out) {
+  const __m128i low_mask = _mm_set1_epi8(0x0F);
+  const __m128i prefix = _mm_set1_epi16(static_cast<short>('\\' | ('x' << 8)));
+  size_t i = 0;
+  for (; i + 16 <= size; i += 16) {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+    const __m128i hi = nibbles_to_hex(_mm_and_si128(_mm_srli_epi16(v, 4), low_mask));
+    const __m128i lo = nibbles_to_hex(_mm_and_si128(v, low_mask));
+    const __m128i pairs_lo = _mm_unpacklo_epi8(hi, lo);
+    const __m128i pairs_hi = _mm_unpackhi_epi8(hi, lo);
+    __m128i* dst = reinterpret_cast<__m128i*>(out + i * 4);
+    _mm_storeu_si128(dst, _mm_unpacklo_epi16(prefix, pairs_lo));
+    _mm_storeu_si128(dst + 1, _mm_unpackhi_epi16(prefix, pairs_lo));
+    _mm_storeu_si128(dst + 2, _mm_unpacklo_epi16(prefix, pairs_hi));
+    _mm_storeu_si128(dst + 3, _mm_unpackhi_epi16(prefix, pairs_hi));
+  }
+
+  return i;
+}
+
+inline __m128i in_range(__m128i v, char from, char to) {
+  return _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(from - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8(to + 1)));
+}
+
+// 16 chars ("\xHH" x 4) to 4 bytes in low bytes of 32 bit lanes, false if any char is unexpected
+inline bool hex_unescape_block(__m128i v, __m128i* bytes) {
+  const __m128i prefix = _mm_set1_epi32('\\' | ('x' << 8));
+  const __m128i prefix_mask = _mm_set1_epi32(0x0000FFFF);
+
+  const __m128i is_dec = in_range(v, '0', '9');
+  const __m128i lower = _mm_or_si128(v, _mm_set1_epi8(0x20));
+  const __m128i is_alpha = in_range(lower, 'a', 'f');
+  const __m128i dec = _mm_and_si128(is_dec, _mm_sub_epi8(v, _mm_set1_epi8('0')));
+  const __m128i alpha = _mm_and_si128(is_alpha, _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10)));
+  const __m128i digits_ok = _mm_andnot_si128(prefix_mask, _mm_or_si128(is_dec, is_alpha));
+  const __m128i prefix_ok = _mm_and_si128(prefix_mask, _mm_cmpeq_epi8(v, prefix));
+  if (_mm_movemask_epi8(_mm_or_si128(digits_ok, prefix_ok)) != 0xFFFF) {
+    return false;
+  }
+
+  const __m128i nibbles = _mm_srli_epi32(_mm_or_si128(dec, alpha), 16);  // hi | lo << 8
+  *bytes = _mm_or_si128(_mm_slli_epi32(_mm_and_si128(nibbles, _mm_set1_epi32(0x0F)), 4), _mm_srli_epi32(nibbles, 8));
+  return true;
+}
+
+// 64 chars to 16 bytes, returns count of consumed chars or npos on invalid input
+size_t hex_unescape_sse2(const unsigned char* data, size_t size, char* out) {
+  size_t i = 0;
+  for (; i + 64 <= size; i += 64) {
+    const __m128i* src = reinterpret_cast<const __m128i*>(data + i);
+    __m128i b0, b1, b2, b3;
+    if (!hex_unescape_block(_mm_loadu_si128(src), &b0) || !hex_unescape_block(_mm_loadu_si128(src + 1), &b1) ||
+        !hex_unescape_block(_mm_loadu_si128(src + 2), &b2) || !hex_unescape_block(_mm_loadu_si128(src + 3), &b3)) {
+      return std::string::npos;
+    }
+
+    const __m128i bytes = _mm_packus_epi16(_mm_packs_epi32(b0, b1), _mm_packs_epi32(b2, b3));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i / 4), bytes);
+  }
+
+  return i;
+}
+#endif
+
+#if defined(HAVE_AVX2_HEX)
+inline __m256i nibbles_to_hex(__m256i nibbles) {
+  const __m256i over_nine = _mm256_cmpgt_epi8(nibbles, _mm256_set1_epi8(9));
+  return _mm256_add_epi8(_mm256_add_epi8(nibbles, _mm256_set1_epi8('0')),
+                         _mm256_and_si256(over_nine, _mm256_set1_epi8('a' - '0' - 10)));
+}
+
+// as sse2 version, unpacks work inside 128 bit lanes, so halves are reordered before store
+size_t hex_escape_avx2(const unsigned char* data, size_t size, char* out) {
+  const __m256i low_mask = _mm256_set1_epi8(0x0F);
+  const __m256i prefix = _mm256_set1_epi16(static_cast<short>('\\' | ('x' << 8)));
+  size_t i = 0;
+  for (; i + 32 <= size; i += 32) {
+    const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+    const __m256i hi = nibbles_to_hex(_mm256_and_si256(_mm256_srli_epi16(v, 4), low_mask));
+    const __m256i lo = nibbles_to_hex(_mm256_and_si256(v, low_mask));
+    const __m256i pairs_lo = _mm256_unpacklo_epi8(hi, lo);  // bytes 0-7 | 16-23
+    const __m256i pairs_hi = _mm256_unpackhi_epi8(hi, lo);  // bytes 8-15 | 24-31
+    const __m256i a = _mm256_unpacklo_epi16(prefix, pairs_lo);  // 0-3 | 16-19
+    const __m256i b = _mm256_unpackhi_epi16(prefix, pairs_lo);  // 4-7 | 20-23
+    const __m256i c = _mm256_unpacklo_epi16(prefix, pairs_hi);  // 8-11 | 24-27
+    const __m256i d = _mm256_unpackhi_epi16(prefix, pairs_hi);  // 12-15 | 28-31
+    __m256i* dst = reinterpret_cast<__m256i*>(out + i * 4);
+    _mm256_storeu_si256(dst, _mm256_permute2x128_si256(a, b, 0x20));
+    _mm256_storeu_si256(dst + 1, _mm256_permute2x128_si256(c, d, 0x20));
+    _mm256_storeu_si256(dst + 2, _mm256_permute2x128_si256(a, b, 0x31));
+    _mm256_storeu_si256(dst + 3, _mm256_permute2x128_si256(c, d, 0x31));
+  }
+
+  return i;
+}
+#endif
+
 template <typename T>
 std::string string_from_hex_impl(const T& value) {
-  size_t len = value.size();
+  const size_t len = value.size();
   if (len % 4 != 0) {
     return std::string();
   }
 
-  std::string hex_digits;
-  for (size_t i = 0; i < len; i += 4) {
-    auto c1 = value[i];
-    auto c2 = value[i + 1];
-    if (c1 == '\\' && c2 == 'x') {
-      hex_digits += value[i + 2];
-      hex_digits += value[i + 3];
-    } else {
-      return std::string();
-    }
+  std::string result(len / 4, 0);
+  if (!fastonosql::core::detail::string_from_hex(reinterpret_cast<const char*>(value.data()), len, &result[0])) {
+    return std::string();
   }
 
-  return common::utils::hex::decode(hex_digits);
+  return result;
 }
 
 template <typename T>
 std::string hex_string_impl(const T& value) {
-  std::ostringstream wr;
-  auto hexed = common::utils::hex::encode(value, true);
-  for (size_t i = 0; i < hexed.size(); i += 2) {
-    wr << "\\x";
-    wr << hexed[i];
-    wr << hexed[i + 1];
-  }
-
-  return wr.str();
+  std::string result(value.size() * 4, 0);
+  fastonosql::core::detail::hex_string(reinterpret_cast<const char*>(value.data()), value.size(), &result[0]);
+  return result;
 }
 
 }  // namespace
@@ -70,6 +223,34 @@ bool have_space(const std::string& data) {
   return it != data.end();
 }
 
+void hex_string(const char* data, size_t size, char* out) {
+  const unsigned char* udata = reinterpret_cast<const unsigned char*>(data);
+  size_t done = 0;
+#if defined(HAVE_AVX2_HEX)
+  done = hex_escape_avx2(udata, size, out);
+#endif
+#if defined(HAVE_SSE2_HEX)
+  done += hex_escape_sse2(udata + done, size - done, out + done * 4);
+#endif
+  hex_escape_scalar(udata + done, size - done, out + done * 4);
+}
+
+bool string_from_hex(const char* data, size_t size, char* out) {
+  if (size % 4 != 0) {
+    return false;
+  }
+
+  const unsigned char* udata = reinterpret_cast<const unsigned char*>(data);
+  size_t done = 0;
+#if defined(HAVE_SSE2_HEX)
+  done = hex_unescape_sse2(udata, size, out);
+  if (done == std::string::npos) {
+    return false;
+  }
+#endif
+  return hex_unescape_scalar(udata + done, size - done, out + done / 4);
+}
+
 std::string hex_string(const common::buffer_t& value) {
   return hex_string_impl(value);
 }
@@ -88,6 +269,229 @@ std::string string_from_hex(const std::string& value) {
 
 }  // namespace detail
 
+IValueSink::~IValueSink() {}
+
+StringValueSink::StringValueSink(std::string* out) : out_(out) {}
+
+void StringValueSink::Write(const char* data, size_t size) {
+  out_->append(data, size);
+}
+
+BufferedValueSink::BufferedValueSink(flush_callback_t flush, size_t buffer_size)
+    : flush_(flush), buffer_(buffer_size ? buffer_size : default_buffer_size), size_(0), failed_(false) {}
+
+BufferedValueSink::~BufferedValueSink() {
+  Flush();
+}
+
+void BufferedValueSink::Write(const char* data, size_t size) {
+  while (size && !failed_) {
+    if (size_ == buffer_.size() && !Flush()) {
+      return;
+    }
+
+    const size_t chunk = std::min(size, buffer_.size() - size_);
+    memcpy(buffer_.data() + size_, data, chunk);
+    size_ += chunk;
+    data += chunk;
+    size -= chunk;
+  }
+}
+
+bool BufferedValueSink::Flush() {
+  if (failed_) {
+    return false;
+  }
+
+  if (size_ == 0) {
+    return true;
+  }
+
+  failed_ = !flush_(buffer_.data(), size_);
+  size_ = 0;
+  return !failed_;
+}
+
+bool BufferedValueSink::IsFailed() const {
+  return failed_;
+}
+
+namespace {
+
+class ValueWriter {
+ public:
+  ValueWriter(const std::string& delimiter, bool for_cmd, IValueSink* sink)
+      : delimiter_(delimiter),
+        for_cmd_(for_cmd),
+        sink_(sink),
+        pending_(nullptr),
+        written_(0),
+        scratch_(),
+        bytes_(),
+        pairs_(),
+        pairs_depth_(0) {}
+
+  void Write(common::Value* value) {
+    if (!value) {
+      return;
+    }
+
+    const common::Value::Type t = value->GetType();
+    if (t == common::Value::TYPE_NULL) {
+      return;
+    } else if (t == common::Value::TYPE_STRING) {
+      WriteString(static_cast<common::StringValue*>(value));
+    } else if (t == common::Value::TYPE_BYTE_ARRAY) {
+      WriteByteArray(static_cast<common::ByteArrayValue*>(value));
+    } else if (t == common::Value::TYPE_ARRAY) {
+      common::ArrayValue* array = static_cast<common::ArrayValue*>(value);
+      WriteElements(array->begin(), array->end());
+    } else if (t == common::Value::TYPE_SET) {
+      common::SetValue* set = static_cast<common::SetValue*>(value);
+      WriteElements(set->begin(), set->end());
+    } else if (t == common::Value::TYPE_ZSET) {
+      common::ZSetValue* zset = static_cast<common::ZSetValue*>(value);
+      WritePairs(zset->begin(), zset->end());
+    } else if (t == common::Value::TYPE_HASH) {
+      common::HashValue* hash = static_cast<common::HashValue*>(value);
+      WritePairs(hash->begin(), hash->end());
+    } else {
+      Emit(ConvertValue(static_cast<common::FundamentalValue*>(value), delimiter_, for_cmd_));
+    }
+  }
+
+ private:
+  // delimiter before element is written only when element itself writes something
+  void Emit(const char* data, size_t size) {
+    if (size == 0) {
+      return;
+    }
+
+    if (pending_) {
+      sink_->Write(pending_->data(), pending_->size());
+      pending_ = nullptr;
+    }
+    sink_->Write(data, size);
+    written_ += size;
+  }
+
+  void Emit(const std::string& data) { Emit(data.data(), data.size()); }
+
+  void WriteString(common::StringValue* value) {
+    if (!value->GetAsString(&scratch_) || scratch_.empty()) {
+      return;
+    }
+
+    const bool quote = for_cmd_ && detail::have_space(scratch_);
+    if (quote) {
+      Emit("\"", 1);
+    }
+    Emit(scratch_);
+    if (quote) {
+      Emit("\"", 1);
+    }
+  }
+
+  void WriteByteArray(common::ByteArrayValue* value) {
+    if (!value->GetAsByteArray(&bytes_) || bytes_.empty()) {
+      return;
+    }
+
+    if (!for_cmd_) {
+      Emit(common::ConvertToString(bytes_));
+      return;
+    }
+
+    scratch_.resize(bytes_.size() * 4);
+    detail::hex_string(reinterpret_cast<const char*>(bytes_.data()), bytes_.size(), &scratch_[0]);
+    Emit(scratch_);
+  }
+
+  template <typename It>
+  void WriteElements(It begin, It end) {
+    bool first = true;
+    for (It it = begin; it != end; ++it) {
+      const std::string* saved_pending = pending_;
+      if (!first) {
+        pending_ = &delimiter_;
+      }
+
+      const uint64_t before = written_;
+      Write(*it);
+      if (written_ == before) {  // empty elements are skipped with their delimiter
+        pending_ = saved_pending;
+        continue;
+      }
+      first = false;
+    }
+  }
+
+  // pair is skipped if key or value is empty, so both are rendered before writing
+  template <typename It>
+  void WritePairs(It begin, It end) {
+    const size_t depth = pairs_depth_++;
+    if (pairs_.size() <= depth) {
+      pairs_.resize(depth + 1);
+    }
+
+    std::string& key = pairs_[depth].first;
+    std::string& val = pairs_[depth].second;
+    bool first = true;
+    for (It it = begin; it != end; ++it) {
+      Render(it->first, &key);
+      Render(it->second, &val);
+      if (key.empty() || val.empty()) {
+        continue;
+      }
+
+      if (!first) {
+        Emit(delimiter_);
+      }
+      Emit(key);
+      Emit(" ", 1);
+      Emit(val);
+      first = false;
+    }
+    pairs_depth_--;
+  }
+
+  void Render(common::Value* value, std::string* out) {
+    out->clear();
+    StringValueSink sink(out);
+    IValueSink* saved_sink = sink_;
+    const std::string* saved_pending = pending_;
+    const uint64_t saved_written = written_;
+    sink_ = &sink;
+    pending_ = nullptr;
+    Write(value);
+    sink_ = saved_sink;
+    pending_ = saved_pending;
+    written_ = saved_written;
+  }
+
+  const std::string& delimiter_;
+  const bool for_cmd_;
+  IValueSink* sink_;
+  const std::string* pending_;  // delimiter to write before next data
+  uint64_t written_;
+  std::string scratch_;  // reused for leaf values
+  common::byte_array_t bytes_;
+  std::deque<std::pair<std::string, std::string>> pairs_;  // key, value buffers per nesting level
+  size_t pairs_depth_;
+};
+
+}  // namespace
+
+void WriteValue(common::Value* value, const std::string& delimiter, bool for_cmd, IValueSink* sink) {
+  if (!sink) {
+    DNOTREACHED();
+    return;
+  }
+
+  ValueWriter writer(delimiter, for_cmd, sink);
+  writer.Write(value);
+}
+
 std::string ConvertValue(common::Value* value, const std::string& delimiter, bool for_cmd) {
   if (!value) {
     return std::string();
@@ -133,93 +537,76 @@ std::string ConvertValue(common::Value* value, const std::string& delimiter, boo
   return std::string();
 }
 
-std::string ConvertValue(common::ArrayValue* array, const std::string& delimiter, bool for_cmd) {
-  if (!array) {
-    return std::string();
+void ConvertValueToArgs(common::Value* value, commands_args_t* args) {
+  if (!value || !args) {
+    return;
   }
 
-  std::string result;
-  auto lastIt = std::prev(array->end());
-  for (auto it = array->begin(); it != array->end(); ++it) {
-    common::Value* cur_val = *it;
-    std::string val_str = ConvertValue(cur_val, delimiter, for_cmd);
-    if (val_str.empty()) {
-      continue;
+  common::Value::Type t = value->GetType();
+  if (t == common::Value::TYPE_NULL) {
+    return;
+  } else if (t == common::Value::TYPE_STRING) {
+    std::string str;
+    if (value->GetAsString(&str)) {
+      args->push_back(str);
     }
-
-    result += val_str;
-    if (lastIt != it) {
-      result += delimiter;
+  } else if (t == common::Value::TYPE_BYTE_ARRAY) {
+    common::byte_array_t bytes;
+    if (value->GetAsByteArray(&bytes)) {
+      args->push_back(command_buffer_t(bytes.begin(), bytes.end()));
+    }
+  } else if (t == common::Value::TYPE_ARRAY) {
+    common::ArrayValue* array = static_cast<common::ArrayValue*>(value);
+    for (auto it = array->begin(); it != array->end(); ++it) {
+      ConvertValueToArgs(*it, args);
+    }
+  } else if (t == common::Value::TYPE_SET) {
+    common::SetValue* set = static_cast<common::SetValue*>(value);
+    for (auto it = set->begin(); it != set->end(); ++it) {
+      ConvertValueToArgs(*it, args);
+    }
+  } else if (t == common::Value::TYPE_ZSET) {
+    common::ZSetValue* zset = static_cast<common::ZSetValue*>(value);
+    for (auto it = zset->begin(); it != zset->end(); ++it) {
+      ConvertValueToArgs(it->first, args);
+      ConvertValueToArgs(it->second, args);
+    }
+  } else if (t == common::Value::TYPE_HASH) {
+    common::HashValue* hash = static_cast<common::HashValue*>(value);
+    for (auto it = hash->begin(); it != hash->end(); ++it) {
+      ConvertValueToArgs(it->first, args);
+      ConvertValueToArgs(it->second, args);
     }
+  } else {
+    args->push_back(ConvertValue(static_cast<common::FundamentalValue*>(value), std::string(), false));
   }
+}
 
+std::string ConvertValue(common::ArrayValue* array, const std::string& delimiter, bool for_cmd) {
+  std::string result;
+  StringValueSink sink(&result);
+  WriteValue(array, delimiter, for_cmd, &sink);
   return result;
 }
 
 std::string ConvertValue(common::SetValue* set, const std::string& delimiter, bool for_cmd) {
-  if (!set) {
-    return std::string();
-  }
-
   std::string result;
-  auto lastIt = std::prev(set->end());
-  for (auto it = set->begin(); it != set->end(); ++it) {
-    std::string val = ConvertValue((*it), delimiter, for_cmd);
-    if (val.empty()) {
-      continue;
-    }
-
-    result += val;
-    if (lastIt != it) {
-      result += delimiter;
-    }
-  }
-
+  StringValueSink sink(&result);
+  WriteValue(set, delimiter, for_cmd, &sink);
   return result;
 }
 
 std::string ConvertValue(common::ZSetValue* zset, const std::string& delimiter, bool for_cmd) {
-  if (!zset) {
-    return std::string();
-  }
-
   std::string result;
-  auto lastIt = std::prev(zset->end());
-  for (auto it = zset->begin(); it != zset->end(); ++it) {
-    auto v = *it;
-    std::string key = ConvertValue((v.first), delimiter, for_cmd);
-    std::string val = ConvertValue((v.second), delimiter, for_cmd);
-    if (val.empty() || key.empty()) {
-      continue;
-    }
-
-    result += key + " " + val;
-    if (lastIt != it) {
-      result += delimiter;
-    }
-  }
+  StringValueSink sink(&result);
+  WriteValue(zset, delimiter, for_cmd, &sink);
   return result;
 }
 
 std::string ConvertValue(common::HashValue* hash, const std::string& delimiter, bool for_cmd) {
-  if (!hash) {
-    return std::string();
-  }
-
   std::string result;
-  for (auto it = hash->begin(); it != hash->end(); ++it) {
-    auto v = *it;
-    std::string key = ConvertValue((v.first), delimiter, for_cmd);
-    std::string val = ConvertValue((v.second), delimiter, for_cmd);
-    if (val.empty() || key.empty()) {
-      continue;
-    }
-
-    result += key + " " + val;
-    if (std::next(it) != hash->end()) {
-      result += delimiter;
-    }
-  }
+  StringValueSink sink(&result);
+  WriteValue(hash, delimiter, for_cmd, &sink);
   return result;
 }
 
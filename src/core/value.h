@@ -18,19 +18,70 @@
 
 #pragma once
 
+#include <functional>
+#include <string>
+#include <vector>
+
 #include <common/value.h>  // for ArrayValue (ptr only), etc
 
+#include "core/types.h"  // for commands_args_t
+
 namespace fastonosql {
 namespace core {
 
 namespace detail {
 bool have_space(const std::string& data);
+// "\xNN" escaping, out must have room for 4 * size chars
+void hex_string(const char* data, size_t size, char* out);
+// out must have room for size / 4 bytes, false if data isn't "\xNN" escaped
+bool string_from_hex(const char* data, size_t size, char* out);
 std::string hex_string(const common::buffer_t& value);
 std::string hex_string(const std::string& value);
 std::string string_from_hex(const common::buffer_t& value);
 std::string string_from_hex(const std::string& value);
 }  // namespace detail
 
+// destination of serialized values
+class IValueSink {
+ public:
+  virtual void Write(const char* data, size_t size) = 0;
+  virtual ~IValueSink();
+};
+
+// appends to string, capacity of reused string is kept between values
+class StringValueSink : public IValueSink {
+ public:
+  explicit StringValueSink(std::string* out);
+  virtual void Write(const char* data, size_t size) override;
+
+ private:
+  std::string* const out_;
+};
+
+// accumulates data in fixed size buffer and passes it to flush callback when full,
+// used to stream large values to file or socket
+class BufferedValueSink : public IValueSink {
+ public:
+  typedef std::function<bool(const char* data, size_t size)> flush_callback_t;
+  enum { default_buffer_size = 64 * 1024 };
+
+  explicit BufferedValueSink(flush_callback_t flush, size_t buffer_size = default_buffer_size);
+  virtual ~BufferedValueSink();  // flushes the rest
+
+  virtual void Write(const char* data, size_t size) override;
+  bool Flush();
+  bool IsFailed() const;  // flush callback returned false, next data is dropped
+
+ private:
+  const flush_callback_t flush_;
+  std::vector<char> buffer_;
+  size_t size_;
+  bool failed_;
+};
+
+// single pass serialization in ConvertValue format, nested containers are written element by element
+void WriteValue(common::Value* value, const std::string& delimiter, bool for_cmd, IValueSink* sink);
+
 std::string ConvertValue(common::Value* value, const std::string& delimiter, bool for_cmd);
 std::string ConvertValue(common::ArrayValue* array, const std::string& delimiter, bool for_cmd);
 std::string ConvertValue(common::SetValue* set, const std::string& delimiter, bool for_cmd);
@@ -40,6 +91,9 @@ std::string ConvertValue(common::FundamentalValue* value, const std::string& del
 std::string ConvertValue(common::StringValue* value, const std::string& delimiter, bool for_cmd);
 std::string ConvertValue(common::ByteArrayValue* value, const std::string& delimiter, bool for_cmd);
 
+// one argument per element, pairs as two arguments in ConvertValue order, bytes are not escaped
+void ConvertValueToArgs(common::Value* value, commands_args_t* args);
+
 std::string ConvertToHumanReadable(common::Value* value, const std::string& delimiter = std::string());
 
 }  // namespace core
@@ -22,9 +22,17 @@
 #include <QComboBox>
 #include <QHBoxLayout>
 #include <QLabel>
+#include <QLineEdit>
+
+#include <common/qt/convert2string.h>
 
 #include "proxy/db/rocksdb/connection_settings.h"
 
+namespace {
+const QString trOpenMode = QObject::tr("Open mode:");
+const QString trSecondaryPath = QObject::tr("Secondary path:");
+}
+
 namespace fastonosql {
 namespace gui {
 namespace rocksdb {
@@ -44,6 +52,36 @@ ConnectionWidget::ConnectionWidget(QWidget* parent) : ConnectionLocalWidgetDirec
   type_comp_layout->addWidget(comparator_label_);
   type_comp_layout->addWidget(type_comparators_);
   addLayout(type_comp_layout);
+
+  QHBoxLayout* name_layout = new QHBoxLayout;
+  db_name_label_ = new QLabel;
+  name_layout->addWidget(db_name_label_);
+  db_name_edit_ = new QLineEdit;
+  name_layout->addWidget(db_name_edit_);
+  addLayout(name_layout);
+
+  QHBoxLayout* open_mode_layout = new QHBoxLayout;
+  open_modes_ = new QComboBox;
+  for (uint32_t i = 0; i < core::rocksdb::g_open_modes.size(); ++i) {
+    const char* mode = core::rocksdb::g_open_modes[i];
+    open_modes_->addItem(mode, i);
+  }
+  typedef void (QComboBox::*ind)(int);
+  VERIFY(connect(open_modes_, static_cast<ind>(&QComboBox::currentIndexChanged), this,
+                 &ConnectionWidget::openModeChange));
+
+  open_mode_label_ = new QLabel;
+  open_mode_layout->addWidget(open_mode_label_);
+  open_mode_layout->addWidget(open_modes_);
+  addLayout(open_mode_layout);
+
+  QHBoxLayout* secondary_layout = new QHBoxLayout;
+  secondary_path_label_ = new QLabel;
+  secondary_layout->addWidget(secondary_path_label_);
+  secondary_path_edit_ = new QLineEdit;
+  secondary_layout->addWidget(secondary_path_edit_);
+  addLayout(secondary_layout);
+  openModeChange(open_modes_->currentIndex());
 }
 
 void ConnectionWidget::syncControls(proxy::IConnectionSettingsBase* connection) {
@@ -52,6 +90,15 @@ void ConnectionWidget::syncControls(proxy::IConnectionSettingsBase* connection)
     core::rocksdb::Config config = rock->GetInfo();
     create_db_if_missing_->setChecked(config.create_if_missing);
     type_comparators_->setCurrentIndex(config.comparator);
+    QString qdb_name;
+    if (common::ConvertFromString(config.db_name, &qdb_name)) {
+      db_name_edit_->setText(qdb_name);
+    }
+    open_modes_->setCurrentIndex(config.open_mode);
+    QString qsecondary_path;
+    if (common::ConvertFromString(config.secondary_path, &qsecondary_path)) {
+      secondary_path_edit_->setText(qsecondary_path);
+    }
   }
   ConnectionLocalWidget::syncControls(rock);
 }
@@ -59,15 +106,33 @@ void ConnectionWidget::syncControls(proxy::IConnectionSettingsBase* connection)
 void ConnectionWidget::retranslateUi() {
   create_db_if_missing_->setText(trCreateDBIfMissing);
   comparator_label_->setText(trComparator);
+  db_name_label_->setText(trDBName);
+  open_mode_label_->setText(trOpenMode);
+  secondary_path_label_->setText(trSecondaryPath);
   ConnectionLocalWidget::retranslateUi();
 }
 
+bool ConnectionWidget::validated() const {
+  if (open_modes_->currentIndex() == core::rocksdb::OPEN_SECONDARY && secondary_path_edit_->text().isEmpty()) {
+    return false;
+  }
+
+  return ConnectionLocalWidget::validated();
+}
+
+void ConnectionWidget::openModeChange(int index) {
+  secondary_path_edit_->setEnabled(index == core::rocksdb::OPEN_SECONDARY);
+}
+
 proxy::IConnectionSettingsLocal* ConnectionWidget::createConnectionLocalImpl(
     const proxy::connection_path_t& path) const {
   proxy::rocksdb::ConnectionSettings* conn = new proxy::rocksdb::ConnectionSettings(path);
   core::rocksdb::Config config = conn->GetInfo();
   config.create_if_missing = create_db_if_missing_->isChecked();
   config.comparator = static_cast<core::rocksdb::ComparatorType>(type_comparators_->currentIndex());
+  config.db_name = common::ConvertToString(db_name_edit_->text());
+  config.open_mode = static_cast<core::rocksdb::OpenMode>(open_modes_->currentIndex());
+  config.secondary_path = common::ConvertToString(secondary_path_edit_->text());
   conn->SetInfo(config);
   return conn;
 }
@@ -31,6 +31,10 @@ class ConnectionWidget : public ConnectionLocalWidgetDirectoryPath {
 
   virtual void syncControls(proxy::IConnectionSettingsBase* connection) override;
   virtual void retranslateUi() override;
+  virtual bool validated() const override;
+
+ private Q_SLOTS:
+  void openModeChange(int index);
 
  private:
   virtual proxy::IConnectionSettingsLocal* createConnectionLocalImpl(
@@ -39,6 +43,15 @@ class ConnectionWidget : public ConnectionLocalWidgetDirectoryPath {
   QCheckBox* create_db_if_missing_;
   QLabel* comparator_label_;
   QComboBox* type_comparators_;
+
+  QLabel* db_name_label_;
+  QLineEdit* db_name_edit_;
+
+  QLabel* open_mode_label_;
+  QComboBox* open_modes_;
+
+  QLabel* secondary_path_label_;
+  QLineEdit* secondary_path_edit_;
 };
 
 }  // namespace rocksdb
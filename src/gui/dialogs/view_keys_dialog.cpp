@@ -171,14 +171,14 @@ void ViewKeysDialog::finishLoadDatabaseContent(const proxy::events_info::LoadDat
 void ViewKeysDialog::changeTTL(const core::NDbKValue& value, core::ttl_t ttl) {
   proxy::IServerSPtr server = db_->GetServer();
   core::translator_t tran = server->GetTranslator();
-  core::command_buffer_t cmd_str;
-  common::Error err = tran->ChangeKeyTTLCommand(value.GetKey(), ttl, &cmd_str);
+  core::commands_args_t cmd_args;
+  common::Error err = tran->ChangeKeyTTLCommand(value.GetKey(), ttl, &cmd_args);
   if (err) {
     LOG_ERROR(err, common::logging::LOG_LEVEL_ERR, true);
     return;
   }
 
-  proxy::events_info::ExecuteInfoRequest req(this, cmd_str);
+  proxy::events_info::ExecuteInfoRequest req(this, cmd_args);
   db_->Execute(req);
 }
 
@@ -19,6 +19,7 @@
 #include "gui/editor/fasto_editor_output.h"
 
 #include <QHBoxLayout>
+#include <QTimer>
 
 #include <Qsci/qscilexerjson.h>
 
@@ -34,7 +35,15 @@
 namespace fastonosql {
 namespace gui {
 
-FastoEditorOutput::FastoEditorOutput(QWidget* parent) : QWidget(parent), model_(nullptr), view_method_(JSON) {
+FastoEditorOutput::FastoEditorOutput(QWidget* parent)
+    : QWidget(parent),
+      model_(nullptr),
+      view_method_(JSON),
+      fragments_(),
+      pending_text_(),
+      needs_rebuild_(false),
+      update_scheduled_(false),
+      placeholder_shown_(false) {
   text_json_editor_ = new FastoEditor;
   json_lexer_ = new QsciLexerJSON;
   VERIFY(connect(text_json_editor_, &FastoEditor::textChanged, this, &FastoEditorOutput::textChanged));
@@ -120,26 +129,63 @@ void FastoEditorOutput::viewChange(int viewMethod) {
 void FastoEditorOutput::modelDestroyed() {}
 
 void FastoEditorOutput::dataChanged(QModelIndex first, QModelIndex last) {
-  UNUSED(first);
-  UNUSED(last);
-
-  layoutChanged();
+  invalidateItem(first);
+  invalidateItem(last);
+  scheduleUpdate();
 }
 
 void FastoEditorOutput::headerDataChanged() {}
 
 void FastoEditorOutput::rowsInserted(QModelIndex index, int r, int c) {
-  UNUSED(index);
-  UNUSED(r);
-  UNUSED(c);
+  // rows appended to the end of text are formatted alone,
+  // csv separators and first children of leaf item change already rendered text
+  const bool is_root = !index.isValid();
+  if (needs_rebuild_ || placeholder_shown_ || view_method_ == CSV || r == 0 || !isLastRows(index, c)) {
+    invalidateItem(index);
+    scheduleUpdate();
+    return;
+  }
 
-  layoutChanged();
+  const common::qt::gui::TreeItem* top = topLevelItem(index);
+  for (int i = r; i <= c; ++i) {
+    FastoCommonItem* child = common::qt::item<common::qt::gui::TreeItem*, FastoCommonItem*>(model_->index(i, 0, index));
+    if (!child) {
+      continue;
+    }
+
+    const QString text = formatItem(child);
+    pending_text_ += text;
+    if (is_root) {
+      fragments_[child] = text;
+      continue;
+    }
+
+    auto it = fragments_.find(top);
+    if (it != fragments_.end()) {
+      it->second += text;
+    } else {
+      needs_rebuild_ = true;
+    }
+  }
+
+  scheduleUpdate();
 }
 
 void FastoEditorOutput::rowsAboutToBeRemoved(QModelIndex index, int r, int c) {
-  UNUSED(index);
-  UNUSED(r);
-  UNUSED(c);
+  if (!model_) {
+    return;
+  }
+
+  if (index.isValid()) {
+    invalidateItem(index);
+  } else {
+    for (int i = r; i <= c; ++i) {
+      fragments_.erase(common::qt::item<common::qt::gui::TreeItem*, FastoCommonItem*>(model_->index(i, 0, index)));
+    }
+    needs_rebuild_ = true;
+  }
+
+  scheduleUpdate();
 }
 
 void FastoEditorOutput::rowsRemoved(QModelIndex index, int r, int c) {
@@ -216,23 +262,124 @@ int FastoEditorOutput::childCount() const {
 }
 
 void FastoEditorOutput::layoutChanged() {
-  SyncEditors();
+  fragments_.clear();
+  rebuild();
+}
 
-  if (!model_) {
+void FastoEditorOutput::flushUpdates() {
+  update_scheduled_ = false;
+  if (needs_rebuild_) {
+    rebuild();
     return;
   }
 
+  if (!pending_text_.isEmpty()) {
+    text_json_editor_->append(pending_text_);
+    pending_text_.clear();
+  }
+}
+
+QString FastoEditorOutput::formatItem(FastoCommonItem* item) const {
+  if (view_method_ == JSON) {
+    QString json = toJson(item);
+    return common::EscapedText(json);
+  } else if (view_method_ == CSV) {
+    QString csv = toCsv(item);
+    return common::EscapedText(csv);
+  } else if (view_method_ == RAW) {
+    QString raw = toRaw(item);
+    return common::EscapedText(raw);
+  } else if (view_method_ == HEX) {
+    QString raw = toRaw(item);
+    std::string str_raw = common::ConvertToString(raw);
+    std::string hexed = core::detail::hex_string(str_raw);
+    QString qhexed;
+    common::ConvertFromString(hexed, &qhexed);
+    return qhexed;
+  } else if (view_method_ == MSGPACK) {
+    QString msgp = fromHexMsgPack(item);
+    return common::EscapedText(msgp);
+  } else if (view_method_ == GZIP) {
+    QString gzip = fromGzip(item);
+    return common::EscapedText(gzip);
+  } else if (view_method_ == SNAPPY) {
+    QString snap = fromSnappy(item);
+    return common::EscapedText(snap);
+  }
+
+  NOTREACHED();
+  return QString();
+}
+
+common::qt::gui::TreeItem* FastoEditorOutput::rootItem() const {
+  if (!model_) {
+    return nullptr;
+  }
+
   QModelIndex index = model_->index(0, 0);
   if (!index.isValid()) {
-    return;
+    return nullptr;
   }
 
   FastoCommonItem* child = common::qt::item<common::qt::gui::TreeItem*, FastoCommonItem*>(index);
   if (!child) {
+    return nullptr;
+  }
+
+  return child->parent();
+}
+
+const common::qt::gui::TreeItem* FastoEditorOutput::topLevelItem(QModelIndex index) const {
+  if (!index.isValid()) {
+    return nullptr;
+  }
+
+  while (index.parent().isValid()) {
+    index = index.parent();
+  }
+
+  return common::qt::item<common::qt::gui::TreeItem*, FastoCommonItem*>(index);
+}
+
+bool FastoEditorOutput::isLastRows(QModelIndex parent, int last) const {
+  if (last != model_->rowCount(parent) - 1) {
+    return false;
+  }
+
+  while (parent.isValid()) {
+    if (parent.row() != model_->rowCount(parent.parent()) - 1) {
+      return false;
+    }
+    parent = parent.parent();
+  }
+
+  return true;
+}
+
+void FastoEditorOutput::invalidateItem(QModelIndex index) {
+  const common::qt::gui::TreeItem* top = topLevelItem(index);
+  if (top) {
+    fragments_.erase(top);
+  }
+  needs_rebuild_ = true;
+}
+
+void FastoEditorOutput::scheduleUpdate() {
+  if (update_scheduled_) {
     return;
   }
 
-  common::qt::gui::TreeItem* root = child->parent();
+  // coalesce bursts of model changes into one editor update
+  update_scheduled_ = true;
+  QTimer::singleShot(0, this, &FastoEditorOutput::flushUpdates);
+}
+
+void FastoEditorOutput::rebuild() {
+  SyncEditors();
+  needs_rebuild_ = false;
+  pending_text_.clear();
+
+  common::qt::gui::TreeItem* root = rootItem();
   if (!root) {
     return;
   }
@@ -256,6 +403,7 @@ void FastoEditorOutput::layoutChanged() {
     NOTREACHED();
   }
 
+  std::unordered_map<const common::qt::gui::TreeItem*, QString> fragments;
   QString result;
   for (size_t i = 0; i < root->childrenCount(); ++i) {
     FastoCommonItem* child = dynamic_cast<FastoCommonItem*>(root->child(i));  // +
@@ -263,35 +411,15 @@ void FastoEditorOutput::layoutChanged() {
       continue;
     }
 
-    if (view_method_ == JSON) {
-      QString json = toJson(child);
-      result += common::EscapedText(json);
-    } else if (view_method_ == CSV) {
-      QString csv = toCsv(child);
-      result += common::EscapedText(csv);
-    } else if (view_method_ == RAW) {
-      QString raw = toRaw(child);
-      result += common::EscapedText(raw);
-    } else if (view_method_ == HEX) {
-      QString raw = toRaw(child);
-      std::string str_raw = common::ConvertToString(raw);
-      std::string hexed = core::detail::hex_string(str_raw);
-      QString qhexed;
-      common::ConvertFromString(hexed, &qhexed);
-      result += qhexed;
-    } else if (view_method_ == MSGPACK) {
-      QString msgp = fromHexMsgPack(child);
-      result += common::EscapedText(msgp);
-    } else if (view_method_ == GZIP) {
-      QString gzip = fromGzip(child);
-      result += common::EscapedText(gzip);
-    } else if (view_method_ == SNAPPY) {
-      QString snap = fromSnappy(child);
-      result += common::EscapedText(snap);
-    }
+    auto it = fragments_.find(child);
+    const QString text = it != fragments_.end() ? it->second : formatItem(child);
+    fragments[child] = text;
+    result += text;
   }
+  fragments_.swap(fragments);
 
-  if (result.isEmpty()) {
+  placeholder_shown_ = result.isEmpty();
+  if (placeholder_shown_) {
     result = translations::trCannotConvertPattern1ArgsS.arg(methodText);
     text_json_editor_->setReadOnly(true);
   }
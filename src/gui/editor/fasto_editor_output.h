@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <unordered_map>
+
 #include "gui/editor/fasto_editor.h"
 
 #define JSON 0
@@ -28,9 +30,18 @@
 #define GZIP 5
 #define SNAPPY 6
 
+namespace common {
+namespace qt {
+namespace gui {
+class TreeItem;
+}
+}  // namespace qt
+}  // namespace common
+
 namespace fastonosql {
 namespace gui {
 class FastoHexEdit;
+class FastoCommonItem;
 
 class FastoEditorOutput : public QWidget {
   Q_OBJECT
@@ -67,15 +78,30 @@ class FastoEditorOutput : public QWidget {
   void columnsInserted(QModelIndex index, int r, int c);
   void reset();
   void layoutChanged();
+  void flushUpdates();
 
  private:
   void SyncEditors();
+  QString formatItem(FastoCommonItem* item) const;  // text of item in current view method
+  common::qt::gui::TreeItem* rootItem() const;
+  const common::qt::gui::TreeItem* topLevelItem(QModelIndex index) const;  // child of root which contains index
+  bool isLastRows(QModelIndex parent, int last) const;                     // rows are the end of the text
+  void invalidateItem(QModelIndex index);
+  void scheduleUpdate();
+  void rebuild();
 
   FastoEditor* text_json_editor_;
   QsciLexer* json_lexer_;
 
   QAbstractItemModel* model_;
   int view_method_;
+
+  // formatted text of root children, only changed children are formatted again on rebuild
+  std::unordered_map<const common::qt::gui::TreeItem*, QString> fragments_;
+  QString pending_text_;  // formatted appended rows, flushed by one append
+  bool needs_rebuild_;
+  bool update_scheduled_;
+  bool placeholder_shown_;
 };
 
 }  // namespace gui
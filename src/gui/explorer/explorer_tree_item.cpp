@@ -200,15 +200,15 @@ void ExplorerDatabaseItem::renameKey(const core::NKey& key, const QString& newNa
   CHECK(dbs);
   proxy::IServerSPtr server = dbs->GetServer();
   core::translator_t tran = server->GetTranslator();
-  core::command_buffer_t cmd_str;
+  core::commands_args_t cmd_args;
   core::string_key_t key_str = common::ConvertToString(newName);
-  common::Error err = tran->RenameKeyCommand(key, core::key_t(key_str), &cmd_str);
+  common::Error err = tran->RenameKeyCommand(key, core::key_t(key_str), &cmd_args);
   if (err) {
     LOG_ERROR(err, common::logging::LOG_LEVEL_ERR, true);
     return;
   }
 
-  proxy::events_info::ExecuteInfoRequest req(this, cmd_str);
+  proxy::events_info::ExecuteInfoRequest req(this, cmd_args);
   dbs->Execute(req);
 }
 
@@ -217,14 +217,14 @@ void ExplorerDatabaseItem::removeKey(const core::NKey& key) {
   CHECK(dbs);
   proxy::IServerSPtr server = dbs->GetServer();
   core::translator_t tran = server->GetTranslator();
-  core::command_buffer_t cmd_str;
-  common::Error err = tran->DeleteKeyCommand(key, &cmd_str);
+  core::commands_args_t cmd_args;
+  common::Error err = tran->DeleteKeyCommand(key, &cmd_args);
   if (err) {
     LOG_ERROR(err, common::logging::LOG_LEVEL_ERR, true);
     return;
   }
 
-  proxy::events_info::ExecuteInfoRequest req(this, cmd_str);
+  proxy::events_info::ExecuteInfoRequest req(this, cmd_args);
   dbs->Execute(req);
 }
 
@@ -233,14 +233,14 @@ void ExplorerDatabaseItem::loadValue(const core::NDbKValue& key) {
   CHECK(dbs);
   proxy::IServerSPtr server = dbs->GetServer();
   core::translator_t tran = server->GetTranslator();
-  core::command_buffer_t cmd_str;
-  common::Error err = tran->LoadKeyCommand(key.GetKey(), key.GetType(), &cmd_str);
+  core::commands_args_t cmd_args;
+  common::Error err = tran->LoadKeyCommand(key.GetKey(), key.GetType(), &cmd_args);
   if (err) {
     LOG_ERROR(err, common::logging::LOG_LEVEL_ERR, true);
     return;
   }
 
-  proxy::events_info::ExecuteInfoRequest req(this, cmd_str);
+  proxy::events_info::ExecuteInfoRequest req(this, cmd_args);
   dbs->Execute(req);
 }
 
@@ -249,14 +249,14 @@ void ExplorerDatabaseItem::watchKey(const core::NDbKValue& key, int interval) {
   CHECK(dbs);
   proxy::IServerSPtr server = dbs->GetServer();
   core::translator_t tran = server->GetTranslator();
-  core::command_buffer_t cmd_str;
-  common::Error err = tran->LoadKeyCommand(key.GetKey(), key.GetType(), &cmd_str);
+  core::commands_args_t cmd_args;
+  common::Error err = tran->LoadKeyCommand(key.GetKey(), key.GetType(), &cmd_args);
   if (err) {
     LOG_ERROR(err, common::logging::LOG_LEVEL_ERR, true);
     return;
   }
 
-  proxy::events_info::ExecuteInfoRequest req(this, cmd_str, std::numeric_limits<size_t>::max() - 1, interval, false);
+  proxy::events_info::ExecuteInfoRequest req(this, cmd_args, std::numeric_limits<size_t>::max() - 1, interval, false);
   dbs->Execute(req);
 }
 
@@ -265,14 +265,14 @@ void ExplorerDatabaseItem::createKey(const core::NDbKValue& key) {
   CHECK(dbs);
   proxy::IServerSPtr server = dbs->GetServer();
   core::translator_t tran = server->GetTranslator();
-  core::command_buffer_t cmd_str;
-  common::Error err = tran->CreateKeyCommand(key, &cmd_str);
+  core::commands_args_t cmd_args;
+  common::Error err = tran->CreateKeyCommand(key, &cmd_args);
   if (err) {
     LOG_ERROR(err, common::logging::LOG_LEVEL_ERR, true);
     return;
   }
 
-  proxy::events_info::ExecuteInfoRequest req(this, cmd_str);
+  proxy::events_info::ExecuteInfoRequest req(this, cmd_args);
   dbs->Execute(req);
 }
 
@@ -281,16 +281,16 @@ void ExplorerDatabaseItem::editKey(const core::NDbKValue& key, const core::NValu
   CHECK(dbs);
   proxy::IServerSPtr server = dbs->GetServer();
   core::translator_t tran = server->GetTranslator();
-  core::command_buffer_t cmd_str;
+  core::commands_args_t cmd_args;
   core::NDbKValue copy_key = key;
   copy_key.SetValue(value);
-  common::Error err = tran->CreateKeyCommand(copy_key, &cmd_str);
+  common::Error err = tran->CreateKeyCommand(copy_key, &cmd_args);
   if (err) {
     LOG_ERROR(err, common::logging::LOG_LEVEL_ERR, true);
     return;
   }
 
-  proxy::events_info::ExecuteInfoRequest req(this, cmd_str);
+  proxy::events_info::ExecuteInfoRequest req(this, cmd_args);
   dbs->Execute(req);
 }
 
@@ -299,14 +299,14 @@ void ExplorerDatabaseItem::setTTL(const core::NKey& key, core::ttl_t ttl) {
   CHECK(dbs);
   proxy::IServerSPtr server = dbs->GetServer();
   core::translator_t tran = server->GetTranslator();
-  core::command_buffer_t cmd_str;
-  common::Error err = tran->ChangeKeyTTLCommand(key, ttl, &cmd_str);
+  core::commands_args_t cmd_args;
+  common::Error err = tran->ChangeKeyTTLCommand(key, ttl, &cmd_args);
   if (err) {
     LOG_ERROR(err, common::logging::LOG_LEVEL_ERR, true);
     return;
   }
 
-  proxy::events_info::ExecuteInfoRequest req(this, cmd_str);
+  proxy::events_info::ExecuteInfoRequest req(this, cmd_args);
   dbs->Execute(req);
 }
 
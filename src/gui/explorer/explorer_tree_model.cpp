@@ -20,6 +20,9 @@
 
 #include <QIcon>
 
+#include <utility>
+#include <vector>
+
 #include <common/net/types.h>  // for ConvertToString
 
 #include <common/qt/convert2string.h>
@@ -220,6 +223,7 @@ void ExplorerTreeModel::removeCluster(proxy::IClusterSPtr cluster) {
 
   ExplorerClusterItem* serverItem = findClusterItem(cluster);
   if (serverItem) {
+    removeKeysIndexes(serverItem);
     removeItem(QModelIndex(), serverItem);
   }
 }
@@ -246,6 +250,7 @@ void ExplorerTreeModel::removeServer(proxy::IServerSPtr server) {
 
   ExplorerServerItem* serverItem = findServerItem(server.get());
   if (serverItem) {
+    removeKeysIndexes(serverItem);
     removeItem(QModelIndex(), serverItem);
   }
 }
@@ -272,6 +277,7 @@ void ExplorerTreeModel::removeSentinel(proxy::ISentinelSPtr sentinel) {
 
   ExplorerSentinelItem* serverItem = findSentinelItem(sentinel);
   if (serverItem) {
+    removeKeysIndexes(serverItem);
     removeItem(QModelIndex(), serverItem);
   }
 }
@@ -301,6 +307,7 @@ void ExplorerTreeModel::removeDatabase(proxy::IServer* server, core::IDataBaseIn
   if (dbs) {
     common::qt::gui::TreeItem* parent_server = parent->parent();
     QModelIndex index = createIndex(parent_server->indexOf(parent), 0, dbs);
+    removeKeysIndexes(dbs);
     removeItem(index.parent(), dbs);
   }
 }
@@ -343,6 +350,13 @@ void ExplorerTreeModel::addKey(proxy::IServer* server,
                                core::IDataBaseInfoSPtr db,
                                const core::NDbKValue& dbv,
                                const std::string& ns_separator) {
+  addKeys(server, db, core::NDbKValues(1, dbv), ns_separator);
+}
+
+void ExplorerTreeModel::addKeys(proxy::IServer* server,
+                                core::IDataBaseInfoSPtr db,
+                                const core::NDbKValues& keys,
+                                const std::string& ns_separator) {
   ExplorerServerItem* parent = findServerItem(server);
   if (!parent) {
     return;
@@ -353,19 +367,47 @@ void ExplorerTreeModel::addKey(proxy::IServer* server,
     return;
   }
 
-  core::NKey key = dbv.GetKey();
-  ExplorerKeyItem* keyit = findKeyItem(dbs, key);
-  if (!keyit) {
+  // new items grouped by parent in order of appearance
+  typedef std::pair<IExplorerTreeItem*, std::vector<ExplorerKeyItem*>> pending_items_t;
+  std::vector<pending_items_t> pending;
+  std::unordered_map<IExplorerTreeItem*, size_t> pending_pos;
+  KeysIndex& keys_index = keys_indexes_[dbs];
+  for (size_t i = 0; i < keys.size(); ++i) {
+    const core::NDbKValue& dbv = keys[i];
+    const core::NKey key = dbv.GetKey();
+    const std::string key_data = key.GetKey().GetKeyData();
+    if (keys_index.keys.find(key_data) != keys_index.keys.end()) {
+      continue;
+    }
+
     IExplorerTreeItem* nitem = dbs;
     proxy::KeyInfo kinf(key.GetKey(), ns_separator);
     if (kinf.HasNamespace()) {
-      nitem = findOrCreateNSItem(dbs, kinf);
+      nitem = findOrCreateNSItem(dbs, kinf, ns_separator);
+    }
+
+    auto pos = pending_pos.find(nitem);
+    if (pos == pending_pos.end()) {
+      pos = pending_pos.insert(std::make_pair(nitem, pending.size())).first;
+      pending.push_back(pending_items_t(nitem, std::vector<ExplorerKeyItem*>()));
     }
 
+    ExplorerKeyItem* item = new ExplorerKeyItem(dbv, nitem);
+    pending[pos->second].second.push_back(item);
+    keys_index.keys[key_data] = item;
+  }
+
+  for (size_t i = 0; i < pending.size(); ++i) {
+    IExplorerTreeItem* nitem = pending[i].first;
+    const std::vector<ExplorerKeyItem*>& items = pending[i].second;
     common::qt::gui::TreeItem* parent_nitem = nitem->parent();
     QModelIndex parent_index = createIndex(parent_nitem->indexOf(nitem), 0, nitem);
-    ExplorerKeyItem* item = new ExplorerKeyItem(dbv, nitem);
-    insertItem(parent_index, item);
+    const int first = nitem->childrenCount();
+    beginInsertRows(parent_index, first, first + static_cast<int>(items.size()) - 1);
+    for (size_t j = 0; j < items.size(); ++j) {
+      nitem->addChildren(items[j]);
+    }
+    endInsertRows();
   }
 }
 
@@ -384,6 +426,7 @@ void ExplorerTreeModel::removeKey(proxy::IServer* server, core::IDataBaseInfoSPt
   if (keyit) {
     common::qt::gui::TreeItem* par = keyit->parent();
     QModelIndex index = createIndex(par->indexOf(keyit), 0, keyit);
+    keys_indexes_[dbs].keys.erase(key.GetKey().GetKeyData());
     removeItem(index.parent(), keyit);
   }
 }
@@ -407,6 +450,9 @@ void ExplorerTreeModel::updateKey(proxy::IServer* server,
     common::qt::gui::TreeItem* par = keyit->parent();
     int index_key = par->indexOf(keyit);
     keyit->setKey(new_key);
+    KeysIndex& keys_index = keys_indexes_[dbs];
+    keys_index.keys.erase(old_key.GetKey().GetKeyData());
+    keys_index.keys[new_key.GetKey().GetKeyData()] = keyit;
     QModelIndex key_index1 = createIndex(index_key, ExplorerKeyItem::eName, dbs);
     QModelIndex key_index2 = createIndex(index_key, ExplorerKeyItem::eCountColumns, dbs);
     updateItem(key_index1, key_index2);
@@ -447,6 +493,7 @@ void ExplorerTreeModel::removeAllKeys(proxy::IServer* server, core::IDataBaseInf
   };
 
   QModelIndex parentdb = createIndex(parent->indexOf(dbs), 0, dbs);
+  keys_indexes_.erase(dbs);
   removeAllItems(parentdb);
 }
 
@@ -522,44 +569,44 @@ ExplorerDatabaseItem* ExplorerTreeModel::findDatabaseItem(ExplorerServerItem* se
   return nullptr;
 }
 
-ExplorerKeyItem* ExplorerTreeModel::findKeyItem(IExplorerTreeItem* db_or_ns, const core::NKey& key) const {
-  return static_cast<ExplorerKeyItem*>(
-      common::qt::gui::findItemRecursive(db_or_ns, [&key](common::qt::gui::TreeItem* item) -> bool {
-        ExplorerKeyItem* key_item = static_cast<ExplorerKeyItem*>(item);
-        if (key_item->type() != IExplorerTreeItem::eKey) {
-          return false;
-        }
+ExplorerKeyItem* ExplorerTreeModel::findKeyItem(ExplorerDatabaseItem* db, const core::NKey& key) const {
+  auto keys_index = keys_indexes_.find(db);
+  if (keys_index == keys_indexes_.end()) {
+    return nullptr;
+  }
 
-        return key_item->equalsKey(key);
-      }));
+  const auto& keys = keys_index->second.keys;
+  auto it = keys.find(key.GetKey().GetKeyData());
+  if (it == keys.end()) {
+    return nullptr;
+  }
+
+  return it->second;
 }
 
-ExplorerNSItem* ExplorerTreeModel::findOrCreateNSItem(IExplorerTreeItem* db_or_ns, const proxy::KeyInfo& kinf) {
+ExplorerNSItem* ExplorerTreeModel::findOrCreateNSItem(ExplorerDatabaseItem* db,
+                                                      const proxy::KeyInfo& kinf,
+                                                      const std::string& ns_separator) {
   auto nspaces = kinf.GetNamespaces();
-  IExplorerTreeItem* par = db_or_ns;
+  auto& namespaces = keys_indexes_[db].namespaces;
+  IExplorerTreeItem* par = db;
   ExplorerNSItem* founded_item = nullptr;
+  std::string ns_path;
   for (size_t i = 0; i < nspaces.size(); ++i) {
-    ExplorerNSItem* item = nullptr;
     std::string cur_ns = nspaces[i];
-    QString qnspace;
-    common::ConvertFromString(cur_ns, &qnspace);
-
-    for (size_t j = 0; j < par->childrenCount(); ++j) {
-      ExplorerNSItem* ns_item = static_cast<ExplorerNSItem*>(par->child(j));
-      if (ns_item->type() != IExplorerTreeItem::eNamespace) {
-        continue;
-      }
-
-      if (ns_item->name() == qnspace) {
-        item = ns_item;
-      }
-    }
-
-    if (!item) {
+    ns_path += i == 0 ? cur_ns : ns_separator + cur_ns;
+    ExplorerNSItem* item = nullptr;
+    auto it = namespaces.find(ns_path);
+    if (it != namespaces.end()) {
+      item = it->second;
+    } else {
+      QString qnspace;
+      common::ConvertFromString(cur_ns, &qnspace);
       common::qt::gui::TreeItem* gpar = par->parent();
       QModelIndex parentdb = createIndex(gpar->indexOf(par), 0, par);
       item = new ExplorerNSItem(qnspace, par);
       insertItem(parentdb, item);
+      namespaces[ns_path] = item;
     }
 
     par = item;
@@ -569,5 +616,12 @@ ExplorerNSItem* ExplorerTreeModel::findOrCreateNSItem(IExplorerTreeItem* db_or_n
   CHECK(founded_item);
   return founded_item;
 }
+
+void ExplorerTreeModel::removeKeysIndexes(const common::qt::gui::TreeItem* item) {
+  keys_indexes_.erase(item);
+  common::qt::gui::forEachRecursive(
+      item, [this](const common::qt::gui::TreeItem* child) { keys_indexes_.erase(child); });
+}
+
 }  // namespace gui
 }  // namespace fastonosql
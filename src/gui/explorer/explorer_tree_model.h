@@ -18,6 +18,9 @@
 
 #pragma once
 
+#include <string>
+#include <unordered_map>
+
 #include <common/qt/gui/base/tree_model.h>  // for TreeModel
 
 #include "proxy/database/idatabase.h"
@@ -71,6 +74,10 @@ class ExplorerTreeModel : public common::qt::gui::TreeModel {
               core::IDataBaseInfoSPtr db,
               const core::NDbKValue& dbv,
               const std::string& ns_separator);
+  void addKeys(proxy::IServer* server,
+               core::IDataBaseInfoSPtr db,
+               const core::NDbKValues& keys,
+               const std::string& ns_separator);  // one insert rows notification per parent item
   void removeKey(proxy::IServer* server, core::IDataBaseInfoSPtr db, const core::NKey& key);
   void updateKey(proxy::IServer* server,
                  core::IDataBaseInfoSPtr db,
@@ -84,8 +91,19 @@ class ExplorerTreeModel : public common::qt::gui::TreeModel {
   ExplorerSentinelItem* findSentinelItem(proxy::ISentinelSPtr sentinel);
   ExplorerServerItem* findServerItem(proxy::IServer* server) const;
   ExplorerDatabaseItem* findDatabaseItem(ExplorerServerItem* server, core::IDataBaseInfoSPtr db) const;
-  ExplorerKeyItem* findKeyItem(IExplorerTreeItem* db_or_ns, const core::NKey& key) const;
-  ExplorerNSItem* findOrCreateNSItem(IExplorerTreeItem* db_or_ns, const proxy::KeyInfo& kinf);
+  ExplorerKeyItem* findKeyItem(ExplorerDatabaseItem* db, const core::NKey& key) const;
+  ExplorerNSItem* findOrCreateNSItem(ExplorerDatabaseItem* db,
+                                     const proxy::KeyInfo& kinf,
+                                     const std::string& ns_separator);
+  void removeKeysIndexes(const common::qt::gui::TreeItem* item);  // item and all it children
+
+  // per database lookup of key and namespace items, so adding keys doesn't walk the tree
+  struct KeysIndex {
+    std::unordered_map<std::string, ExplorerKeyItem*> keys;       // by key bytes
+    std::unordered_map<std::string, ExplorerNSItem*> namespaces;  // by namespaces path joined with separator
+  };
+  typedef std::unordered_map<const common::qt::gui::TreeItem*, KeysIndex> keys_indexes_t;
+  keys_indexes_t keys_indexes_;
 };
 
 }  // namespace gui
@@ -282,6 +282,17 @@ void ExplorerTreeView::showContextMenu(const QPoint& point) {
       menu.addAction(exportAction);
       importAction->setEnabled(is_connected && is_local);
       menu.addAction(importAction);
+    } else if (server->IsCanBackupLocalDatabase()) {
+      QAction* backupAction = new QAction(translations::trBackup, this);
+      VERIFY(connect(backupAction, &QAction::triggered, this, &ExplorerTreeView::backupLocalServer));
+
+      QAction* restoreAction = new QAction(translations::trRestore, this);
+      VERIFY(connect(restoreAction, &QAction::triggered, this, &ExplorerTreeView::restoreLocalServer));
+
+      backupAction->setEnabled(is_connected);
+      menu.addAction(backupAction);
+      restoreAction->setEnabled(is_connected);
+      menu.addAction(restoreAction);
     }
 
     QAction* historyServerAction = new QAction(translations::trHistory, this);
@@ -662,6 +673,57 @@ void ExplorerTreeView::exportServer() {
   }
 }
 
+void ExplorerTreeView::backupLocalServer() {
+  QModelIndexList selected = selectedEqualTypeIndexes();
+  for (QModelIndex ind : selected) {
+    ExplorerServerItem* node = common::qt::item<common::qt::gui::TreeItem*, ExplorerServerItem*>(ind);
+    if (!node) {
+      DNOTREACHED();
+      continue;
+    }
+
+    proxy::IServerSPtr server = node->server();
+    if (!server) {
+      DNOTREACHED();
+      break;
+    }
+
+    // rocksdb keeps incremental backups in folder
+    QString path = server->GetType() == core::ROCKSDB
+                       ? QFileDialog::getExistingDirectory(this, translations::trBackup)
+                       : QFileDialog::getSaveFileName(this, translations::trBackup);
+    if (!path.isEmpty()) {
+      proxy::events_info::BackupInfoRequest req(this, common::ConvertToString(path));
+      server->BackupToPath(req);
+    }
+  }
+}
+
+void ExplorerTreeView::restoreLocalServer() {
+  QModelIndexList selected = selectedEqualTypeIndexes();
+  for (QModelIndex ind : selected) {
+    ExplorerServerItem* node = common::qt::item<common::qt::gui::TreeItem*, ExplorerServerItem*>(ind);
+    if (!node) {
+      DNOTREACHED();
+      continue;
+    }
+
+    proxy::IServerSPtr server = node->server();
+    if (!server) {
+      DNOTREACHED();
+      break;
+    }
+
+    QString path = server->GetType() == core::ROCKSDB
+                       ? QFileDialog::getExistingDirectory(this, translations::trRestore)
+                       : QFileDialog::getOpenFileName(this, translations::trRestore);
+    if (!path.isEmpty()) {
+      proxy::events_info::RestoreInfoRequest req(this, common::ConvertToString(path));
+      server->RestoreFromPath(req);
+    }
+  }
+}
+
 void ExplorerTreeView::loadContentDb() {
   QModelIndexList selected = selectedEqualTypeIndexes();
   for (QModelIndex ind : selected) {
@@ -928,12 +990,8 @@ void ExplorerTreeView::finishLoadDatabaseContent(const proxy::events_info::LoadD
   proxy::IServer* serv = qobject_cast<proxy::IServer*>(sender());
   CHECK(serv);
 
-  proxy::events_info::LoadDatabaseContentResponce::keys_container_t keys = res.keys;
   const std::string ns = serv->GetNsSeparator();
-  for (size_t i = 0; i < keys.size(); ++i) {
-    core::NDbKValue key = keys[i];
-    source_model_->addKey(serv, res.inf, key, ns);
-  }
+  source_model_->addKeys(serv, res.inf, res.keys, ns);
 
   source_model_->updateDb(serv, res.inf);
 }
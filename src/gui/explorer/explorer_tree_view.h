@@ -74,6 +74,8 @@ class ExplorerTreeView : public QTreeView {
 
   void importServer();
   void exportServer();
+  void backupLocalServer();
+  void restoreLocalServer();
 
   void loadContentDb();
   void removeAllKeys();
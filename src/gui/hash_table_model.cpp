@@ -28,7 +28,8 @@
 namespace fastonosql {
 namespace gui {
 
-HashTableModel::HashTableModel(QObject* parent) : common::qt::gui::TableModel(parent) {
+HashTableModel::HashTableModel(QObject* parent)
+    : common::qt::gui::TableModel(parent), cursor_(0), has_more_(false), fetching_(false) {
   data_.push_back(createEmptyRow());
 }
 
@@ -115,6 +116,19 @@ int HashTableModel::columnCount(const QModelIndex& parent) const {
   return KeyValueTableItem::kCountColumns;
 }
 
+bool HashTableModel::canFetchMore(const QModelIndex& parent) const {
+  return !parent.isValid() && has_more_ && !fetching_;
+}
+
+void HashTableModel::fetchMore(const QModelIndex& parent) {
+  if (!canFetchMore(parent)) {
+    return;
+  }
+
+  fetching_ = true;
+  emit pageRequested(cursor_);
+}
+
 void HashTableModel::clear() {
   beginResetModel();
   for (size_t i = 0; i < data_.size(); ++i) {
@@ -122,9 +136,45 @@ void HashTableModel::clear() {
   }
   data_.clear();
   data_.push_back(createEmptyRow());
+  cursor_ = 0;
+  has_more_ = false;
+  fetching_ = false;
   endResetModel();
 }
 
+void HashTableModel::startPaging() {
+  clear();
+  has_more_ = true;
+  fetchMore(QModelIndex());
+}
+
+void HashTableModel::appendPage(const rows_t& rows, uint64_t cursor) {
+  fetching_ = false;
+  cursor_ = cursor;
+  has_more_ = cursor != 0;
+  if (rows.empty()) {
+    return;
+  }
+
+  const size_t size = data_.size();
+  beginInsertRows(QModelIndex(), size - 1, size + rows.size() - 2);
+  std::vector<common::qt::gui::TableItem*> items;
+  items.reserve(rows.size());
+  for (size_t i = 0; i < rows.size(); ++i) {
+    items.push_back(new KeyValueTableItem(rows[i].first, rows[i].second, KeyValueTableItem::RemoveAction));
+  }
+  data_.insert(data_.begin() + size - 1, items.begin(), items.end());
+  endInsertRows();
+}
+
+void HashTableModel::cancelPage() {
+  fetching_ = false;
+}
+
+bool HashTableModel::isFullyLoaded() const {
+  return !has_more_ && !fetching_;
+}
+
 common::ArrayValue* HashTableModel::arrayValue() const {
   if (data_.size() < 2) {
     return nullptr;
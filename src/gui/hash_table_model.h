@@ -18,6 +18,9 @@
 
 #pragma once
 
+#include <utility>
+#include <vector>
+
 #include <common/qt/gui/base/table_model.h>
 #include <common/value.h>
 
@@ -27,6 +30,7 @@ namespace gui {
 class HashTableModel : public common::qt::gui::TableModel {
   Q_OBJECT
  public:
+  typedef std::vector<std::pair<QString, QString>> rows_t;
   explicit HashTableModel(QObject* parent = Q_NULLPTR);
   virtual ~HashTableModel();
 
@@ -36,8 +40,17 @@ class HashTableModel : public common::qt::gui::TableModel {
   virtual QVariant headerData(int section, Qt::Orientation orientation, int role) const override;
 
   virtual int columnCount(const QModelIndex& parent) const override;
+  virtual bool canFetchMore(const QModelIndex& parent) const override;
+  virtual void fetchMore(const QModelIndex& parent) override;
   void clear();
 
+  // rows loaded by pages: view scrolled to the end requests next page by pageRequested,
+  // owner answers with appendPage, cursor 0 means last page
+  void startPaging();
+  void appendPage(const rows_t& rows, uint64_t cursor);
+  void cancelPage();  // failed page is requested again on next scroll
+  bool isFullyLoaded() const;
+
   common::ArrayValue* arrayValue() const;  // alocate memory
   common::SetValue* setValue() const;      // alocate memory
   common::ZSetValue* zsetValue() const;    // alocate memory
@@ -46,11 +59,18 @@ class HashTableModel : public common::qt::gui::TableModel {
   void insertRow(const QString& key, const QString& value);
   void removeRow(int row);
 
+ Q_SIGNALS:
+  void pageRequested(uint64_t cursor);
+
  private:
   using TableModel::insertItem;
   using TableModel::removeItem;
 
   common::qt::gui::TableItem* createEmptyRow() const;
+
+  uint64_t cursor_;
+  bool has_more_;
+  bool fetching_;
 };
 
 }  // namespace gui
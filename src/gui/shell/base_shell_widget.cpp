@@ -59,6 +59,8 @@ const QString trCantSaveTemplate_2S = QObject::tr(PROJECT_NAME_TITLE " can't sav
 const QString trAdvancedOptions = QObject::tr("Advanced options");
 const QString trIntervalMsec = QObject::tr("Interval msec:");
 const QString trRepeat = QObject::tr("Repeat:");
+const QString trBenchmark = QObject::tr("Benchmark");
+const QString trConcurrency = QObject::tr("Concurrency:");
 const QString trBasedOn_2S = QObject::tr("Based on <b>%1</b> version: <b>%2</b>");
 
 }  // namespace
@@ -212,9 +214,25 @@ void BaseShellWidget::init() {
 
   historyCall_ = new QCheckBox;
   historyCall_->setChecked(true);
+  pipelineCall_ = new QCheckBox;
+  pipelineCall_->setChecked(false);
+  benchmarkCall_ = new QCheckBox;
+  benchmarkCall_->setChecked(false);
+
+  QHBoxLayout* concurrencyLayout = new QHBoxLayout;
+  QLabel* concurrencyLabel = new QLabel(trConcurrency);
+  concurrency_ = new QSpinBox;
+  concurrency_->setRange(1, 256);
+  concurrency_->setSingleStep(1);
+  concurrencyLayout->addWidget(concurrencyLabel);
+  concurrencyLayout->addWidget(concurrency_);
+
   advOptLayout->addLayout(repeatLayout);
   advOptLayout->addLayout(intervalLayout);
   advOptLayout->addWidget(historyCall_);
+  advOptLayout->addWidget(pipelineCall_);
+  advOptLayout->addWidget(benchmarkCall_);
+  advOptLayout->addLayout(concurrencyLayout);
   advancedOptionsWidget_->setLayout(advOptLayout);
 
   QHBoxLayout* top_layout = createTopLayout(ct);
@@ -315,6 +333,8 @@ void BaseShellWidget::retranslateUi() {
   stopAction_->setText(translations::trStop);
 
   historyCall_->setText(translations::trHistory);
+  pipelineCall_->setText(translations::trPipeline);
+  benchmarkCall_->setText(trBenchmark);
   setToolTip(trBasedOn_2S.arg(input_->basedOn(), input_->version()));
   advancedOptions_->setText(trAdvancedOptions);
   supported_commands_count_->setText(trSupportedCommandsCountTemplate_1S.arg(input_->commandsCount()));
@@ -349,12 +369,20 @@ void BaseShellWidget::execute() {
   int repeat = repeatCount_->value();
   int interval = intervalMsec_->value();
   bool history = historyCall_->isChecked();
-  executeArgs(selected, repeat, interval, history);
+  bool pipeline = pipelineCall_->isChecked();
+  int concurrency = benchmarkCall_->isChecked() ? concurrency_->value() : 0;
+  executeArgs(selected, repeat, interval, history, pipeline, concurrency);
 }
 
-void BaseShellWidget::executeArgs(const QString& text, int repeat, int interval, bool history) {
+void BaseShellWidget::executeArgs(const QString& text,
+                                  int repeat,
+                                  int interval,
+                                  bool history,
+                                  bool pipeline,
+                                  int benchmark_concurrency) {
   core::command_buffer_t text_cmd = common::ConvertToString(text);
-  proxy::events_info::ExecuteInfoRequest req(this, text_cmd, repeat, interval, history);
+  proxy::events_info::ExecuteInfoRequest req(this, text_cmd, repeat, interval, history, false, core::C_USER, pipeline,
+                                             benchmark_concurrency);
   server_->Execute(req);
 }
 
@@ -528,6 +556,9 @@ void BaseShellWidget::startExecute(const proxy::events_info::ExecuteInfoRequest&
   repeatCount_->setEnabled(false);
   intervalMsec_->setEnabled(false);
   historyCall_->setEnabled(false);
+  pipelineCall_->setEnabled(false);
+  benchmarkCall_->setEnabled(false);
+  concurrency_->setEnabled(false);
   executeAction_->setEnabled(false);
   stopAction_->setEnabled(true);
 }
@@ -537,6 +568,9 @@ void BaseShellWidget::finishExecute(const proxy::events_info::ExecuteInfoResponc
   repeatCount_->setEnabled(true);
   intervalMsec_->setEnabled(true);
   historyCall_->setEnabled(true);
+  pipelineCall_->setEnabled(true);
+  benchmarkCall_->setEnabled(true);
+  concurrency_->setEnabled(true);
   executeAction_->setEnabled(true);
   stopAction_->setEnabled(false);
 }
@@ -84,7 +84,12 @@ class BaseShellWidget : public QWidget {
  public Q_SLOTS:
   void setText(const QString& text);
   void executeText(const QString& text);
-  void executeArgs(const QString& text, int repeat, int interval, bool history);
+  void executeArgs(const QString& text,
+                   int repeat,
+                   int interval,
+                   bool history,
+                   bool pipeline = false,
+                   int benchmark_concurrency = 0);
 
  private Q_SLOTS:
   void execute();
@@ -174,6 +179,9 @@ class BaseShellWidget : public QWidget {
   QSpinBox* repeatCount_;
   QSpinBox* intervalMsec_;
   QCheckBox* historyCall_;
+  QCheckBox* pipelineCall_;
+  QCheckBox* benchmarkCall_;
+  QSpinBox* concurrency_;
   QString filePath_;
 };
 
@@ -18,17 +18,54 @@
 
 #include "gui/widgets/hash_type_widget.h"
 
+#include <common/qt/convert2string.h>
 #include <common/qt/utils_qt.h>
 
+#include "core/value.h"
+
+#include "proxy/server/iserver.h"
+
 #include "gui/action_cell_delegate.h"
 #include "gui/hash_table_model.h"
 #include "gui/key_value_table_item.h"
 
+namespace {
+
+template <typename T>
+fastonosql::gui::HashTableModel::rows_t MakeRows(T* container) {
+  fastonosql::gui::HashTableModel::rows_t rows;
+  for (auto it = container->begin(); it != container->end(); ++it) {
+    auto element = (*it);
+    std::string key_str = fastonosql::core::ConvertToHumanReadable(element.first);
+    std::string value_str = fastonosql::core::ConvertToHumanReadable(element.second);
+    if (key_str.empty() || value_str.empty()) {
+      continue;
+    }
+
+    QString ftext;
+    QString stext;
+    if (common::ConvertFromString(key_str, &ftext) && common::ConvertFromString(value_str, &stext)) {
+      rows.push_back(std::make_pair(ftext, stext));
+    }
+  }
+  return rows;
+}
+
+}  // namespace
+
 namespace fastonosql {
 namespace gui {
 
-HashTypeWidget::HashTypeWidget(QWidget* parent) : QTableView(parent), model_(nullptr) {
+HashTypeWidget::HashTypeWidget(QWidget* parent)
+    : QTableView(parent),
+      model_(nullptr),
+      server_(),
+      key_(),
+      type_(common::Value::TYPE_HASH),
+      key_size_(0),
+      generation_(0) {
   model_ = new HashTableModel(this);
+  VERIFY(connect(model_, &HashTableModel::pageRequested, this, &HashTypeWidget::requestPage));
   setModel(model_);
 
   ActionDelegate* del = new ActionDelegate(this);
@@ -47,9 +84,28 @@ void HashTypeWidget::insertRow(const QString& first, const QString& second) {
 }
 
 void HashTypeWidget::clear() {
+  generation_++;
   model_->clear();
 }
 
+void HashTypeWidget::loadKey(proxy::IServerSPtr server, const core::NKey& key, common::Value::Type type) {
+  if (server_) {
+    VERIFY(disconnect(server_.get(), &proxy::IServer::LoadKeyPageFinished, this, &HashTypeWidget::finishLoadPage));
+  }
+
+  server_ = server;
+  key_ = key;
+  type_ = type;
+  key_size_ = 0;
+  generation_++;
+  VERIFY(connect(server_.get(), &proxy::IServer::LoadKeyPageFinished, this, &HashTypeWidget::finishLoadPage));
+  model_->startPaging();
+}
+
+bool HashTypeWidget::isFullyLoaded() const {
+  return model_->isFullyLoaded();
+}
+
 common::ZSetValue* HashTypeWidget::zsetValue() const {
   return model_->zsetValue();
 }
@@ -67,5 +123,46 @@ void HashTypeWidget::removeRow(const QModelIndex& index) {
   model_->removeRow(index.row());
 }
 
+void HashTypeWidget::requestPage(uint64_t cursor) {
+  if (!server_) {
+    model_->cancelPage();
+    return;
+  }
+
+  proxy::events_info::LoadKeyPageRequest req(this, key_, type_, page_size, cursor, generation_);
+  server_->LoadKeyPage(req);
+}
+
+void HashTypeWidget::finishLoadPage(const proxy::events_info::LoadKeyPageResponce& res) {
+  if (res.initiator() != this || res.generation != generation_) {
+    return;
+  }
+
+  common::Error err = res.errorInfo();
+  if (err || !res.page) {
+    model_->cancelPage();
+    return;
+  }
+
+  if (res.cursor_in == 0) {
+    key_size_ = res.key_size;
+  }
+
+  HashTableModel::rows_t rows;
+  common::ZSetValue* zset = nullptr;
+  common::HashValue* hash = nullptr;
+  if (res.page->GetAsZSet(&zset)) {
+    rows = MakeRows(zset);
+  } else if (res.page->GetAsHash(&hash)) {
+    rows = MakeRows(hash);
+  }
+
+  uint64_t cursor = res.cursor_out;
+  if (type_ == common::Value::TYPE_ZSET && cursor >= key_size_) {  // zset offset reached size
+    cursor = 0;
+  }
+  model_->appendPage(rows, cursor);
+}
+
 }  // namespace gui
 }  // namespace fastonosql
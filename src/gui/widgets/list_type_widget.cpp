@@ -18,17 +18,50 @@
 
 #include "gui/widgets/list_type_widget.h"
 
+#include <common/qt/convert2string.h>
 #include <common/qt/utils_qt.h>
 
+#include "core/value.h"
+
+#include "proxy/server/iserver.h"
+
 #include "gui/action_cell_delegate.h"
 #include "gui/hash_table_model.h"
 #include "gui/key_value_table_item.h"
 
+namespace {
+
+template <typename T>
+fastonosql::gui::HashTableModel::rows_t MakeRows(T* container) {
+  fastonosql::gui::HashTableModel::rows_t rows;
+  for (auto it = container->begin(); it != container->end(); ++it) {
+    std::string val = fastonosql::core::ConvertToHumanReadable(*it);
+    if (val.empty()) {
+      continue;
+    }
+
+    QString qvalue;
+    common::ConvertFromString(val, &qvalue);
+    rows.push_back(std::make_pair(qvalue, QString()));
+  }
+  return rows;
+}
+
+}  // namespace
+
 namespace fastonosql {
 namespace gui {
 
-ListTypeWidget::ListTypeWidget(QWidget* parent) : QTableView(parent) {
+ListTypeWidget::ListTypeWidget(QWidget* parent)
+    : QTableView(parent),
+      model_(nullptr),
+      server_(),
+      key_(),
+      type_(common::Value::TYPE_ARRAY),
+      key_size_(0),
+      generation_(0) {
   model_ = new HashTableModel(this);
+  VERIFY(connect(model_, &HashTableModel::pageRequested, this, &ListTypeWidget::requestPage));
   setModel(model_);
 
   setColumnHidden(KeyValueTableItem::kValue, true);
@@ -55,9 +88,69 @@ void ListTypeWidget::insertRow(const QString& first) {
 }
 
 void ListTypeWidget::clear() {
+  generation_++;
   model_->clear();
 }
 
+void ListTypeWidget::loadKey(proxy::IServerSPtr server, const core::NKey& key, common::Value::Type type) {
+  if (server_) {
+    VERIFY(disconnect(server_.get(), &proxy::IServer::LoadKeyPageFinished, this, &ListTypeWidget::finishLoadPage));
+  }
+
+  server_ = server;
+  key_ = key;
+  type_ = type;
+  key_size_ = 0;
+  generation_++;
+  VERIFY(connect(server_.get(), &proxy::IServer::LoadKeyPageFinished, this, &ListTypeWidget::finishLoadPage));
+  model_->startPaging();
+}
+
+bool ListTypeWidget::isFullyLoaded() const {
+  return model_->isFullyLoaded();
+}
+
+void ListTypeWidget::requestPage(uint64_t cursor) {
+  if (!server_) {
+    model_->cancelPage();
+    return;
+  }
+
+  proxy::events_info::LoadKeyPageRequest req(this, key_, type_, page_size, cursor, generation_);
+  server_->LoadKeyPage(req);
+}
+
+void ListTypeWidget::finishLoadPage(const proxy::events_info::LoadKeyPageResponce& res) {
+  if (res.initiator() != this || res.generation != generation_) {
+    return;
+  }
+
+  common::Error err = res.errorInfo();
+  if (err || !res.page) {
+    model_->cancelPage();
+    return;
+  }
+
+  if (res.cursor_in == 0) {
+    key_size_ = res.key_size;
+  }
+
+  HashTableModel::rows_t rows;
+  common::ArrayValue* arr = nullptr;
+  common::SetValue* set = nullptr;
+  if (res.page->GetAsList(&arr)) {
+    rows = MakeRows(arr);
+  } else if (res.page->GetAsSet(&set)) {
+    rows = MakeRows(set);
+  }
+
+  uint64_t cursor = res.cursor_out;
+  if (type_ == common::Value::TYPE_ARRAY && cursor >= key_size_) {  // list offset reached size
+    cursor = 0;
+  }
+  model_->appendPage(rows, cursor);
+}
+
 void ListTypeWidget::addRow(const QModelIndex& index) {
   KeyValueTableItem* node = common::qt::item<common::qt::gui::TableItem*, KeyValueTableItem*>(index);
   model_->insertRow(node->key(), node->value());
@@ -22,6 +22,17 @@
 
 #include <common/value.h>
 
+#include "core/db_key.h"      // for NKey
+#include "proxy/proxy_fwd.h"  // for IServerSPtr
+
+namespace fastonosql {
+namespace proxy {
+namespace events_info {
+struct LoadKeyPageResponce;
+}  // namespace events_info
+}  // namespace proxy
+}  // namespace fastonosql
+
 namespace fastonosql {
 namespace gui {
 
@@ -38,12 +49,26 @@ class ListTypeWidget : public QTableView {
   void insertRow(const QString& first);
   void clear();
 
+  // value is paged from server while view scrolls instead of loading it at once
+  void loadKey(proxy::IServerSPtr server, const core::NKey& key, common::Value::Type type);
+  bool isFullyLoaded() const;
+
  private Q_SLOTS:
   void addRow(const QModelIndex& index);
   void removeRow(const QModelIndex& index);
 
+  void requestPage(uint64_t cursor);
+  void finishLoadPage(const proxy::events_info::LoadKeyPageResponce& res);
+
  private:
+  enum { page_size = 500 };
+
   HashTableModel* model_;
+  proxy::IServerSPtr server_;
+  core::NKey key_;
+  common::Value::Type type_;
+  size_t key_size_;
+  uint64_t generation_;  // bumped by loadKey and clear, pages of previous key are ignored
 };
 
 }  // namespace gui
@@ -95,6 +95,8 @@ OutputWidget::OutputWidget(proxy::IServerSPtr server, QWidget* parent) : QWidget
                  Qt::DirectConnection));
 
   VERIFY(connect(server_.get(), &proxy::IServer::ChildAdded, this, &OutputWidget::addChild, Qt::DirectConnection));
+  VERIFY(
+      connect(server_.get(), &proxy::IServer::ChildRemoved, this, &OutputWidget::removeChild, Qt::DirectConnection));
   VERIFY(connect(server_.get(), &proxy::IServer::ItemUpdated, this, &OutputWidget::updateItem, Qt::DirectConnection));
 
   treeView_ = new QTreeView;
@@ -102,14 +104,14 @@ OutputWidget::OutputWidget(proxy::IServerSPtr server, QWidget* parent) : QWidget
   treeView_->header()->setSectionResizeMode(0, QHeaderView::Stretch);
   treeView_->header()->setSectionResizeMode(1, QHeaderView::Stretch);
   treeView_->header()->setStretchLastSection(false);
-  treeView_->setItemDelegateForColumn(FastoCommonItem::eValue, new TypeDelegate(this));
+  treeView_->setItemDelegateForColumn(FastoCommonItem::eValue, new TypeDelegate(server_, this));
 
   tableView_ = new QTableView;
   tableView_->setModel(commonModel_);
   tableView_->horizontalHeader()->setSectionResizeMode(0, QHeaderView::Stretch);
   tableView_->horizontalHeader()->setSectionResizeMode(1, QHeaderView::Stretch);
   tableView_->horizontalHeader()->setStretchLastSection(false);
-  tableView_->setItemDelegateForColumn(FastoCommonItem::eValue, new TypeDelegate(this));
+  tableView_->setItemDelegateForColumn(FastoCommonItem::eValue, new TypeDelegate(server_, this));
 
   textView_ = new FastoTextView;
   textView_->setModel(commonModel_);
@@ -210,6 +212,21 @@ void OutputWidget::addChild(core::FastoObjectIPtr child) {
   commonModel_->insertItem(parent, comChild);
 }
 
+void OutputWidget::removeChild(core::FastoObjectIPtr child) {
+  QModelIndex index;
+  bool isFound = commonModel_->findItem(child.get(), &index);
+  if (!isFound || !index.isValid()) {
+    return;
+  }
+
+  FastoCommonItem* it = common::qt::item<common::qt::gui::TreeItem*, FastoCommonItem*>(index);
+  if (!it) {
+    return;
+  }
+
+  commonModel_->removeItem(index.parent(), it);
+}
+
 void OutputWidget::addCommand(core::FastoObjectCommand* command, core::FastoObject* child) {
   void* parentinner = command->GetParent();
 
@@ -262,14 +279,14 @@ void OutputWidget::updateItem(core::FastoObject* item, common::ValueSPtr newValu
 
 void OutputWidget::createKey(const core::NDbKValue& dbv) {
   core::translator_t tran = server_->GetTranslator();
-  core::command_buffer_t cmd_text;
-  common::Error err = tran->CreateKeyCommand(dbv, &cmd_text);
+  core::commands_args_t cmd_args;
+  common::Error err = tran->CreateKeyCommand(dbv, &cmd_args);
   if (err) {
     LOG_ERROR(err, common::logging::LOG_LEVEL_ERR, true);
     return;
   }
 
-  proxy::events_info::ExecuteInfoRequest req(this, cmd_text, 0, 0, true, true);
+  proxy::events_info::ExecuteInfoRequest req(this, cmd_args, 0, 0, true, true);
   server_->Execute(req);
 }
 
@@ -24,10 +24,14 @@
 #include <QSpinBox>
 
 #include <common/qt/convert2string.h>
+#include <common/qt/logger.h>
 #include <common/qt/utils_qt.h>
 
+#include "core/connection_types.h"
 #include "core/value.h"
 
+#include "proxy/server/iserver.h"
+
 #include "gui/widgets/hash_type_widget.h"
 #include "gui/widgets/list_type_widget.h"
 
@@ -38,7 +42,11 @@ Q_DECLARE_METATYPE(fastonosql::core::NValue)
 namespace fastonosql {
 namespace gui {
 
-TypeDelegate::TypeDelegate(QObject* parent) : QStyledItemDelegate(parent) {}
+TypeDelegate::TypeDelegate(proxy::IServerSPtr server, QObject* parent) : QStyledItemDelegate(parent), server_() {
+  if (server && core::IsCanLoadKeyPages(server->GetType())) {
+    server_ = server;
+  }
+}
 
 QSize TypeDelegate::sizeHint(const QStyleOptionViewItem& option, const QModelIndex& index) const {
   UNUSED(option);
@@ -91,7 +99,13 @@ void TypeDelegate::setEditorData(QWidget* editor, const QModelIndex& index) cons
   core::NDbKValue dbv = node->dbv();
   core::NValue val = dbv.GetValue();
   common::Value::Type t = node->type();
-  if (t == common::Value::TYPE_INTEGER) {
+  if (server_ && (t == common::Value::TYPE_ARRAY || t == common::Value::TYPE_SET)) {
+    ListTypeWidget* listwidget = static_cast<ListTypeWidget*>(editor);
+    listwidget->loadKey(server_, dbv.GetKey(), t);
+  } else if (server_ && (t == common::Value::TYPE_ZSET || t == common::Value::TYPE_HASH)) {
+    HashTypeWidget* hashwidget = static_cast<HashTypeWidget*>(editor);
+    hashwidget->loadKey(server_, dbv.GetKey(), t);
+  } else if (t == common::Value::TYPE_INTEGER) {
     int value = 0;
     if (val->GetAsInteger(&value)) {
       QSpinBox* spinBox = static_cast<QSpinBox*>(editor);
@@ -209,6 +223,22 @@ void TypeDelegate::setModelData(QWidget* editor, QAbstractItemModel* model, cons
   }
 
   common::Value::Type t = node->type();
+  if (t == common::Value::TYPE_ARRAY || t == common::Value::TYPE_SET) {
+    ListTypeWidget* listwidget = static_cast<ListTypeWidget*>(editor);
+    if (!listwidget->isFullyLoaded()) {  // saving partially loaded value would drop other elements
+      LOG_ERROR(common::make_error("Value is not fully loaded, scroll to the end before saving"),
+                common::logging::LOG_LEVEL_WARNING, true);
+      return;
+    }
+  } else if (t == common::Value::TYPE_ZSET || t == common::Value::TYPE_HASH) {
+    HashTypeWidget* hashwidget = static_cast<HashTypeWidget*>(editor);
+    if (!hashwidget->isFullyLoaded()) {
+      LOG_ERROR(common::make_error("Value is not fully loaded, scroll to the end before saving"),
+                common::logging::LOG_LEVEL_WARNING, true);
+      return;
+    }
+  }
+
   if (t == common::Value::TYPE_INTEGER) {
     QSpinBox* spinBox = static_cast<QSpinBox*>(editor);
     int value = spinBox->value();
@@ -20,6 +20,8 @@
 
 #include <QStyledItemDelegate>
 
+#include "proxy/proxy_fwd.h"  // for IServerSPtr
+
 namespace fastonosql {
 namespace gui {
 
@@ -27,7 +29,7 @@ class TypeDelegate : public QStyledItemDelegate {
   Q_OBJECT
  public:
   enum { row_height = 32 };
-  explicit TypeDelegate(QObject* parent = Q_NULLPTR);
+  explicit TypeDelegate(proxy::IServerSPtr server, QObject* parent = Q_NULLPTR);
 
   virtual QSize sizeHint(const QStyleOptionViewItem& option, const QModelIndex& index) const override;
 
@@ -42,6 +44,9 @@ class TypeDelegate : public QStyledItemDelegate {
   virtual void updateEditorGeometry(QWidget* editor,
                                     const QStyleOptionViewItem& option,
                                     const QModelIndex& index) const override;
+
+ private:
+  proxy::IServerSPtr server_;  // set if collections can be paged from server in editors
 };
 
 }  // namespace gui
@@ -90,6 +90,10 @@ common::Error Driver::ExecuteImpl(const core::command_buffer_t& command, core::F
   return impl_->Execute(command, out);
 }
 
+common::Error Driver::ExecuteImpl(const core::commands_args_t& argv, core::FastoObject* out) {
+  return impl_->Execute(argv, out);
+}
+
 common::Error Driver::GetCurrentServerInfo(core::IServerInfo** info) {
   core::FastoObjectCommandIPtr cmd = CreateCommandFast(DB_INFO_COMMAND, core::C_INNER);
   LOG_COMMAND(cmd);
@@ -126,6 +130,37 @@ common::Error Driver::GetCurrentDataBaseInfo(core::IDataBaseInfo** info) {
   return impl_->Select(impl_->GetCurrentDBName(), info);
 }
 
+void Driver::HandleExecuteEvent(events::ExecuteRequestEvent* ev) {
+  QObject* sender = ev->sender();
+  impl_->SetFlushDBProgress([this, sender](int percent) { NotifyProgress(sender, percent); });  // long FLUSHDB
+  IDriverLocal::HandleExecuteEvent(ev);
+  impl_->SetFlushDBProgress(core::internal::backup_progress_callback_t());
+}
+
+void Driver::HandleBackupEvent(events::BackupRequestEvent* ev) {
+  QObject* sender = ev->sender();
+  NotifyProgress(sender, 0);
+  events::BackupResponceEvent::value_type res(ev->value());
+  common::Error err = impl_->Backup(res.path, [this, sender](int percent) { NotifyProgress(sender, percent); });
+  if (err) {
+    res.setErrorInfo(err);
+  }
+  Reply(sender, new events::BackupResponceEvent(this, res));
+  NotifyProgress(sender, 100);
+}
+
+void Driver::HandleRestoreEvent(events::RestoreRequestEvent* ev) {
+  QObject* sender = ev->sender();
+  NotifyProgress(sender, 0);
+  events::RestoreResponceEvent::value_type res(ev->value());
+  common::Error err = impl_->Restore(res.path, [this, sender](int percent) { NotifyProgress(sender, percent); });
+  if (err) {
+    res.setErrorInfo(err);
+  }
+  Reply(sender, new events::RestoreResponceEvent(this, res));
+  NotifyProgress(sender, 100);
+}
+
 void Driver::HandleLoadDatabaseContentEvent(events::LoadDatabaseContentRequestEvent* ev) {
   QObject* sender = ev->sender();
   NotifyProgress(sender, 0);
@@ -167,19 +202,21 @@ void Driver::HandleLoadDatabaseContentEvent(events::LoadDatabaseContentRequestEv
         goto done;
       }
 
+      core::NKeys keys;
       for (size_t i = 0; i < ar->GetSize(); ++i) {
         std::string key_str;
         if (ar->GetString(i, &key_str)) {
           core::key_t key(key_str);
-          core::NKey k(key);
-          core::NValue empty_val(common::Value::CreateEmptyValueFromType(common::Value::TYPE_STRING));
-          core::NDbKValue ress(k, empty_val);
-          res.keys.push_back(ress);
+          keys.push_back(core::NKey(key));
         }
       }
 
-      common::Error err = impl_->DBkcount(&res.db_keys_count);
-      DCHECK(!err);
+      AddListedKeys(keys, &res.keys);
+
+      common::Error err = impl_->DBkcount(&res.db_keys_count, core::ESTIMATE_KEYS_COUNT);
+      if (err) {
+        res.setErrorInfo(err);
+      }
     }
   }
 done:
@@ -188,11 +225,6 @@ done:
   NotifyProgress(sender, 100);
 }
 
-core::IServerInfoSPtr Driver::MakeServerInfoFromString(const std::string& val) {
-  core::IServerInfoSPtr res(core::leveldb::MakeLeveldbServerInfo(val));
-  return res;
-}
-
 }  // namespace leveldb
 }  // namespace proxy
 }  // namespace fastonosql
@@ -91,6 +91,10 @@ common::Error Driver::ExecuteImpl(const core::command_buffer_t& command, core::F
   return impl_->Execute(command, out);
 }
 
+common::Error Driver::ExecuteImpl(const core::commands_args_t& argv, core::FastoObject* out) {
+  return impl_->Execute(argv, out);
+}
+
 common::Error Driver::GetCurrentServerInfo(core::IServerInfo** info) {
   core::FastoObjectCommandIPtr cmd = CreateCommandFast(DB_INFO_COMMAND, core::C_INNER);
   LOG_COMMAND(cmd);
@@ -180,6 +184,30 @@ void Driver::HandleLoadDatabaseInfosEvent(events::LoadDatabasesInfoRequestEvent*
   NotifyProgress(sender, 100);
 }
 
+void Driver::HandleBackupEvent(events::BackupRequestEvent* ev) {
+  QObject* sender = ev->sender();
+  NotifyProgress(sender, 0);
+  events::BackupResponceEvent::value_type res(ev->value());
+  common::Error err = impl_->Backup(res.path, [this, sender](int percent) { NotifyProgress(sender, percent); });
+  if (err) {
+    res.setErrorInfo(err);
+  }
+  Reply(sender, new events::BackupResponceEvent(this, res));
+  NotifyProgress(sender, 100);
+}
+
+void Driver::HandleRestoreEvent(events::RestoreRequestEvent* ev) {
+  QObject* sender = ev->sender();
+  NotifyProgress(sender, 0);
+  events::RestoreResponceEvent::value_type res(ev->value());
+  common::Error err = impl_->Restore(res.path, [this, sender](int percent) { NotifyProgress(sender, percent); });
+  if (err) {
+    res.setErrorInfo(err);
+  }
+  Reply(sender, new events::RestoreResponceEvent(this, res));
+  NotifyProgress(sender, 100);
+}
+
 void Driver::HandleLoadDatabaseContentEvent(events::LoadDatabaseContentRequestEvent* ev) {
   QObject* sender = ev->sender();
   NotifyProgress(sender, 0);
@@ -221,19 +249,21 @@ void Driver::HandleLoadDatabaseContentEvent(events::LoadDatabaseContentRequestEv
         goto done;
       }
 
+      core::NKeys keys;
       for (size_t i = 0; i < ar->GetSize(); ++i) {
         std::string key_str;
         if (ar->GetString(i, &key_str)) {
           core::key_t key(key_str);
-          core::NKey k(key);
-          core::NValue empty_val(common::Value::CreateEmptyValueFromType(common::Value::TYPE_STRING));
-          core::NDbKValue ress(k, empty_val);
-          res.keys.push_back(ress);
+          keys.push_back(core::NKey(key));
         }
       }
 
-      common::Error err = impl_->DBkcount(&res.db_keys_count);
-      DCHECK(!err);
+      AddListedKeys(keys, &res.keys);
+
+      common::Error err = impl_->DBkcount(&res.db_keys_count, core::ESTIMATE_KEYS_COUNT);
+      if (err) {
+        res.setErrorInfo(err);
+      }
     }
   }
 done:
@@ -242,11 +272,6 @@ done:
   NotifyProgress(sender, 100);
 }
 
-core::IServerInfoSPtr Driver::MakeServerInfoFromString(const std::string& val) {
-  core::IServerInfoSPtr res(core::lmdb::MakeLmdbServerInfo(val));
-  return res;
-}
-
 }  // namespace lmdb
 }  // namespace proxy
 }  // namespace fastonosql
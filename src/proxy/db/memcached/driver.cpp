@@ -26,6 +26,7 @@
 #include "proxy/command/command_logger.h"            // for LOG_COMMAND
 #include "proxy/db/memcached/command.h"              // for Command
 #include "proxy/db/memcached/connection_settings.h"  // for ConnectionSettings
+#include "proxy/driver/benchmark.h"                  // for BenchmarkWorker
 
 #define MEMCACHED_INFO_REQUEST "STATS"
 
@@ -91,6 +92,15 @@ common::Error Driver::ExecuteImpl(const core::command_buffer_t& command, core::F
   return impl_->Execute(command, out);
 }
 
+common::Error Driver::ExecuteImpl(const core::commands_args_t& argv, core::FastoObject* out) {
+  return impl_->Execute(argv, out);
+}
+
+IBenchmarkWorker* Driver::CreateBenchmarkWorker() const {
+  auto memcached_settings = GetSpecificSettings<ConnectionSettings>();
+  return new BenchmarkWorker<core::memcached::DBConnection>(memcached_settings->GetInfo());
+}
+
 common::Error Driver::GetCurrentServerInfo(core::IServerInfo** info) {
   core::FastoObjectCommandIPtr cmd = CreateCommandFast(MEMCACHED_INFO_REQUEST, core::C_INNER);
   LOG_COMMAND(cmd);
@@ -174,6 +184,7 @@ void Driver::HandleLoadDatabaseContentEvent(events::LoadDatabaseContentRequestEv
         goto done;
       }
 
+      core::NKeys keys;
       for (size_t i = 0; i < ar->GetSize(); ++i) {
         std::string key_str;
         if (ar->GetString(i, &key_str)) {
@@ -190,14 +201,16 @@ void Driver::HandleLoadDatabaseContentEvent(events::LoadDatabaseContentRequestEv
           } else {
             k.SetTTL(ttl);
           }
-          core::NValue empty_val(common::Value::CreateEmptyValueFromType(common::Value::TYPE_STRING));
-          core::NDbKValue ress(k, empty_val);
-          res.keys.push_back(ress);
+          keys.push_back(k);
         }
       }
 
-      common::Error err = impl_->DBkcount(&res.db_keys_count);
-      DCHECK(!err);
+      AddListedKeys(keys, &res.keys);
+
+      common::Error err = impl_->DBkcount(&res.db_keys_count, core::ESTIMATE_KEYS_COUNT);
+      if (err) {
+        res.setErrorInfo(err);
+      }
     }
   }
 done:
@@ -206,11 +219,6 @@ done:
   NotifyProgress(sender, 100);
 }
 
-core::IServerInfoSPtr Driver::MakeServerInfoFromString(const std::string& val) {
-  core::IServerInfoSPtr res(core::memcached::MakeMemcachedServerInfo(val));
-  return res;
-}
-
 }  // namespace memcached
 }  // namespace proxy
 }  // namespace fastonosql
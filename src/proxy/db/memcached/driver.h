@@ -61,6 +61,8 @@ class Driver : public IDriverRemote {
   virtual common::Error SyncDisconnect() override WARN_UNUSED_RESULT;
 
   virtual common::Error ExecuteImpl(const core::command_buffer_t& command, core::FastoObject* out) override;
+  virtual common::Error ExecuteImpl(const core::commands_args_t& argv, core::FastoObject* out) override;
+  virtual IBenchmarkWorker* CreateBenchmarkWorker() const override;
 
   virtual common::Error GetCurrentServerInfo(core::IServerInfo** info) override;
   virtual common::Error GetServerCommands(std::vector<const core::CommandInfo*>* commands) override;
@@ -68,7 +70,6 @@ class Driver : public IDriverRemote {
   virtual common::Error GetCurrentDataBaseInfo(core::IDataBaseInfo** info) override;
 
   virtual void HandleLoadDatabaseContentEvent(events::LoadDatabaseContentRequestEvent* ev) override;
-  virtual core::IServerInfoSPtr MakeServerInfoFromString(const std::string& val) override;
 
   core::memcached::DBConnection* const impl_;
 };
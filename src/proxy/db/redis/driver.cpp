@@ -28,6 +28,7 @@
 #include "proxy/command/command_logger.h"
 #include "proxy/db/redis/command.h"              // for Command
 #include "proxy/db/redis/connection_settings.h"  // for ConnectionSettings
+#include "proxy/driver/benchmark.h"              // for BenchmarkWorker
 
 #define REDIS_TYPE_COMMAND "TYPE"
 #define REDIS_SHUTDOWN_COMMAND "SHUTDOWN"
@@ -133,6 +134,20 @@ common::Error Driver::ExecuteImpl(const core::command_buffer_t& command, core::F
   return impl_->Execute(command, out);
 }
 
+common::Error Driver::ExecuteImpl(const core::commands_args_t& argv, core::FastoObject* out) {
+  return impl_->Execute(argv, out);
+}
+
+IBenchmarkWorker* Driver::CreateBenchmarkWorker() const {
+  auto redis_settings = GetSpecificSettings<ConnectionSettings>();
+  core::redis::RConfig rconf(redis_settings->GetInfo(), redis_settings->GetSSHInfo());
+  return new BenchmarkWorker<core::redis::DBConnection>(rconf);
+}
+
+common::Error Driver::ExecutePipelineImpl(const std::vector<core::FastoObjectCommandIPtr>& cmds) {
+  return impl_->ExecuteAsPipeline(cmds, &LOG_COMMAND);
+}
+
 common::Error Driver::GetCurrentServerInfo(core::IServerInfo** info) {
   core::FastoObjectCommandIPtr cmd = CreateCommandFast(DB_INFO_COMMAND, core::C_INNER);
   common::Error err = Execute(cmd.get());
@@ -438,7 +453,7 @@ void Driver::HandleLoadDatabaseContentEvent(events::LoadDatabaseContentRequestEv
         }
       }
 
-      err = impl_->DBkcount(&res.db_keys_count);
+      err = impl_->DBkcount(&res.db_keys_count, core::ESTIMATE_KEYS_COUNT);
       DCHECK(!err);
     }
   }
@@ -571,9 +586,27 @@ done:
   NotifyProgress(sender, 100);
 }
 
-core::IServerInfoSPtr Driver::MakeServerInfoFromString(const std::string& val) {
-  core::IServerInfoSPtr res(core::redis::MakeRedisServerInfo(val));
-  return res;
+void Driver::HandleLoadKeyPageEvent(events::LoadKeyPageRequestEvent* ev) {
+  QObject* sender = ev->sender();
+  NotifyProgress(sender, 0);
+  events::LoadKeyPageResponceEvent::value_type res(ev->value());
+  NotifyProgress(sender, 25);
+  common::Error err;
+  if (res.cursor_in == 0) {
+    err = impl_->KeySize(res.key, res.type, &res.key_size);
+  }
+
+  if (!err) {
+    NotifyProgress(sender, 50);
+    err = impl_->LoadKeyPage(res.key, res.type, res.cursor_in, res.count, &res.page, &res.cursor_out);
+  }
+
+  if (err) {
+    res.setErrorInfo(err);
+  }
+  NotifyProgress(sender, 75);
+  Reply(sender, new events::LoadKeyPageResponceEvent(this, res));
+  NotifyProgress(sender, 100);
 }
 
 }  // namespace redis
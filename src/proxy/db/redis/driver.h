@@ -61,6 +61,9 @@ class Driver : public IDriverRemote {
   virtual common::Error SyncDisconnect() override WARN_UNUSED_RESULT;
 
   virtual common::Error ExecuteImpl(const core::command_buffer_t& command, core::FastoObject* out) override;
+  virtual common::Error ExecuteImpl(const core::commands_args_t& argv, core::FastoObject* out) override;
+  virtual common::Error ExecutePipelineImpl(const std::vector<core::FastoObjectCommandIPtr>& cmds) override;
+  virtual IBenchmarkWorker* CreateBenchmarkWorker() const override;
 
   virtual common::Error GetCurrentServerInfo(core::IServerInfo** info) override;
   virtual common::Error GetServerCommands(std::vector<const core::CommandInfo*>* commands) override;
@@ -75,8 +78,7 @@ class Driver : public IDriverRemote {
   virtual void HandleRestoreEvent(events::RestoreRequestEvent* ev) override;
 
   virtual void HandleLoadDatabaseContentEvent(events::LoadDatabaseContentRequestEvent* ev) override;
-
-  virtual core::IServerInfoSPtr MakeServerInfoFromString(const std::string& val) override;
+  virtual void HandleLoadKeyPageEvent(events::LoadKeyPageRequestEvent* ev) override;
 
   core::redis::DBConnection* const impl_;
 };
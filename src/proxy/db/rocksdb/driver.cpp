@@ -20,6 +20,7 @@
 
 #include <common/convert2string.h>
 
+#include "core/db/rocksdb/database_info.h"
 #include "core/db/rocksdb/db_connection.h"  // for DBConnection
 
 #include "proxy/command/command.h"                 // for CreateCommand, etc
@@ -27,6 +28,8 @@
 #include "proxy/db/rocksdb/command.h"              // for Command
 #include "proxy/db/rocksdb/connection_settings.h"  // for ConnectionSettings
 
+#define ROCKSDB_GET_DATABASES_COMMAND "CONFIG GET databases"
+
 namespace fastonosql {
 namespace proxy {
 namespace rocksdb {
@@ -89,6 +92,10 @@ common::Error Driver::ExecuteImpl(const core::command_buffer_t& command, core::F
   return impl_->Execute(command, out);
 }
 
+common::Error Driver::ExecuteImpl(const core::commands_args_t& argv, core::FastoObject* out) {
+  return impl_->Execute(argv, out);
+}
+
 common::Error Driver::GetCurrentServerInfo(core::IServerInfo** info) {
   core::FastoObjectCommandIPtr cmd = CreateCommandFast(DB_INFO_COMMAND, core::C_INNER);
   LOG_COMMAND(cmd);
@@ -126,6 +133,78 @@ common::Error Driver::GetCurrentDataBaseInfo(core::IDataBaseInfo** info) {
   return impl_->Select(impl_->GetCurrentDBName(), info);
 }
 
+void Driver::HandleLoadDatabaseInfosEvent(events::LoadDatabasesInfoRequestEvent* ev) {
+  QObject* sender = ev->sender();
+  NotifyProgress(sender, 0);
+  events::LoadDatabasesInfoResponceEvent::value_type res(ev->value());
+  core::FastoObjectCommandIPtr cmd = CreateCommandFast(ROCKSDB_GET_DATABASES_COMMAND, core::C_INNER);
+  NotifyProgress(sender, 50);
+
+  core::IDataBaseInfo* info = nullptr;
+  common::Error err = GetCurrentDataBaseInfo(&info);
+  if (err) {
+    res.setErrorInfo(err);
+    NotifyProgress(sender, 75);
+    Reply(sender, new events::LoadDatabasesInfoResponceEvent(this, res));
+    NotifyProgress(sender, 100);
+    return;
+  }
+
+  core::IDataBaseInfoSPtr curdb(info);
+  err = Execute(cmd.get());
+  if (err) {
+    res.setErrorInfo(err);
+    NotifyProgress(sender, 75);
+    Reply(sender, new events::LoadDatabasesInfoResponceEvent(this, res));
+    NotifyProgress(sender, 100);
+    return;
+  }
+
+  core::FastoObject::childs_t rchildrens = cmd->GetChildrens();
+  CHECK_EQ(rchildrens.size(), 1);
+  auto ar = std::static_pointer_cast<common::ArrayValue>(rchildrens[0]->GetValue());
+  CHECK(ar);
+
+  // column families
+  for (size_t i = 0; i < ar->GetSize(); ++i) {
+    std::string name;
+    if (ar->GetString(i, &name)) {
+      if (name == curdb->GetName()) {
+        res.databases.push_back(curdb);
+      } else {
+        res.databases.push_back(core::IDataBaseInfoSPtr(new core::rocksdb::DataBaseInfo(name, false, 0)));
+      }
+    }
+  }
+  NotifyProgress(sender, 75);
+  Reply(sender, new events::LoadDatabasesInfoResponceEvent(this, res));
+  NotifyProgress(sender, 100);
+}
+
+void Driver::HandleBackupEvent(events::BackupRequestEvent* ev) {
+  QObject* sender = ev->sender();
+  NotifyProgress(sender, 0);
+  events::BackupResponceEvent::value_type res(ev->value());
+  common::Error err = impl_->Backup(res.path, [this, sender](int percent) { NotifyProgress(sender, percent); });
+  if (err) {
+    res.setErrorInfo(err);
+  }
+  Reply(sender, new events::BackupResponceEvent(this, res));
+  NotifyProgress(sender, 100);
+}
+
+void Driver::HandleRestoreEvent(events::RestoreRequestEvent* ev) {
+  QObject* sender = ev->sender();
+  NotifyProgress(sender, 0);
+  events::RestoreResponceEvent::value_type res(ev->value());
+  common::Error err = impl_->Restore(res.path, [this, sender](int percent) { NotifyProgress(sender, percent); });
+  if (err) {
+    res.setErrorInfo(err);
+  }
+  Reply(sender, new events::RestoreResponceEvent(this, res));
+  NotifyProgress(sender, 100);
+}
+
 void Driver::HandleLoadDatabaseContentEvent(events::LoadDatabaseContentRequestEvent* ev) {
   QObject* sender = ev->sender();
   NotifyProgress(sender, 0);
@@ -167,19 +246,21 @@ void Driver::HandleLoadDatabaseContentEvent(events::LoadDatabaseContentRequestEv
         goto done;
       }
 
+      core::NKeys keys;
       for (size_t i = 0; i < ar->GetSize(); ++i) {
         std::string key_str;
         if (ar->GetString(i, &key_str)) {
           core::key_t key(key_str);
-          core::NKey k(key);
-          core::NValue empty_val(common::Value::CreateEmptyValueFromType(common::Value::TYPE_STRING));
-          core::NDbKValue ress(k, empty_val);
-          res.keys.push_back(ress);
+          keys.push_back(core::NKey(key));
         }
       }
 
-      common::Error err = impl_->DBkcount(&res.db_keys_count);
-      DCHECK(!err);
+      AddListedKeys(keys, &res.keys);
+
+      common::Error err = impl_->DBkcount(&res.db_keys_count, core::ESTIMATE_KEYS_COUNT);
+      if (err) {
+        res.setErrorInfo(err);
+      }
     }
   }
 done:
@@ -188,11 +269,6 @@ done:
   NotifyProgress(sender, 100);
 }
 
-core::IServerInfoSPtr Driver::MakeServerInfoFromString(const std::string& val) {
-  core::IServerInfoSPtr res(core::rocksdb::MakeRocksdbServerInfo(val));
-  return res;
-}
-
 }  // namespace rocksdb
 }  // namespace proxy
 }  // namespace fastonosql
@@ -26,6 +26,7 @@
 #include "proxy/command/command_logger.h"       // for LOG_COMMAND
 #include "proxy/db/ssdb/command.h"              // for Command
 #include "proxy/db/ssdb/connection_settings.h"  // for ConnectionSettings
+#include "proxy/driver/benchmark.h"             // for BenchmarkWorker
 
 namespace fastonosql {
 namespace proxy {
@@ -88,6 +89,15 @@ common::Error Driver::ExecuteImpl(const core::command_buffer_t& command, core::F
   return impl_->Execute(command, out);
 }
 
+common::Error Driver::ExecuteImpl(const core::commands_args_t& argv, core::FastoObject* out) {
+  return impl_->Execute(argv, out);
+}
+
+IBenchmarkWorker* Driver::CreateBenchmarkWorker() const {
+  auto ssdb_settings = GetSpecificSettings<ConnectionSettings>();
+  return new BenchmarkWorker<core::ssdb::DBConnection>(ssdb_settings->GetInfo());
+}
+
 common::Error Driver::GetCurrentServerInfo(core::IServerInfo** info) {
   core::FastoObjectCommandIPtr cmd = CreateCommandFast(DB_INFO_COMMAND, core::C_INNER);
   LOG_COMMAND(cmd);
@@ -166,6 +176,7 @@ void Driver::HandleLoadDatabaseContentEvent(events::LoadDatabaseContentRequestEv
         goto done;
       }
 
+      core::NKeys keys;
       for (size_t i = 0; i < ar->GetSize(); ++i) {
         std::string key_str;
         if (ar->GetString(i, &key_str)) {
@@ -182,15 +193,16 @@ void Driver::HandleLoadDatabaseContentEvent(events::LoadDatabaseContentRequestEv
           } else {
             k.SetTTL(ttl);
           }
-
-          core::NValue empty_val(common::Value::CreateEmptyValueFromType(common::Value::TYPE_STRING));
-          core::NDbKValue ress(k, empty_val);
-          res.keys.push_back(ress);
+          keys.push_back(k);
         }
       }
 
-      common::Error err = impl_->DBkcount(&res.db_keys_count);
-      DCHECK(!err);
+      AddListedKeys(keys, &res.keys);
+
+      common::Error err = impl_->DBkcount(&res.db_keys_count, core::ESTIMATE_KEYS_COUNT);
+      if (err) {
+        res.setErrorInfo(err);
+      }
     }
   }
 done:
@@ -199,11 +211,6 @@ done:
   NotifyProgress(sender, 100);
 }
 
-core::IServerInfoSPtr Driver::MakeServerInfoFromString(const std::string& val) {
-  core::IServerInfoSPtr res(core::ssdb::MakeSsdbServerInfo(val));
-  return res;
-}
-
 }  // namespace ssdb
 }  // namespace proxy
 }  // namespace fastonosql
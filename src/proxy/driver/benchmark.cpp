@@ -0,0 +1,208 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "proxy/driver/benchmark.h"
+
+#include <ctype.h>
+
+#include <algorithm>
+#include <limits>
+
+#include <common/sprintf.h>
+
+namespace {
+
+const double percentiles[] = {50.0, 99.0, 99.9};
+const char* const percentiles_names[] = {"p50", "p99", "p999"};
+
+std::string CommandName(const fastonosql::core::command_buffer_t& command) {
+  const size_t start = command.find_first_not_of(' ');
+  if (start == fastonosql::core::command_buffer_t::npos) {
+    return std::string();
+  }
+
+  const size_t end = command.find(' ', start);
+  std::string name = command.substr(start, end == fastonosql::core::command_buffer_t::npos ? end : end - start);
+  std::transform(name.begin(), name.end(), name.begin(), ::toupper);
+  return name;
+}
+
+std::string JsonEscape(const std::string& str) {
+  std::string result;
+  result.reserve(str.size());
+  for (char c : str) {
+    if (c == '"' || c == '\\') {
+      result += '\\';
+      result += c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      result += common::MemSPrintf("\\u%04x", static_cast<int>(c));
+    } else {
+      result += c;
+    }
+  }
+  return result;
+}
+
+double OpsPerSec(uint64_t ops, common::time64_t wall_msec) {
+  if (wall_msec <= 0) {
+    return 0;
+  }
+
+  return static_cast<double>(ops) * 1000 / wall_msec;
+}
+
+std::string LatencyToJson(const fastonosql::proxy::LatencyHistogram& hist) {
+  std::string result = common::MemSPrintf("{\"min\":%" PRIu64 ",\"mean\":%.1f", hist.GetMin(), hist.GetMean());
+  for (size_t i = 0; i < SIZEOFMASS(percentiles); ++i) {
+    result += common::MemSPrintf(",\"%s\":%" PRIu64, percentiles_names[i], hist.GetPercentile(percentiles[i]));
+  }
+  result += common::MemSPrintf(",\"max\":%" PRIu64 "}", hist.GetMax());
+  return result;
+}
+
+}  // namespace
+
+namespace fastonosql {
+namespace proxy {
+
+LatencyHistogram::LatencyHistogram()
+    : counts_(buckets_count, 0), count_(0), min_(std::numeric_limits<uint64_t>::max()), max_(0), sum_(0) {}
+
+size_t LatencyHistogram::GetIndex(uint64_t usec) {
+  if (usec < 2 * sub_bucket_count) {
+    return usec;
+  }
+
+  size_t msb = 0;
+  for (uint64_t v = usec; v > 1; v >>= 1) {
+    msb++;
+  }
+
+  const size_t shift = msb - 6;  // (usec >> shift) in [sub_bucket_count, 2 * sub_bucket_count)
+  const size_t sub = (usec >> shift) - sub_bucket_count;
+  return 2 * sub_bucket_count + (shift - 1) * sub_bucket_count + sub;
+}
+
+uint64_t LatencyHistogram::GetHighestEquivalentValue(size_t index) {
+  if (index < 2 * sub_bucket_count) {
+    return index;
+  }
+
+  const size_t shift = (index - 2 * sub_bucket_count) / sub_bucket_count + 1;
+  const uint64_t sub = (index - 2 * sub_bucket_count) % sub_bucket_count;
+  const uint64_t lowest = (sub + sub_bucket_count) << shift;
+  return lowest + ((static_cast<uint64_t>(1) << shift) - 1);
+}
+
+void LatencyHistogram::Record(uint64_t usec) {
+  counts_[GetIndex(usec)]++;
+  count_++;
+  min_ = std::min(min_, usec);
+  max_ = std::max(max_, usec);
+  sum_ += usec;
+}
+
+void LatencyHistogram::Merge(const LatencyHistogram& other) {
+  for (size_t i = 0; i < counts_.size(); ++i) {
+    counts_[i] += other.counts_[i];
+  }
+  count_ += other.count_;
+  min_ = std::min(min_, other.min_);
+  max_ = std::max(max_, other.max_);
+  sum_ += other.sum_;
+}
+
+uint64_t LatencyHistogram::GetCount() const {
+  return count_;
+}
+
+uint64_t LatencyHistogram::GetMin() const {
+  return count_ ? min_ : 0;
+}
+
+uint64_t LatencyHistogram::GetMax() const {
+  return max_;
+}
+
+double LatencyHistogram::GetMean() const {
+  return count_ ? sum_ / count_ : 0;
+}
+
+uint64_t LatencyHistogram::GetPercentile(double percent) const {
+  if (count_ == 0) {
+    return 0;
+  }
+
+  uint64_t target = static_cast<uint64_t>(percent / 100 * count_ + 0.5);
+  target = std::max<uint64_t>(target, 1);
+  uint64_t seen = 0;
+  for (size_t i = 0; i < counts_.size(); ++i) {
+    seen += counts_[i];
+    if (seen >= target) {
+      return std::min(GetHighestEquivalentValue(i), max_);
+    }
+  }
+
+  return max_;
+}
+
+BenchmarkStats::BenchmarkStats() : commands_(), total_(), errors_(0) {}
+
+void BenchmarkStats::Record(const core::command_buffer_t& command, uint64_t usec) {
+  commands_[CommandName(command)].Record(usec);
+  total_.Record(usec);
+}
+
+void BenchmarkStats::Merge(const BenchmarkStats& other) {
+  for (auto it = other.commands_.begin(); it != other.commands_.end(); ++it) {
+    commands_[it->first].Merge(it->second);
+  }
+  total_.Merge(other.total_);
+  errors_ += other.errors_;
+}
+
+uint64_t BenchmarkStats::GetErrorsCount() const {
+  return errors_;
+}
+
+void BenchmarkStats::AddError() {
+  errors_++;
+}
+
+std::string BenchmarkStats::ToJson(core::connectionTypes type, size_t concurrency, common::time64_t wall_msec) const {
+  std::string result = common::MemSPrintf(
+      "{\"type\":\"%s\",\"concurrency\":%" PRIu64 ",\"duration_msec\":%" PRId64 ",\"ops\":%" PRIu64
+      ",\"errors\":%" PRIu64 ",\"ops_per_sec\":%.1f,\"latency_usec\":%s,\"commands\":{",
+      core::ConnectionTypeToString(type), static_cast<uint64_t>(concurrency), wall_msec, total_.GetCount(), errors_,
+      OpsPerSec(total_.GetCount(), wall_msec), LatencyToJson(total_));
+  for (auto it = commands_.begin(); it != commands_.end(); ++it) {
+    if (it != commands_.begin()) {
+      result += ",";
+    }
+    result += common::MemSPrintf("\"%s\":{\"ops\":%" PRIu64 ",\"ops_per_sec\":%.1f,\"latency_usec\":%s}",
+                                 JsonEscape(it->first), it->second.GetCount(),
+                                 OpsPerSec(it->second.GetCount(), wall_msec), LatencyToJson(it->second));
+  }
+  result += "}}";
+  return result;
+}
+
+IBenchmarkWorker::~IBenchmarkWorker() {}
+
+}  // namespace proxy
+}  // namespace fastonosql
@@ -0,0 +1,115 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <common/error.h>  // for Error
+#include <common/time.h>   // for time64_t
+
+#include "core/connection_types.h"  // for connectionTypes
+#include "core/global.h"            // for FastoObject
+
+namespace fastonosql {
+namespace proxy {
+
+// HDR style histogram of latencies in microseconds:
+// 128 exact buckets, then 64 sub buckets per power of two, so relative error is below 1/64
+class LatencyHistogram {
+ public:
+  enum { sub_bucket_count = 64, buckets_count = 2 * sub_bucket_count + 57 * sub_bucket_count };
+
+  LatencyHistogram();
+
+  void Record(uint64_t usec);
+  void Merge(const LatencyHistogram& other);
+
+  uint64_t GetCount() const;
+  uint64_t GetMin() const;
+  uint64_t GetMax() const;
+  double GetMean() const;
+  uint64_t GetPercentile(double percent) const;  // highest value equivalent to bucket
+
+ private:
+  static size_t GetIndex(uint64_t usec);
+  static uint64_t GetHighestEquivalentValue(size_t index);
+
+  std::vector<uint64_t> counts_;
+  uint64_t count_;
+  uint64_t min_;
+  uint64_t max_;
+  double sum_;
+};
+
+// latencies per command name (first word of command) and for all commands
+class BenchmarkStats {
+ public:
+  BenchmarkStats();
+
+  void Record(const core::command_buffer_t& command, uint64_t usec);
+  void Merge(const BenchmarkStats& other);
+
+  uint64_t GetErrorsCount() const;
+  void AddError();
+
+  // machine readable report, ops per second calculated over wall time of whole run
+  std::string ToJson(core::connectionTypes type, size_t concurrency, common::time64_t wall_msec) const;
+
+ private:
+  std::map<std::string, LatencyHistogram> commands_;
+  LatencyHistogram total_;
+  uint64_t errors_;
+};
+
+// separate connection for additional benchmark threads
+class IBenchmarkWorker {
+ public:
+  virtual ~IBenchmarkWorker();
+
+  virtual common::Error Connect() WARN_UNUSED_RESULT = 0;
+  virtual common::Error Execute(const core::command_buffer_t& command) WARN_UNUSED_RESULT = 0;
+};
+
+template <typename DBConnection>
+class BenchmarkWorker : public IBenchmarkWorker {
+ public:
+  typedef typename DBConnection::config_t config_t;
+
+  explicit BenchmarkWorker(const config_t& config) : impl_(nullptr), config_(config) {}
+  virtual ~BenchmarkWorker() {
+    common::Error err = impl_.Disconnect();
+    UNUSED(err);
+  }
+
+  virtual common::Error Connect() override WARN_UNUSED_RESULT { return impl_.Connect(config_); }
+
+  virtual common::Error Execute(const core::command_buffer_t& command) override WARN_UNUSED_RESULT {
+    core::FastoObjectIPtr root = core::FastoObject::CreateRoot(command);
+    return impl_.Execute(command, root.get());
+  }
+
+ private:
+  DBConnection impl_;  // without client, so keys changes aren't reported to gui
+  const config_t config_;
+};
+
+}  // namespace proxy
+}  // namespace fastonosql
@@ -21,8 +21,14 @@
 #include <QApplication>
 #include <QThread>
 
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <thread>
+
 #include <common/convert2string.h>  // for ConvertToString, etc
-#include <common/file_system/file.h>
 #include <common/file_system/file_system.h>
 #include <common/file_system/string_path_utils.h>
 #include <common/sprintf.h>
@@ -30,41 +36,9 @@
 #include <common/time.h>  // for current_mstime
 
 #include "proxy/command/command_logger.h"  // for LOG_COMMAND
+#include "proxy/driver/benchmark.h"
 #include "proxy/driver/first_child_update_root_locker.h"
-
-namespace {
-
-const char magicNumber = 0x1E;
-std::string createStamp(common::time64_t time) {
-  return magicNumber + common::ConvertToString(time) + '\n';
-}
-
-bool getStamp(common::buffer_t stamp, common::time64_t* time_out) {
-  if (stamp.empty()) {
-    return false;
-  }
-
-  if (stamp[0] != magicNumber) {
-    return false;
-  }
-
-  stamp.erase(stamp.begin());  // pop_front
-  if (stamp.empty()) {
-    return false;
-  }
-
-  if (stamp[stamp.size() - 1] == '\n') {
-    stamp.pop_back();
-  }
-
-  common::time64_t ltime_out;
-  if (!common::ConvertFromBytes(stamp, &ltime_out)) {
-    return false;
-  }
-  *time_out = ltime_out;
-  return ltime_out != 0;
-}
-}  // namespace
+#include "proxy/driver/server_info_history.h"
 
 namespace fastonosql {
 namespace proxy {
@@ -106,7 +80,7 @@ void ReplyNotImplementedYet(IDriver* sender, event_request_type* ev, const char*
 }  // namespace
 
 IDriver::IDriver(IConnectionSettingsBaseSPtr settings)
-    : settings_(settings), thread_(nullptr), timer_info_id_(0), log_file_(nullptr) {
+    : settings_(settings), thread_(nullptr), timer_info_id_(0), history_(nullptr) {
   thread_ = new QThread(this);
   moveToThread(thread_);
 
@@ -115,10 +89,7 @@ IDriver::IDriver(IConnectionSettingsBaseSPtr settings)
 }
 
 IDriver::~IDriver() {
-  if (log_file_) {
-    log_file_->Close();
-    destroy(&log_file_);
-  }
+  destroy(&history_);
 }
 
 common::Error IDriver::Execute(core::FastoObjectCommandIPtr cmd) {
@@ -132,6 +103,156 @@ common::Error IDriver::Execute(core::FastoObjectCommandIPtr cmd) {
   return err;
 }
 
+common::Error IDriver::Execute(core::FastoObjectCommandIPtr cmd, const core::commands_args_t& argv) {
+  if (!cmd || argv.empty()) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  LOG_COMMAND(cmd);
+  return ExecuteImpl(argv, cmd.get());
+}
+
+common::Error IDriver::ExecutePipeline(const std::vector<core::FastoObjectCommandIPtr>& cmds) {
+  if (cmds.empty()) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  return ExecutePipelineImpl(cmds);
+}
+
+common::Error IDriver::ExecutePipelineImpl(const std::vector<core::FastoObjectCommandIPtr>& cmds) {
+  for (size_t i = 0; i < cmds.size(); ++i) {
+    if (IsInterrupted()) {
+      return common::make_error(common::COMMON_EINTR);
+    }
+
+    common::Error err = Execute(cmds[i]);
+    if (err) {
+      return err;
+    }
+  }
+
+  return common::Error();
+}
+
+IBenchmarkWorker* IDriver::CreateBenchmarkWorker() const {
+  return nullptr;
+}
+
+common::Error IDriver::ExecuteBenchmark(QObject* sender,
+                                        const std::vector<core::command_buffer_t>& commands,
+                                        size_t repeat,
+                                        common::time64_t msec_repeat_interval,
+                                        size_t concurrency,
+                                        core::FastoObject* out) {
+  typedef std::function<common::Error(const core::command_buffer_t& command)> execute_t;
+  std::vector<std::unique_ptr<IBenchmarkWorker>> workers;
+  for (size_t i = 0; i < concurrency; ++i) {
+    std::unique_ptr<IBenchmarkWorker> worker(CreateBenchmarkWorker());
+    if (!worker) {  // store can't be opened twice
+      break;
+    }
+
+    common::Error err = worker->Connect();
+    if (err) {
+      return err;
+    }
+    workers.push_back(std::move(worker));
+  }
+
+  std::vector<execute_t> executors;
+  for (size_t i = 0; i < workers.size(); ++i) {
+    IBenchmarkWorker* worker = workers[i].get();
+    executors.push_back([worker](const core::command_buffer_t& command) { return worker->Execute(command); });
+  }
+  if (executors.empty()) {
+    executors.push_back([this](const core::command_buffer_t& command) {
+      core::FastoObjectCommandIPtr cmd = CreateCommandFast(command, core::C_INNER);
+      return ExecuteImpl(command, cmd.get());  // without logging, it would be measured too
+    });
+  }
+
+  const size_t threads_count = executors.size();
+  const uint64_t total_ops = static_cast<uint64_t>(commands.size()) * (repeat + 1) * threads_count;
+  std::vector<BenchmarkStats> stats(threads_count);
+  std::vector<common::Error> errors(threads_count);
+  std::atomic<uint64_t> done_ops(0);
+  auto run = [&](size_t index) {
+    int last_progress = 0;
+    for (size_t r = 0; r < repeat + 1; ++r) {
+      const common::time64_t start_ts = common::time::current_mstime();
+      for (size_t i = 0; i < commands.size(); ++i) {
+        if (IsInterrupted()) {
+          errors[index] = common::make_error(common::COMMON_EINTR);
+          return;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        common::Error err = executors[index](commands[i]);
+        const auto usec =
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+        if (err) {  // latencies of failed commands aren't representative
+          stats[index].AddError();
+          if (!errors[index]) {
+            errors[index] = err;
+          }
+        } else {
+          stats[index].Record(commands[i], usec);
+        }
+
+        const uint64_t done = ++done_ops;
+        const int progress = static_cast<int>(done * 99 / total_ops);
+        if (index == 0 && progress != last_progress) {  // events are posted from driver thread only
+          last_progress = progress;
+          NotifyProgress(sender, progress);
+        }
+      }
+
+      const common::time64_t diff = common::time::current_mstime() - start_ts;
+      if (msec_repeat_interval > diff) {
+        common::threads::PlatformThread::Sleep(msec_repeat_interval - diff);
+      }
+    }
+  };
+
+  const auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < threads_count; ++i) {
+    threads.push_back(std::thread(run, i));
+  }
+  run(0);
+  for (size_t i = 0; i < threads.size(); ++i) {
+    threads[i].join();
+  }
+  const common::time64_t wall_msec =
+      std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+  BenchmarkStats total;
+  for (size_t i = 0; i < stats.size(); ++i) {
+    total.Merge(stats[i]);
+  }
+
+  const std::string report = total.ToJson(GetType(), threads_count, wall_msec);
+  core::FastoObjectIPtr child = new core::FastoObject(out, common::Value::CreateStringValue(report), GetDelimiter());
+  out->AddChildren(child);
+  for (size_t i = 0; i < errors.size(); ++i) {
+    if (errors[i] && (errors[i]->GetErrorCode() == common::COMMON_EINTR || total.GetErrorsCount() == total_ops)) {
+      return errors[i];
+    }
+  }
+
+  return common::Error();
+}
+
+void IDriver::AddListedKeys(const core::NKeys& keys, events_info::LoadDatabaseContentResponce::keys_container_t* out) {
+  for (size_t i = 0; i < keys.size(); ++i) {
+    core::NValue empty_val(common::Value::CreateEmptyValueFromType(common::Value::TYPE_STRING));
+    out->push_back(core::NDbKValue(keys[i], empty_val));
+  }
+}
+
 void IDriver::Reply(QObject* reciver, QEvent* ev) {
   qApp->postEvent(reciver, ev);
 }
@@ -230,6 +351,9 @@ void IDriver::customEvent(QEvent* event) {
   } else if (type == static_cast<QEvent::Type>(events::LoadDatabaseContentRequestEvent::EventType)) {
     events::LoadDatabaseContentRequestEvent* ev = static_cast<events::LoadDatabaseContentRequestEvent*>(event);
     HandleLoadDatabaseContentEvent(ev);
+  } else if (type == static_cast<QEvent::Type>(events::LoadKeyPageRequestEvent::EventType)) {
+    events::LoadKeyPageRequestEvent* ev = static_cast<events::LoadKeyPageRequestEvent*>(event);
+    HandleLoadKeyPageEvent(ev);  // ni
   } else if (type == static_cast<QEvent::Type>(events::DiscoveryInfoRequestEvent::EventType)) {
     events::DiscoveryInfoRequestEvent* ev = static_cast<events::DiscoveryInfoRequestEvent*>(event);
     HandleDiscoveryInfoEvent(ev);  //
@@ -240,28 +364,19 @@ void IDriver::customEvent(QEvent* event) {
 
 void IDriver::timerEvent(QTimerEvent* event) {
   if (timer_info_id_ == event->timerId() && settings_->IsHistoryEnabled() && IsConnected()) {
-    if (!log_file_) {
+    if (!history_) {
       std::string path = settings_->GetLoggingPath();
       std::string dir = common::file_system::get_dir_path(path);
       common::ErrnoError err = common::file_system::create_directory(dir, true);
       if (err) {
       }
       if (common::file_system::is_directory(dir) == common::SUCCESS) {
-        common::file_system::ascii_string_path p(path);
-        log_file_ = new common::file_system::ANSIFile(p);
-      }
-    }
-
-    if (log_file_ && !log_file_->IsOpened()) {
-      common::ErrnoError err = log_file_->Open("ab+");
-      if (err) {
-        DNOTREACHED();
+        history_ = new ServerInfoHistory(path, GetType());
       }
     }
 
-    if (log_file_ && log_file_->IsOpened()) {
+    if (history_) {
       common::time64_t time = common::time::current_mstime();
-      std::string stamp = createStamp(time);
       core::IServerInfo* info = nullptr;
       common::Error err = GetCurrentServerInfo(&info);
       if (err) {
@@ -272,9 +387,10 @@ void IDriver::timerEvent(QTimerEvent* event) {
       core::ServerInfoSnapShoot shot(time, core::IServerInfoSPtr(info));
       emit ServerInfoSnapShooted(shot);
 
-      log_file_->Write(stamp);
-      log_file_->Write(info->ToString());
-      log_file_->Flush();
+      err = history_->Append(time, info);
+      if (err) {
+        DNOTREACHED();
+      }
     }
   }
   QObject::timerEvent(event);
@@ -319,13 +435,18 @@ void IDriver::HandleExecuteEvent(events::ExecuteRequestEvent* ev) {
   events::ExecuteResponceEvent::value_type res(ev->value());
 
   const core::command_buffer_t input_line = res.text;
+  const core::commands_args_t args = res.args;
   std::vector<core::command_buffer_t> commands;
-  common::Error err = core::ParseCommands(input_line, &commands);
-  if (err) {
-    res.setErrorInfo(err);
-    Reply(sender, new events::ExecuteResponceEvent(this, res));
-    NotifyProgress(sender, 100);
-    return;
+  if (args.empty()) {
+    common::Error err = core::ParseCommands(input_line, &commands);
+    if (err) {
+      res.setErrorInfo(err);
+      Reply(sender, new events::ExecuteResponceEvent(this, res));
+      NotifyProgress(sender, 100);
+      return;
+    }
+  } else {
+    commands.push_back(input_line);  // shown in console, args are executed
   }
 
   const bool silence = res.silence;
@@ -336,11 +457,44 @@ void IDriver::HandleExecuteEvent(events::ExecuteRequestEvent* ev) {
   RootLocker* lock = history ? new RootLocker(this, sender, input_line, silence)
                              : new FirstChildUpdateRootLocker(this, sender, input_line, silence, commands);
   core::FastoObjectIPtr obj = lock->Root();
+  const bool pipeline = res.pipeline;
   const double step = 99.0 / double(commands.size() * (repeat + 1));
   double cur_progress = 0.0;
+  if (res.benchmark_concurrency) {
+    common::Error err =
+        ExecuteBenchmark(sender, commands, repeat, msec_repeat_interval, res.benchmark_concurrency, obj.get());
+    if (err) {
+      res.setErrorInfo(err);
+    }
+    goto done;
+  }
+
   for (size_t r = 0; r < repeat + 1; ++r) {
     common::time64_t start_ts = common::time::current_mstime();
-    for (size_t i = 0; i < commands.size(); ++i) {
+    if (pipeline) {
+      if (IsInterrupted()) {
+        res.setErrorInfo(common::make_error(common::COMMON_EINTR));
+        goto done;
+      }
+
+      std::vector<core::FastoObjectCommandIPtr> cmds;
+      cmds.reserve(commands.size());
+      for (size_t i = 0; i < commands.size(); ++i) {
+        core::command_buffer_t command = commands[i];
+        cmds.push_back(silence ? CreateCommandFast(command, log_type) : CreateCommand(obj.get(), command, log_type));
+      }
+
+      common::Error err = ExecutePipeline(cmds);
+      if (err) {
+        res.setErrorInfo(err);
+        goto done;
+      }
+
+      cur_progress += step * commands.size();
+      NotifyProgress(sender, static_cast<int>(cur_progress));
+    }
+
+    for (size_t i = 0; !pipeline && i < commands.size(); ++i) {
       if (IsInterrupted()) {
         res.setErrorInfo(common::make_error(common::COMMON_EINTR));
         goto done;
@@ -352,7 +506,7 @@ void IDriver::HandleExecuteEvent(events::ExecuteRequestEvent* ev) {
       core::command_buffer_t command = commands[i];
       core::FastoObjectCommandIPtr cmd =
           silence ? CreateCommandFast(command, log_type) : CreateCommand(obj.get(), command, log_type);  //
-      common::Error err = Execute(cmd);
+      common::Error err = args.empty() ? Execute(cmd) : Execute(cmd, args);
       if (err) {
         res.setErrorInfo(err);
         goto done;
@@ -396,6 +550,10 @@ void IDriver::HandleRestoreEvent(events::RestoreRequestEvent* ev) {
   ReplyNotImplementedYet<events::RestoreRequestEvent, events::RestoreResponceEvent>(this, ev, "export server");
 }
 
+void IDriver::HandleLoadKeyPageEvent(events::LoadKeyPageRequestEvent* ev) {
+  ReplyNotImplementedYet<events::LoadKeyPageRequestEvent, events::LoadKeyPageResponceEvent>(this, ev, "load key page");
+}
+
 void IDriver::HandleLoadDatabaseInfosEvent(events::LoadDatabasesInfoRequestEvent* ev) {
   QObject* sender = ev->sender();
   NotifyProgress(sender, 0);
@@ -434,43 +592,19 @@ void IDriver::HandleLoadServerInfoHistoryEvent(events::ServerInfoHistoryRequestE
   QObject* sender = ev->sender();
   events::ServerInfoHistoryResponceEvent::value_type res(ev->value());
 
-  std::string path = settings_->GetLoggingPath();
-  common::file_system::ascii_string_path p(path);
-  common::file_system::ANSIFile readFile(p);
-  if (readFile.Open("rb")) {
-    events::ServerInfoHistoryResponceEvent::value_type::infos_container_type tmpInfos;
-
-    common::time64_t curStamp = 0;
-    common::buffer_t dataInfo;
-
-    while (!readFile.IsEOF()) {
-      common::buffer_t data;
-      bool res = readFile.ReadLine(&data);
-      if (!res || readFile.IsEOF()) {
-        if (curStamp) {
-          core::ServerInfoSnapShoot shoot(curStamp, MakeServerInfoFromString(common::ConvertToString(dataInfo)));
-          tmpInfos.push_back(shoot);
-        }
-        break;
-      }
+  events::ServerInfoHistoryResponceEvent::value_type::infos_container_type infos;
+  common::Error err;
+  if (history_) {
+    err = history_->Read(0, std::numeric_limits<common::time64_t>::max(), &infos);
+  } else {
+    ServerInfoHistory history(settings_->GetLoggingPath(), GetType());
+    err = history.Read(0, std::numeric_limits<common::time64_t>::max(), &infos);
+  }
 
-      common::time64_t tmpStamp = 0;
-      bool isSt = getStamp(data, &tmpStamp);
-      if (isSt) {
-        if (curStamp) {
-          core::ServerInfoSnapShoot shoot(curStamp, MakeServerInfoFromString(common::ConvertToString(dataInfo)));
-          tmpInfos.push_back(shoot);
-        }
-        curStamp = tmpStamp;
-        dataInfo.clear();
-      } else {
-        dataInfo.insert(dataInfo.end(), data.begin(), data.end());
-      }
-    }
-    res.setInfos(tmpInfos);
-    readFile.Close();
+  if (err) {
+    res.setErrorInfo(err);
   } else {
-    res.setErrorInfo(common::make_error("History file not found"));
+    res.setInfos(infos);
   }
 
   Reply(sender, new events::ServerInfoHistoryResponceEvent(this, res));
@@ -480,27 +614,16 @@ void IDriver::HandleClearServerHistoryEvent(events::ClearServerHistoryRequestEve
   QObject* sender = ev->sender();
   events::ClearServerHistoryResponceEvent::value_type res(ev->value());
 
-  bool ret = false;
-
-  if (log_file_ && log_file_->IsOpened()) {
-    common::ErrnoError err = log_file_->Truncate(0);
-    ret = err ? false : true;
+  common::Error err;
+  if (history_) {
+    err = history_->Clear();
   } else {
-    std::string path = settings_->GetLoggingPath();
-    if (common::file_system::is_file_exist(path)) {
-      common::ErrnoError err = common::file_system::remove_file(path);
-      if (err) {
-        ret = false;
-      } else {
-        ret = true;
-      }
-    } else {
-      ret = true;
-    }
+    ServerInfoHistory history(settings_->GetLoggingPath(), GetType());
+    err = history.Clear();
   }
 
-  if (!ret) {
-    res.setErrorInfo(common::make_error("Clear file error!"));
+  if (err) {
+    res.setErrorInfo(err);
   }
 
   Reply(sender, new events::ClearServerHistoryResponceEvent(this, res));
@@ -30,15 +30,13 @@
 class QEvent;
 class QThread;  // lines 37-37
 class QTimerEvent;
-namespace common {
-namespace file_system {
-class ANSIFile;
-}
-}  // namespace common
 
 namespace fastonosql {
 namespace proxy {
 
+class IBenchmarkWorker;
+class ServerInfoHistory;
+
 // slot signal naming
 // updateValue => valueUpdated
 
@@ -70,6 +68,7 @@ class IDriver : public QObject, public core::CDBConnectionClient {
 
  Q_SIGNALS:
   void ChildAdded(core::FastoObjectIPtr child);
+  void ChildRemoved(core::FastoObjectIPtr child);
   void ItemUpdated(core::FastoObject* item, common::ValueSPtr val);
   void ServerInfoSnapShooted(core::ServerInfoSnapShoot shot);
 
@@ -115,6 +114,7 @@ class IDriver : public QObject, public core::CDBConnectionClient {
   virtual void HandleBackupEvent(events::BackupRequestEvent* ev);
   virtual void HandleRestoreEvent(events::RestoreRequestEvent* ev);
   virtual void HandleLoadDatabaseInfosEvent(events::LoadDatabasesInfoRequestEvent* ev);
+  virtual void HandleLoadKeyPageEvent(events::LoadKeyPageRequestEvent* ev);
 
   template <typename T>
   inline std::shared_ptr<T> GetSpecificSettings() const {
@@ -122,6 +122,11 @@ class IDriver : public QObject, public core::CDBConnectionClient {
   }
 
   common::Error Execute(core::FastoObjectCommandIPtr cmd) WARN_UNUSED_RESULT;
+  // cmd input is only logged, argv is passed to engine as is
+  common::Error Execute(core::FastoObjectCommandIPtr cmd, const core::commands_args_t& argv) WARN_UNUSED_RESULT;
+  common::Error ExecutePipeline(const std::vector<core::FastoObjectCommandIPtr>& cmds) WARN_UNUSED_RESULT;
+  // keys in scan order with empty string values, value is read only when key is opened
+  static void AddListedKeys(const core::NKeys& keys, events_info::LoadDatabaseContentResponce::keys_container_t* out);
   virtual core::FastoObjectCommandIPtr CreateCommand(core::FastoObject* parent,
                                                      const core::command_buffer_t& input,
                                                      core::CmdLoggingType ct) = 0;
@@ -136,8 +141,19 @@ class IDriver : public QObject, public core::CDBConnectionClient {
   void HandleLoadServerInfoHistoryEvent(events::ServerInfoHistoryRequestEvent* ev);
   void HandleDiscoveryInfoEvent(events::DiscoveryInfoRequestEvent* ev);
   void HandleClearServerHistoryEvent(events::ClearServerHistoryRequestEvent* ev);
+  common::Error ExecuteBenchmark(QObject* sender,
+                                 const std::vector<core::command_buffer_t>& commands,
+                                 size_t repeat,
+                                 common::time64_t msec_repeat_interval,
+                                 size_t concurrency,
+                                 core::FastoObject* out) WARN_UNUSED_RESULT;
 
   virtual common::Error ExecuteImpl(const core::command_buffer_t& command, core::FastoObject* out) = 0;
+  virtual common::Error ExecuteImpl(const core::commands_args_t& argv, core::FastoObject* out) = 0;
+  // default: commands executed one by one
+  virtual common::Error ExecutePipelineImpl(const std::vector<core::FastoObjectCommandIPtr>& cmds);
+  // additional connection for benchmark threads, default: nullptr, benchmark runs on driver connection
+  virtual IBenchmarkWorker* CreateBenchmarkWorker() const;
 
   virtual void OnCreatedDB(core::IDataBaseInfo* info) override;
   virtual void OnRemovedDB(core::IDataBaseInfo* info) override;
@@ -156,7 +172,6 @@ class IDriver : public QObject, public core::CDBConnectionClient {
   virtual void OnQuited() override;
 
  private:
-  virtual core::IServerInfoSPtr MakeServerInfoFromString(const std::string& val) = 0;
   virtual void InitImpl() = 0;
   virtual void ClearImpl() = 0;
 
@@ -173,7 +188,7 @@ class IDriver : public QObject, public core::CDBConnectionClient {
   const IConnectionSettingsBaseSPtr settings_;
   QThread* thread_;
   int timer_info_id_;
-  common::file_system::ANSIFile* log_file_;
+  ServerInfoHistory* history_;
 };
 
 }  // namespace proxy
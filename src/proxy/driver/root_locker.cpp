@@ -58,6 +58,10 @@ void RootLocker::ChildrenAdded(core::FastoObjectIPtr child) {
   emit parent_->ChildAdded(child);
 }
 
+void RootLocker::ChildrenRemoved(core::FastoObjectIPtr child) {
+  emit parent_->ChildRemoved(child);
+}
+
 void RootLocker::Updated(core::FastoObject* item, core::FastoObject::value_t val) {
   emit parent_->ItemUpdated(item, val);
 }
@@ -36,6 +36,7 @@ class RootLocker : core::FastoObject::IFastoObjectObserver {
  protected:
   // notification of execute events
   virtual void ChildrenAdded(core::FastoObjectIPtr child) override;
+  virtual void ChildrenRemoved(core::FastoObjectIPtr child) override;
   virtual void Updated(core::FastoObject* item, core::FastoObject::value_t val) override;
 
  private:
@@ -0,0 +1,332 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "proxy/driver/server_info_history.h"
+
+#include <math.h>
+#include <string.h>
+
+#include <QFile>
+
+#include <common/convert2string.h>
+#include <common/qt/convert2string.h>
+#include <common/sprintf.h>
+
+#include "core/db_traits.h"  // for InfoFieldsFromType
+
+#define HISTORY_MAGIC "FNSH"
+#define HISTORY_ROTATED_SUFFIX ".1"
+
+namespace {
+
+QString ToQString(const std::string& path) {
+  QString qpath;
+  common::ConvertFromString(path, &qpath);
+  return qpath;
+}
+
+common::Error MakeFileError(const QFile& file) {
+  return common::make_error(common::ConvertToString(file.errorString()));
+}
+
+}  // namespace
+
+namespace fastonosql {
+namespace proxy {
+
+HistoryServerInfo::HistoryServerInfo(core::connectionTypes type,
+                                     const std::vector<size_t>& offsets,
+                                     const values_t& values)
+    : core::IServerInfo(type), offsets_(offsets), values_(values) {}
+
+std::string HistoryServerInfo::ToString() const {
+  std::string result;
+  for (size_t i = 0; i < values_.size(); ++i) {
+    if (!isnan(values_[i])) {
+      result += common::ConvertToString(values_[i]) + "\n";
+    }
+  }
+  return result;
+}
+
+uint32_t HistoryServerInfo::GetVersion() const {
+  return 0;
+}
+
+common::Value* HistoryServerInfo::GetValueByIndexes(unsigned char property, unsigned char field) const {
+  if (property >= offsets_.size()) {
+    return nullptr;
+  }
+
+  const size_t index = offsets_[property] + field;
+  const size_t end = property + 1 < offsets_.size() ? offsets_[property + 1] : values_.size();
+  if (index >= end || isnan(values_[index])) {
+    return nullptr;
+  }
+
+  return common::Value::CreateDoubleValue(values_[index]);
+}
+
+const int64_t ServerInfoHistory::max_file_size = 64 * 1024 * 1024;
+
+ServerInfoHistory::ServerInfoHistory(const std::string& path, core::connectionTypes type)
+    : path_(path), type_(type), offsets_(), fields_count_(0), file_(nullptr) {
+  std::vector<core::info_field_t> fields = core::InfoFieldsFromType(type_);
+  for (size_t i = 0; i < fields.size(); ++i) {
+    offsets_.push_back(fields_count_);
+    fields_count_ += fields[i].second.size();
+  }
+}
+
+ServerInfoHistory::~ServerInfoHistory() {
+  if (file_) {
+    file_->close();
+    delete file_;
+    file_ = nullptr;
+  }
+}
+
+bool ServerInfoHistory::IsValidHeader(const Header& header) const {
+  return memcmp(header.magic, HISTORY_MAGIC, sizeof(header.magic)) == 0 && header.version == version &&
+         header.type == static_cast<uint32_t>(type_) && header.fields_count == fields_count_;
+}
+
+size_t ServerInfoHistory::GetRecordSize() const {
+  return sizeof(int64_t) + fields_count_ * sizeof(double);
+}
+
+common::Error ServerInfoHistory::OpenForWrite() {
+  if (file_ && file_->isOpen()) {
+    return common::Error();
+  }
+
+  if (!file_) {
+    file_ = new QFile(ToQString(path_));
+  }
+
+  if (!file_->open(QIODevice::ReadWrite)) {
+    return MakeFileError(*file_);
+  }
+
+  Header header;
+  const qint64 size = file_->size();
+  if (size >= static_cast<qint64>(sizeof(Header))) {
+    if (file_->read(reinterpret_cast<char*>(&header), sizeof(Header)) == sizeof(Header) && IsValidHeader(header)) {
+      // drop partially written record
+      const qint64 records = (size - sizeof(Header)) / GetRecordSize();
+      const qint64 valid_size = sizeof(Header) + records * GetRecordSize();
+      if (valid_size != size && !file_->resize(valid_size)) {
+        return MakeFileError(*file_);
+      }
+      file_->seek(valid_size);
+      return common::Error();
+    }
+  }
+
+  // empty, old text format or other fields set
+  if (!file_->resize(0)) {
+    return MakeFileError(*file_);
+  }
+  file_->seek(0);
+  memcpy(header.magic, HISTORY_MAGIC, sizeof(header.magic));
+  header.version = version;
+  header.type = type_;
+  header.fields_count = fields_count_;
+  if (file_->write(reinterpret_cast<const char*>(&header), sizeof(Header)) != sizeof(Header)) {
+    return MakeFileError(*file_);
+  }
+
+  return common::Error();
+}
+
+common::Error ServerInfoHistory::Rotate() {
+  file_->close();
+  const QString rotated = ToQString(path_ + HISTORY_ROTATED_SUFFIX);
+  QFile::remove(rotated);
+  if (!file_->rename(rotated)) {
+    return MakeFileError(*file_);
+  }
+
+  delete file_;
+  file_ = nullptr;
+  return OpenForWrite();
+}
+
+common::Error ServerInfoHistory::Append(common::time64_t msec, core::IServerInfo* info) {
+  if (!info) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  common::Error err = OpenForWrite();
+  if (err) {
+    return err;
+  }
+
+  if (file_->size() + static_cast<qint64>(GetRecordSize()) > max_file_size) {
+    err = Rotate();
+    if (err) {
+      return err;
+    }
+  }
+
+  std::vector<char> record(GetRecordSize());
+  const int64_t stamp = msec;
+  memcpy(record.data(), &stamp, sizeof(stamp));
+  char* fields_ptr = record.data() + sizeof(stamp);
+  std::vector<core::info_field_t> fields = core::InfoFieldsFromType(type_);
+  for (size_t i = 0; i < fields.size(); ++i) {
+    const std::vector<core::Field>& property = fields[i].second;
+    for (size_t j = 0; j < property.size(); ++j) {
+      double val = NAN;
+      if (property[j].IsIntegral()) {
+        common::Value* value = info->GetValueByIndexes(i, j);  // allocate
+        if (value) {
+          double lval = 0;
+          if (value->GetAsDouble(&lval)) {
+            val = lval;
+          }
+          delete value;
+        }
+      }
+      memcpy(fields_ptr, &val, sizeof(val));
+      fields_ptr += sizeof(val);
+    }
+  }
+
+  if (file_->write(record.data(), record.size()) != static_cast<qint64>(record.size())) {
+    return MakeFileError(*file_);
+  }
+
+  file_->flush();
+  return common::Error();
+}
+
+common::Error ServerInfoHistory::Read(common::time64_t from,
+                                      common::time64_t to,
+                                      std::vector<core::ServerInfoSnapShoot>* infos) const {
+  if (!infos || from > to) {
+    DNOTREACHED();
+    return common::make_error_inval();
+  }
+
+  if (file_) {
+    file_->flush();
+  }
+
+  const std::string rotated = path_ + HISTORY_ROTATED_SUFFIX;
+  if (QFile::exists(ToQString(rotated))) {
+    common::Error err = ReadFile(rotated, from, to, infos);
+    if (err) {
+      return err;
+    }
+  }
+
+  if (!QFile::exists(ToQString(path_))) {
+    if (infos->empty()) {
+      return common::make_error("History file not found");
+    }
+    return common::Error();
+  }
+
+  return ReadFile(path_, from, to, infos);
+}
+
+common::Error ServerInfoHistory::ReadFile(const std::string& path,
+                                          common::time64_t from,
+                                          common::time64_t to,
+                                          std::vector<core::ServerInfoSnapShoot>* infos) const {
+  QFile file(ToQString(path));
+  if (!file.open(QIODevice::ReadOnly)) {
+    return MakeFileError(file);
+  }
+
+  const qint64 size = file.size();
+  if (size < static_cast<qint64>(sizeof(Header))) {
+    return common::Error();
+  }
+
+  uchar* data = file.map(0, size);
+  if (!data) {
+    return MakeFileError(file);
+  }
+
+  Header header;
+  memcpy(&header, data, sizeof(Header));
+  if (!IsValidHeader(header)) {  // old format, will be replaced on next write
+    file.unmap(data);
+    return common::Error();
+  }
+
+  const size_t record_size = GetRecordSize();
+  const uchar* records = data + sizeof(Header);
+  const size_t count = (size - sizeof(Header)) / record_size;
+  auto stamp_at = [records, record_size](size_t index) {
+    int64_t stamp = 0;
+    memcpy(&stamp, records + index * record_size, sizeof(stamp));
+    return stamp;
+  };
+
+  // lower bound of from
+  size_t lo = 0;
+  size_t hi = count;
+  while (lo < hi) {
+    const size_t mid = lo + (hi - lo) / 2;
+    if (stamp_at(mid) < from) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+
+  for (size_t i = lo; i < count; ++i) {
+    const int64_t stamp = stamp_at(i);
+    if (stamp > to) {
+      break;
+    }
+
+    HistoryServerInfo::values_t values(fields_count_);
+    if (fields_count_) {
+      memcpy(values.data(), records + i * record_size + sizeof(stamp), fields_count_ * sizeof(double));
+    }
+    core::IServerInfoSPtr info(new HistoryServerInfo(type_, offsets_, values));
+    infos->push_back(core::ServerInfoSnapShoot(stamp, info));
+  }
+
+  file.unmap(data);
+  return common::Error();
+}
+
+common::Error ServerInfoHistory::Clear() {
+  if (file_) {
+    file_->close();
+    delete file_;
+    file_ = nullptr;
+  }
+
+  QFile::remove(ToQString(path_ + HISTORY_ROTATED_SUFFIX));
+  const QString qpath = ToQString(path_);
+  if (QFile::exists(qpath) && !QFile::remove(qpath)) {
+    return common::make_error("Clear file error!");
+  }
+
+  return common::Error();
+}
+
+}  // namespace proxy
+}  // namespace fastonosql
@@ -0,0 +1,90 @@
+/*  Copyright (C) 2014-2017 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <common/error.h>  // for Error
+
+#include "core/server/iserver_info.h"  // for ServerInfoSnapShoot
+
+class QFile;
+
+namespace fastonosql {
+namespace proxy {
+
+// snapshot restored from history file, only numeric fields are available
+class HistoryServerInfo : public core::IServerInfo {
+ public:
+  typedef std::vector<double> values_t;
+  HistoryServerInfo(core::connectionTypes type, const std::vector<size_t>& offsets, const values_t& values);
+
+  virtual std::string ToString() const override;
+  virtual uint32_t GetVersion() const override;
+  virtual common::Value* GetValueByIndexes(unsigned char property, unsigned char field) const override;
+
+ private:
+  const std::vector<size_t> offsets_;  // index of first field of property in values_
+  const values_t values_;
+};
+
+// binary time series of server info snapshots:
+// header, then fixed width records (int64 msec, double per info field, NaN for non numeric fields)
+// ordered by time, so time range is found by binary search over memory mapped file
+class ServerInfoHistory {
+ public:
+  enum { version = 1 };
+  static const int64_t max_file_size;  // rotate to path.1 after
+
+  ServerInfoHistory(const std::string& path, core::connectionTypes type);
+  ~ServerInfoHistory();
+
+  common::Error Append(common::time64_t msec, core::IServerInfo* info) WARN_UNUSED_RESULT;
+  common::Error Read(common::time64_t from,
+                     common::time64_t to,
+                     std::vector<core::ServerInfoSnapShoot>* infos) const WARN_UNUSED_RESULT;
+  common::Error Clear() WARN_UNUSED_RESULT;
+
+ private:
+  struct Header {
+    char magic[4];
+    uint32_t version;
+    uint32_t type;
+    uint32_t fields_count;
+  };
+
+  common::Error OpenForWrite() WARN_UNUSED_RESULT;
+  common::Error Rotate() WARN_UNUSED_RESULT;
+  bool IsValidHeader(const Header& header) const;
+  size_t GetRecordSize() const;
+  common::Error ReadFile(const std::string& path,
+                         common::time64_t from,
+                         common::time64_t to,
+                         std::vector<core::ServerInfoSnapShoot>* infos) const WARN_UNUSED_RESULT;
+
+  const std::string path_;
+  const core::connectionTypes type_;
+  std::vector<size_t> offsets_;
+  size_t fields_count_;
+  QFile* file_;
+};
+
+}  // namespace proxy
+}  // namespace fastonosql
@@ -74,6 +74,9 @@ typedef common::qt::Event<events_info::LoadDatabaseContentResponce, QEvent::User
 typedef common::qt::Event<events_info::DiscoveryInfoRequest, QEvent::User + 31> DiscoveryInfoRequestEvent;
 typedef common::qt::Event<events_info::DiscoveryInfoResponce, QEvent::User + 32> DiscoveryInfoResponceEvent;
 
+typedef common::qt::Event<events_info::LoadKeyPageRequest, QEvent::User + 33> LoadKeyPageRequestEvent;
+typedef common::qt::Event<events_info::LoadKeyPageResponce, QEvent::User + 34> LoadKeyPageResponceEvent;
+
 typedef common::qt::Event<events_info::ProgressInfoResponce, QEvent::User + 100> ProgressResponceEvent;
 
 }  // namespace events
@@ -81,14 +81,38 @@ ExecuteInfoRequest::ExecuteInfoRequest(initiator_type sender,
                                        bool history,
                                        bool silence,
                                        core::CmdLoggingType logtype,
+                                       bool pipeline,
+                                       size_t benchmark_concurrency,
                                        error_type er)
     : base_class(sender, er),
       text(text),
+      args(),
       repeat(repeat),
       msec_repeat_interval(msec_repeat_interval),
       history(history),
       silence(silence),
-      logtype(logtype) {}
+      logtype(logtype),
+      pipeline(pipeline),
+      benchmark_concurrency(benchmark_concurrency) {}
+
+ExecuteInfoRequest::ExecuteInfoRequest(initiator_type sender,
+                                       const core::commands_args_t& args,
+                                       size_t repeat,
+                                       common::time64_t msec_repeat_interval,
+                                       bool history,
+                                       bool silence,
+                                       core::CmdLoggingType logtype,
+                                       error_type er)
+    : base_class(sender, er),
+      text(core::ConvertArgsToCommandLine(args)),
+      args(args),
+      repeat(repeat),
+      msec_repeat_interval(msec_repeat_interval),
+      history(history),
+      silence(silence),
+      logtype(logtype),
+      pipeline(false),
+      benchmark_concurrency(0) {}
 
 ExecuteInfoResponce::ExecuteInfoResponce(const base_class& request) : base_class(request) {}
 
@@ -107,6 +131,18 @@ LoadDatabaseContentRequest::LoadDatabaseContentRequest(initiator_type sender,
 LoadDatabaseContentResponce::LoadDatabaseContentResponce(const base_class& request)
     : base_class(request), keys(), cursor_out(0), db_keys_count(0) {}
 
+LoadKeyPageRequest::LoadKeyPageRequest(initiator_type sender,
+                                       const core::NKey& key,
+                                       common::Value::Type type,
+                                       size_t count,
+                                       uint64_t cursor,
+                                       uint64_t generation,
+                                       error_type er)
+    : base_class(sender, er), key(key), type(type), count(count), cursor_in(cursor), generation(generation) {}
+
+LoadKeyPageResponce::LoadKeyPageResponce(const base_class& request)
+    : base_class(request), page(), cursor_out(0), key_size(0) {}
+
 LoadServerChannelsRequest::LoadServerChannelsRequest(initiator_type sender, const std::string& pattern, error_type er)
     : base_class(sender, er), pattern(pattern) {}
 
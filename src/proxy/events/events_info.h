@@ -141,14 +141,28 @@ struct ExecuteInfoRequest : public EventInfoBase {
                      bool history = true,
                      bool silence = false,
                      core::CmdLoggingType logtype = core::C_USER,
+                     bool pipeline = false,
+                     size_t benchmark_concurrency = 0,
+                     error_type er = error_type());
+  ExecuteInfoRequest(initiator_type sender,
+                     const core::commands_args_t& args,
+                     size_t repeat = 0,
+                     common::time64_t msec_repeat_interval = 0,
+                     bool history = true,
+                     bool silence = false,
+                     core::CmdLoggingType logtype = core::C_USER,
                      error_type er = error_type());
 
   const core::command_buffer_t text;
+  const core::commands_args_t args;  // single binary safe command, text is only shown in console
   const size_t repeat;
   const common::time64_t msec_repeat_interval;
   const bool history;
   const bool silence;
   const core::CmdLoggingType logtype;
+  const bool pipeline;  // send commands without waiting replies (if supported by driver)
+  // 0 - usual execution, otherwise measure latencies on that many connections and reply with json report
+  const size_t benchmark_concurrency;
 };
 
 struct ExecuteInfoResponce : ExecuteInfoRequest {
@@ -194,6 +208,32 @@ struct LoadDatabaseContentResponce : LoadDatabaseContentRequest {
   size_t db_keys_count;
 };
 
+struct LoadKeyPageRequest : public EventInfoBase {
+  typedef EventInfoBase base_class;
+  LoadKeyPageRequest(initiator_type sender,
+                     const core::NKey& key,
+                     common::Value::Type type,
+                     size_t count,
+                     uint64_t cursor = 0,
+                     uint64_t generation = 0,
+                     error_type er = error_type());
+
+  const core::NKey key;
+  const common::Value::Type type;
+  size_t count;
+  const uint64_t cursor_in;   // 0 for first page
+  const uint64_t generation;  // loadKey call of initiator, stale pages are dropped by it
+};
+
+struct LoadKeyPageResponce : LoadKeyPageRequest {
+  typedef LoadKeyPageRequest base_class;
+  explicit LoadKeyPageResponce(const base_class& request);
+
+  core::NValue page;    // value of request type with elements of page
+  uint64_t cursor_out;  // 0 when there are no more pages
+  size_t key_size;      // elements in key, discovered only for first page
+};
+
 struct LoadServerChannelsRequest : public EventInfoBase {
   typedef EventInfoBase base_class;
   LoadServerChannelsRequest(initiator_type sender, const std::string& pattern, error_type er = error_type());
@@ -29,6 +29,7 @@ namespace proxy {
 
 IServer::IServer(IDriver* drv) : drv_(drv), server_info_(), current_database_info_(), timer_check_key_exists_id_(0) {
   VERIFY(QObject::connect(drv_, &IDriver::ChildAdded, this, &IServer::ChildAdded));
+  VERIFY(QObject::connect(drv_, &IDriver::ChildRemoved, this, &IServer::ChildRemoved));
   VERIFY(QObject::connect(drv_, &IDriver::ItemUpdated, this, &IServer::ItemUpdated));
   VERIFY(QObject::connect(drv_, &IDriver::ServerInfoSnapShooted, this, &IServer::ServerInfoSnapShooted));
 
@@ -88,6 +89,10 @@ bool IServer::IsCanCreateDatabase() const {
   return fastonosql::core::IsCanCreateDatabase(GetType());
 }
 
+bool IServer::IsCanBackupLocalDatabase() const {
+  return fastonosql::core::IsCanBackupLocalDatabase(GetType());
+}
+
 core::translator_t IServer::GetTranslator() const {
   return drv_->GetTranslator();
 }
@@ -224,6 +229,12 @@ void IServer::LoadChannels(const events_info::LoadServerChannelsRequest& req) {
   NotifyStartEvent(ev);
 }
 
+void IServer::LoadKeyPage(const events_info::LoadKeyPageRequest& req) {
+  emit LoadKeyPageStarted(req);
+  QEvent* ev = new events::LoadKeyPageRequestEvent(this, req);
+  NotifyStartEvent(ev);
+}
+
 void IServer::customEvent(QEvent* event) {
   QEvent::Type type = event->type();
   if (type == static_cast<QEvent::Type>(events::ConnectResponceEvent::EventType)) {
@@ -284,6 +295,9 @@ void IServer::customEvent(QEvent* event) {
   } else if (type == static_cast<QEvent::Type>(events::LoadDatabaseContentResponceEvent::EventType)) {
     events::LoadDatabaseContentResponceEvent* ev = static_cast<events::LoadDatabaseContentResponceEvent*>(event);
     HandleLoadDatabaseContentEvent(ev);
+  } else if (type == static_cast<QEvent::Type>(events::LoadKeyPageResponceEvent::EventType)) {
+    events::LoadKeyPageResponceEvent* ev = static_cast<events::LoadKeyPageResponceEvent*>(event);
+    HandleLoadKeyPageEvent(ev);
   } else if (type == static_cast<QEvent::Type>(events::ExecuteResponceEvent::EventType)) {
     events::ExecuteResponceEvent* ev = static_cast<events::ExecuteResponceEvent*>(event);
     HandleExecuteEvent(ev);
@@ -438,6 +452,15 @@ void IServer::HandleLoadDatabaseContentEvent(events::LoadDatabaseContentResponce
   emit LoadDatabaseContentFinished(v);
 }
 
+void IServer::HandleLoadKeyPageEvent(events::LoadKeyPageResponceEvent* ev) {
+  auto v = ev->value();
+  common::Error err(v.errorInfo());
+  if (err) {
+    LOG_ERROR(err, common::logging::LOG_LEVEL_ERR, true);
+  }
+  emit LoadKeyPageFinished(v);
+}
+
 void IServer::CreateDB(core::IDataBaseInfoSPtr db) {
   database_t dbs = FindDatabase(db);
   if (!dbs) {
@@ -596,12 +619,12 @@ void IServer::HandleCheckDBKeys(core::IDataBaseInfoSPtr db, core::ttl_t expired_
       const core::ttl_t new_ttl = key_ttl - expired_time;
       if (new_ttl == NO_TTL) {
         core::translator_t trans = GetTranslator();
-        core::command_buffer_t load_ttl_cmd;
-        common::Error err = trans->LoadKeyTTLCommand(nkey, &load_ttl_cmd);
+        core::commands_args_t load_ttl_args;
+        common::Error err = trans->LoadKeyTTLCommand(nkey, &load_ttl_args);
         if (err) {
           return;
         }
-        proxy::events_info::ExecuteInfoRequest req(this, load_ttl_cmd, 0, 0, true, true, core::C_INNER);
+        proxy::events_info::ExecuteInfoRequest req(this, load_ttl_args, 0, 0, true, true, core::C_INNER);
         Execute(req);
       } else {
         if (db->UpdateKeyTTL(nkey, new_ttl)) {
@@ -41,6 +41,7 @@ class IServer : public IServerBase, public std::enable_shared_from_this<IServer>
   bool IsCanRemote() const;
   bool IsSupportTTLKeys() const;
   bool IsCanCreateDatabase() const;
+  bool IsCanBackupLocalDatabase() const;
 
   core::translator_t GetTranslator() const;
 
@@ -106,8 +107,12 @@ class IServer : public IServerBase, public std::enable_shared_from_this<IServer>
   void LoadDiscoveryInfoStarted(const events_info::DiscoveryInfoRequest& res);
   void LoadDiscoveryInfoFinished(const events_info::DiscoveryInfoResponce& res);
 
+  void LoadKeyPageStarted(const events_info::LoadKeyPageRequest& req);
+  void LoadKeyPageFinished(const events_info::LoadKeyPageResponce& res);
+
  Q_SIGNALS:
   void ChildAdded(core::FastoObjectIPtr child);
+  void ChildRemoved(core::FastoObjectIPtr child);
   void ItemUpdated(core::FastoObject* item, common::ValueSPtr val);
   void ServerInfoSnapShooted(core::ServerInfoSnapShoot shot);
 
@@ -154,6 +159,7 @@ class IServer : public IServerBase, public std::enable_shared_from_this<IServer>
 
   void LoadChannels(const events_info::LoadServerChannelsRequest& req);  // signals: LoadServerChannelsStarted,
                                                                          // LoadServerChannelsFinished
+  void LoadKeyPage(const events_info::LoadKeyPageRequest& req);  // signals: LoadKeyPageStarted, LoadKeyPageFinished
 
  protected:
   explicit IServer(IDriver* drv);  // take ownerships
@@ -181,6 +187,7 @@ class IServer : public IServerBase, public std::enable_shared_from_this<IServer>
   // handle database events
   virtual void HandleLoadDatabaseInfosEvent(events::LoadDatabasesInfoResponceEvent* ev);
   virtual void HandleLoadDatabaseContentEvent(events::LoadDatabaseContentResponceEvent* ev);
+  virtual void HandleLoadKeyPageEvent(events::LoadKeyPageResponceEvent* ev);
 
   // handle command events
   virtual void HandleDiscoveryInfoResponceEvent(events::DiscoveryInfoResponceEvent* ev);
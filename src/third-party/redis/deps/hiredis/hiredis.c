@@ -632,6 +632,8 @@ static redisContext *redisContextInit(void) {
     c->ssl_ctx = NULL;
     c->session = NULL;
     c->channel = NULL;
+    c->ibuf = NULL;
+    c->ibuf_size = 0;
 #endif
 
     return c;
@@ -666,6 +668,8 @@ void redisFree(redisContext *c) {
     }
     if (c->obuf != NULL)
         sdsfree(c->obuf);
+    if (c->ibuf != NULL)
+        free(c->ibuf);
     if (c->reader != NULL)
         redisReaderFree(c->reader);
     if (c->tcp.host)
@@ -1020,13 +1024,42 @@ int redisEnableKeepAlive(redisContext *c) {
     return REDIS_OK;
 }
 
+#ifdef FASTO
+/* Grow read buffer when the last read filled it, so bulk replies are read
+ * with few large reads, shrink it back when reads become small. Failed
+ * reallocation keeps the current buffer. */
+static void __redisAdaptReadBuffer(redisContext *c, size_t nread) {
+    size_t size = c->ibuf_size;
+    char *buf;
+
+    if (nread == c->ibuf_size && size < REDIS_IBUF_MAX) {
+        size *= 2;
+    } else if (nread < c->ibuf_size / 16 && size > REDIS_IBUF_MIN) {
+        size /= 2;
+    } else {
+        return;
+    }
+
+    buf = realloc(c->ibuf, size);
+    if (buf != NULL) {
+        c->ibuf = buf;
+        c->ibuf_size = size;
+    }
+}
+#endif
+
 /* Use this function to handle a read event on the descriptor. It will try
  * and read some bytes from the socket and feed them to the reply parser.
  *
  * After this function is called, you may use redisContextReadReply to
  * see if there is a reply available. */
 int redisBufferRead(redisContext *c) {
+#ifdef FASTO
+    char *buf;
+    size_t size;
+#else
     char buf[1024*16];
+#endif
     int nread;
 
     /* Return early when the context has seen an error. */
@@ -1034,18 +1067,28 @@ int redisBufferRead(redisContext *c) {
         return REDIS_ERR;
 
 #ifdef FASTO
+    if (c->ibuf == NULL) {
+        c->ibuf = malloc(REDIS_IBUF_MIN);
+        if (c->ibuf == NULL) {
+            __redisSetError(c,REDIS_ERR_OOM,"Out of memory");
+            return REDIS_ERR;
+        }
+        c->ibuf_size = REDIS_IBUF_MIN;
+    }
+    buf = c->ibuf;
+    size = c->ibuf_size;
 
     if (c->ssl) {
-        nread = SSL_read(c->ssl, buf, sizeof(buf));
+        nread = SSL_read(c->ssl, buf, size);
     } else if(c->channel) {
-        nread = libssh2_channel_read(c->channel, buf, sizeof(buf));
+        nread = libssh2_channel_read(c->channel, buf, size);
     }
     else{
         #ifdef OS_WIN
             errno = 0;
-            nread = recv(c->fd,buf,sizeof(buf),0);
+            nread = recv(c->fd,buf,size,0);
         #else
-            nread = read(c->fd,buf,sizeof(buf));
+            nread = read(c->fd,buf,size);
         #endif
     }
 
@@ -1064,6 +1107,7 @@ int redisBufferRead(redisContext *c) {
             __redisSetError(c,c->reader->err,c->reader->errstr);
             return REDIS_ERR;
         }
+        __redisAdaptReadBuffer(c,nread);
     }
 #else
     nread = read(c->fd,buf,sizeof(buf));
@@ -1108,7 +1152,23 @@ int redisBufferWrite(redisContext *c, int *done) {
     if (c->ssl) {
         nwritten = SSL_write(c->ssl, c->obuf, sdslen(c->obuf));
     } else if(c->channel){
-        nwritten = libssh2_channel_write(c->channel, c->obuf, sdslen(c->obuf));
+        /* libssh2 sends at most one packet per call, write all queued data
+         * before trimming obuf, so pipelines aren't moved in memory for
+         * every packet. */
+        size_t len = sdslen(c->obuf);
+        ssize_t rc;
+        nwritten = 0;
+        while ((size_t)nwritten < len) {
+            rc = libssh2_channel_write(c->channel, c->obuf + nwritten, len - nwritten);
+            if (rc <= 0) {
+                if (nwritten == 0 && rc != LIBSSH2_ERROR_EAGAIN) {
+                    __redisSetError(c,REDIS_ERR_IO,"Error writing to ssh channel");
+                    return REDIS_ERR;
+                }
+                break;
+            }
+            nwritten += rc;
+        }
     }
     else{
 #ifdef OS_WIN
@@ -1165,6 +1225,16 @@ int redisReadToBuffer(redisContext *c, char* buf, int size, ssize_t *nread)
         return REDIS_ERR;
     }
 
+    /* Bytes returned to the reader (see redisReaderFeed) go first. */
+    if (c->reader->len > c->reader->pos) {
+        size_t avail = c->reader->len - c->reader->pos;
+        size_t len = avail < (size_t)size ? avail : (size_t)size;
+        memcpy(buf, c->reader->buf + c->reader->pos, len);
+        c->reader->pos += len;
+        *nread = len;
+        return REDIS_OK;
+    }
+
     if (c->ssl) {
         *nread = SSL_read(c->ssl, buf, size);
     } else if(c->channel){
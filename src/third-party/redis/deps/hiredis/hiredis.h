@@ -85,6 +85,17 @@
  * SO_REUSEADDR is being used. */
 #define REDIS_CONNECT_RETRIES  10
 
+#ifdef FASTO
+/* Read buffer grows while reads fill it completely (bulk transfers) and
+ * shrinks back when reads are small again. */
+#define REDIS_IBUF_MIN (1024*16)
+#define REDIS_IBUF_MAX (1024*1024*4)
+
+/* Receive window of ssh channels, default one limits throughput of bulk
+ * transfers over high latency links to window/rtt. */
+#define REDIS_SSH_WINDOW_SIZE (1024*1024*8)
+#endif
+
 /* strerror_r has two completely different prototypes and behaviors
  * depending on system issues, so we need to operate on the error buffer
  * differently depending on which strerror_r we're using. */
@@ -174,6 +185,9 @@ typedef struct redisContext {
 
     SSL_CTX *ssl_ctx;
     SSL *ssl;
+
+    char *ibuf; /* Adaptive read buffer */
+    size_t ibuf_size;
 #endif
 } redisContext;
 
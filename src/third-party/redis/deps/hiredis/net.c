@@ -428,11 +428,18 @@ static int _redisContextConnectTcp(redisContext *c, const char *addr, int port,
                                    const char *source_addr) {
 #ifdef FASTO
     if(c->session){
+        unsigned long window;
         if (!(c->channel = libssh2_channel_direct_tcpip(c->session, addr, port))) {
             __redisSetError(c, REDIS_ERR_OTHER, "Unable to open a ssh session");
             return REDIS_ERR;
         }
 
+        /* Enlarge receive window, remote side stops sending when it's full. */
+        window = libssh2_channel_window_read_ex(c->channel, NULL, NULL);
+        if (window < REDIS_SSH_WINDOW_SIZE) {
+            libssh2_channel_receive_window_adjust2(c->channel, REDIS_SSH_WINDOW_SIZE - window, 1, NULL);
+        }
+
         c->flags |= REDIS_CONNECTED;
         return REDIS_OK;
     } else if (c->ssl) {
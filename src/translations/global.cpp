@@ -46,6 +46,7 @@ const QString trFilter = QObject::tr("Filter");
 const QString trView = QObject::tr("View");
 const QString trViews = QObject::tr("Views");
 const QString trHistory = QObject::tr("History");
+const QString trPipeline = QObject::tr("Pipeline");
 const QString trClearHistory = QObject::tr("Clear history");
 const QString trFile = QObject::tr("File");
 const QString trDirectory = QObject::tr("Directory");
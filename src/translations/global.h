@@ -46,6 +46,7 @@ extern const QString trFilter;
 extern const QString trView;
 extern const QString trViews;
 extern const QString trHistory;
+extern const QString trPipeline;
 extern const QString trClearHistory;
 extern const QString trFile;
 extern const QString trDirectory;
@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+
+#include <stdio.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "core/internal/backup.h"
+
+using namespace fastonosql;
+
+namespace {
+const char kDumpPath[] = "test_backup.dump";
+
+typedef std::vector<std::pair<std::string, std::string>> records_t;
+
+records_t MakeRecords() {
+  records_t records;
+  records.push_back(std::make_pair("key", "value"));
+  records.push_back(std::make_pair(std::string(), std::string()));
+  records.push_back(std::make_pair(std::string("b\0in", 4), std::string(1000, '\xff')));
+  return records;
+}
+
+void WriteDump(const records_t& records) {
+  core::internal::DumpWriter writer(kDumpPath, 0);
+  ASSERT_FALSE(writer.Open());
+  for (size_t i = 0; i < records.size(); ++i) {
+    ASSERT_FALSE(writer.Write(records[i].first, records[i].second));
+  }
+  ASSERT_EQ(writer.GetRecordsCount(), records.size());
+  ASSERT_FALSE(writer.Close());
+}
+
+std::string ReadFile() {
+  std::string data;
+  FILE* file = fopen(kDumpPath, "rb");
+  if (!file) {
+    return data;
+  }
+
+  char buff[256];
+  size_t readed = 0;
+  while ((readed = fread(buff, 1, sizeof(buff), file)) > 0) {
+    data.append(buff, readed);
+  }
+  fclose(file);
+  return data;
+}
+
+void WriteFile(const std::string& data) {
+  FILE* file = fopen(kDumpPath, "wb");
+  ASSERT_TRUE(file);
+  ASSERT_EQ(fwrite(data.data(), 1, data.size(), file), data.size());
+  fclose(file);
+}
+
+// reads records till eof or error, returns error of reader
+common::Error ReadAll(core::internal::DumpReader* reader, records_t* records) {
+  while (true) {
+    std::string key;
+    std::string value;
+    bool eof = false;
+    common::Error err = reader->Read(&key, &value, &eof);
+    if (err || eof) {
+      return err;
+    }
+    records->push_back(std::make_pair(key, value));
+  }
+}
+}  // namespace
+
+TEST(Backup, RoundTrip) {
+  const records_t records = MakeRecords();
+  WriteDump(records);
+
+  core::internal::DumpReader reader(kDumpPath);
+  ASSERT_FALSE(reader.Open());
+  ASSERT_FALSE(reader.Validate());
+  ASSERT_EQ(reader.GetProgress(), 0);
+
+  records_t readed;
+  ASSERT_FALSE(ReadAll(&reader, &readed));
+  ASSERT_EQ(readed, records);
+  ASSERT_EQ(reader.GetProgress(), 100);
+  remove(kDumpPath);
+}
+
+TEST(Backup, EmptyDump) {
+  WriteDump(records_t());
+
+  core::internal::DumpReader reader(kDumpPath);
+  ASSERT_FALSE(reader.Open());
+  ASSERT_FALSE(reader.Validate());
+  records_t readed;
+  ASSERT_FALSE(ReadAll(&reader, &readed));
+  ASSERT_TRUE(readed.empty());
+  remove(kDumpPath);
+}
+
+TEST(Backup, Truncated) {
+  WriteDump(MakeRecords());
+  const std::string data = ReadFile();
+  ASSERT_FALSE(data.empty());
+
+  // cut inside last value, inside length of last value and right after last key
+  const size_t cuts[] = {data.size() - 1, data.size() - 1000 - 2, data.size() - 1000 - 4};
+  for (size_t i = 0; i < sizeof(cuts) / sizeof(cuts[0]); ++i) {
+    WriteFile(data.substr(0, cuts[i]));
+
+    core::internal::DumpReader reader(kDumpPath);
+    ASSERT_FALSE(reader.Open());
+    ASSERT_TRUE(reader.Validate());
+
+    records_t readed;
+    ASSERT_TRUE(ReadAll(&reader, &readed));
+    ASSERT_EQ(readed.size(), 2);
+  }
+  remove(kDumpPath);
+}
+
+TEST(Backup, CorruptLength) {
+  WriteDump(MakeRecords());
+  std::string data = ReadFile();
+  data[8] = data[9] = data[10] = data[11] = '\xff';  // first key length 4GB
+  WriteFile(data);
+
+  core::internal::DumpReader reader(kDumpPath);
+  ASSERT_FALSE(reader.Open());
+  ASSERT_TRUE(reader.Validate());
+
+  records_t readed;
+  ASSERT_TRUE(ReadAll(&reader, &readed));  // fails without allocating the length
+  ASSERT_TRUE(readed.empty());
+  remove(kDumpPath);
+}
+
+TEST(Backup, NotDump) {
+  WriteFile("FNSD");
+  {
+    core::internal::DumpReader short_reader(kDumpPath);
+    ASSERT_TRUE(short_reader.Open());
+  }
+
+  WriteFile("NOTADUMP");
+  {
+    core::internal::DumpReader reader(kDumpPath);
+    ASSERT_TRUE(reader.Open());
+  }
+  remove(kDumpPath);
+
+  core::internal::DumpReader missing_reader(kDumpPath);
+  ASSERT_TRUE(missing_reader.Open());
+}
+
+TEST(Backup, ThroughputLimiter) {
+  core::internal::ThroughputLimiter unlimited(0);
+  common::time64_t start = common::time::current_mstime();
+  unlimited.Consume(1024 * 1024 * 1024);
+  ASSERT_LT(common::time::current_mstime() - start, 50);
+
+  core::internal::ThroughputLimiter limiter(1000);  // bytes per second
+  start = common::time::current_mstime();
+  limiter.Consume(100);
+  limiter.Consume(100);
+  ASSERT_GE(common::time::current_mstime() - start, 150);
+}
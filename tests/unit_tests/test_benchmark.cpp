@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <string>
+
+#include "proxy/driver/benchmark.h"
+
+using namespace fastonosql;
+
+namespace {
+const uint64_t kMaxLatency = std::numeric_limits<uint64_t>::max();
+
+// value reported for the bucket of usec, a bigger sample keeps max from clamping it
+uint64_t BucketValue(uint64_t usec) {
+  proxy::LatencyHistogram hist;
+  hist.Record(usec);
+  hist.Record(kMaxLatency);
+  return hist.GetPercentile(50);
+}
+
+// first, first + step, ... up to 1000 usec
+void RecordRange(proxy::LatencyHistogram* hist, uint64_t first, uint64_t step) {
+  for (uint64_t i = first; i <= 1000; i += step) {
+    hist->Record(i);
+  }
+}
+}  // namespace
+
+TEST(LatencyHistogram, Empty) {
+  proxy::LatencyHistogram hist;
+  ASSERT_EQ(hist.GetCount(), 0);
+  ASSERT_EQ(hist.GetMin(), 0);
+  ASSERT_EQ(hist.GetMax(), 0);
+  ASSERT_EQ(hist.GetMean(), 0);
+  ASSERT_EQ(hist.GetPercentile(50), 0);
+}
+
+TEST(LatencyHistogram, ExactBuckets) {
+  for (uint64_t i = 0; i < 128; ++i) {
+    ASSERT_EQ(BucketValue(i), i);
+  }
+}
+
+TEST(LatencyHistogram, BucketEdges) {
+  // 128 and 129 share the first bucket of two values
+  ASSERT_EQ(BucketValue(128), 129);
+  ASSERT_EQ(BucketValue(129), 129);
+  ASSERT_EQ(BucketValue(130), 131);
+  ASSERT_EQ(BucketValue(255), 255);
+  ASSERT_EQ(BucketValue(256), 259);
+
+  // last power of two, buckets are 2^57 wide
+  const uint64_t high = static_cast<uint64_t>(1) << 63;
+  ASSERT_EQ(BucketValue(high), high + (static_cast<uint64_t>(1) << 57) - 1);
+  ASSERT_EQ(BucketValue(kMaxLatency), kMaxLatency);
+
+  proxy::LatencyHistogram hist;
+  hist.Record(kMaxLatency);
+  ASSERT_EQ(hist.GetMin(), kMaxLatency);
+  ASSERT_EQ(hist.GetMax(), kMaxLatency);
+  ASSERT_EQ(hist.GetPercentile(99.9), kMaxLatency);
+}
+
+TEST(LatencyHistogram, Percentiles) {
+  proxy::LatencyHistogram hist;
+  RecordRange(&hist, 1, 1);
+  ASSERT_EQ(hist.GetCount(), 1000);
+  ASSERT_EQ(hist.GetMin(), 1);
+  ASSERT_EQ(hist.GetMax(), 1000);
+  ASSERT_DOUBLE_EQ(hist.GetMean(), 500.5);
+
+  // highest value of bucket: 500..503, 984..991, 992..999
+  ASSERT_EQ(hist.GetPercentile(50), 503);
+  ASSERT_EQ(hist.GetPercentile(99), 991);
+  ASSERT_EQ(hist.GetPercentile(99.9), 999);
+  ASSERT_EQ(hist.GetPercentile(100), 1000);
+  ASSERT_EQ(hist.GetPercentile(0), 1);
+}
+
+TEST(LatencyHistogram, Merge) {
+  proxy::LatencyHistogram odd;
+  RecordRange(&odd, 1, 2);
+  proxy::LatencyHistogram even;
+  RecordRange(&even, 2, 2);
+  proxy::LatencyHistogram empty;
+
+  odd.Merge(even);
+  odd.Merge(empty);
+  ASSERT_EQ(odd.GetCount(), 1000);
+  ASSERT_EQ(odd.GetMin(), 1);
+  ASSERT_EQ(odd.GetMax(), 1000);
+  ASSERT_DOUBLE_EQ(odd.GetMean(), 500.5);
+  ASSERT_EQ(odd.GetPercentile(50), 503);
+  ASSERT_EQ(odd.GetPercentile(99), 991);
+  ASSERT_EQ(odd.GetPercentile(99.9), 999);
+
+  empty.Merge(odd);
+  ASSERT_EQ(empty.GetCount(), 1000);
+  ASSERT_EQ(empty.GetMin(), 1);
+  ASSERT_EQ(empty.GetPercentile(50), 503);
+}
+
+TEST(BenchmarkStats, MergeAndJson) {
+  proxy::BenchmarkStats first;
+  first.Record("get key", 10);
+  first.Record("  SET key value", 20);
+  first.AddError();
+
+  proxy::BenchmarkStats second;
+  second.Record("Get other", 30);
+  second.Record("a\"b", 40);
+  second.AddError();
+
+  first.Merge(second);
+  ASSERT_EQ(first.GetErrorsCount(), 2);
+  ASSERT_EQ(first.ToJson(core::REDIS, 2, 500),
+            "{\"type\":\"Redis\",\"concurrency\":2,\"duration_msec\":500,\"ops\":4,\"errors\":2,\"ops_per_sec\":8.0,"
+            "\"latency_usec\":{\"min\":10,\"mean\":25.0,\"p50\":20,\"p99\":40,\"p999\":40,\"max\":40},"
+            "\"commands\":{"
+            "\"A\\\"B\":{\"ops\":1,\"ops_per_sec\":2.0,"
+            "\"latency_usec\":{\"min\":40,\"mean\":40.0,\"p50\":40,\"p99\":40,\"p999\":40,\"max\":40}},"
+            "\"GET\":{\"ops\":2,\"ops_per_sec\":4.0,"
+            "\"latency_usec\":{\"min\":10,\"mean\":20.0,\"p50\":10,\"p99\":30,\"p999\":30,\"max\":30}},"
+            "\"SET\":{\"ops\":1,\"ops_per_sec\":2.0,"
+            "\"latency_usec\":{\"min\":20,\"mean\":20.0,\"p50\":20,\"p99\":20,\"p999\":20,\"max\":20}}}}");
+
+  // no wall time, no division by zero
+  proxy::BenchmarkStats empty;
+  ASSERT_EQ(empty.ToJson(core::MEMCACHED, 1, 0),
+            "{\"type\":\"Memcached\",\"concurrency\":1,\"duration_msec\":0,\"ops\":0,\"errors\":0,\"ops_per_sec\":0.0,"
+            "\"latency_usec\":{\"min\":0,\"mean\":0.0,\"p50\":0,\"p99\":0,\"p999\":0,\"max\":0},\"commands\":{}}");
+}
@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "core/db/redis/cluster_slots.h"
+
+using namespace fastonosql;
+
+namespace {
+uint16_t slot(const std::string& key) {
+  return core::redis::KeyHashSlot(key.data(), key.size());
+}
+}  // namespace
+
+TEST(ClusterSlots, KeyHashSlot) {
+  ASSERT_EQ(slot("123456789"), 12739);  // CRC16 XMODEM check value
+  ASSERT_EQ(slot("foo"), 12182);
+  ASSERT_EQ(slot("bar"), 5061);
+  ASSERT_EQ(slot(std::string()), 0);
+}
+
+TEST(ClusterSlots, HashTags) {
+  ASSERT_EQ(slot("{user1000}.following"), slot("user1000"));
+  ASSERT_EQ(slot("{user1000}.followers"), slot("{user1000}.following"));
+  ASSERT_EQ(slot("foo{bar}zap{baz}"), slot("bar"));  // only first tag
+  ASSERT_EQ(slot("foo{{bar}}zap"), slot("{bar"));
+  ASSERT_NE(slot("foo{}{bar}"), slot("bar"));  // empty tag: whole key
+  ASSERT_NE(slot("foo{bar"), slot("bar"));  // no closing brace: whole key
+}
+
+TEST(ClusterSlots, ParseClusterRedirection) {
+  core::redis::ClusterRedirection redir;
+  ASSERT_TRUE(core::redis::ParseClusterRedirection("MOVED 3999 127.0.0.1:6381", &redir));
+  ASSERT_FALSE(redir.ask);
+  ASSERT_EQ(redir.slot, 3999);
+  ASSERT_EQ(redir.host.GetHost(), "127.0.0.1");
+  ASSERT_EQ(redir.host.GetPort(), 6381);
+
+  ASSERT_TRUE(core::redis::ParseClusterRedirection("ASK 16383 ::1:7000", &redir));
+  ASSERT_TRUE(redir.ask);
+  ASSERT_EQ(redir.slot, 16383);
+  ASSERT_EQ(redir.host.GetHost(), "::1");
+  ASSERT_EQ(redir.host.GetPort(), 7000);
+
+  ASSERT_FALSE(core::redis::ParseClusterRedirection("ERR unknown command", &redir));
+  ASSERT_FALSE(core::redis::ParseClusterRedirection("MOVED 16384 127.0.0.1:6381", &redir));
+  ASSERT_FALSE(core::redis::ParseClusterRedirection("MOVED 3999", &redir));
+  ASSERT_FALSE(core::redis::ParseClusterRedirection("MOVED 3999 127.0.0.1", &redir));
+  ASSERT_FALSE(core::redis::ParseClusterRedirection("MOVED 3999 127.0.0.1:6381", nullptr));
+}
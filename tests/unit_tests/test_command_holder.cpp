@@ -16,7 +16,7 @@ using namespace fastonosql;
 
 core::internal::CommandHandler* ghand = NULL;
 
-common::Error test(core::internal::CommandHandler* handler, core::commands_args_t argv, core::FastoObject* out) {
+common::Error test(core::internal::CommandHandler* handler, const core::commands_args_t& argv, core::FastoObject* out) {
   UNUSED(argv);
 
   CHECK(handler == ghand);
@@ -144,5 +144,17 @@ TEST(CommandHolder, execute) {
   err = hand->Execute(cmd_get_config_many_args, NULL);
   ASSERT_TRUE(err);
 
+  const core::commands_args_t cmd_lower_set = {"set", "alex", "palec"};
+  err = hand->Execute(cmd_lower_set, NULL);
+  ASSERT_FALSE(err);
+
+  const core::commands_args_t cmd_mixed_get_config = {"Get", "config", "alex"};
+  err = hand->Execute(cmd_mixed_get_config, NULL);
+  ASSERT_FALSE(err);
+
+  const core::commands_args_t cmd_partial_get_config = {GET, "CONF", "alex"};
+  err = hand->Execute(cmd_partial_get_config, NULL);
+  ASSERT_TRUE(err);
+
   delete hand;
 }
@@ -19,3 +19,22 @@ TEST(FastoObject, LifeTimeScope) {
     root->AddChildren(ptr);
   }
 }
+
+TEST(FastoObject, ChildrensLimit) {
+  FastoObjectIPtr root = FastoObject::CreateRoot("root");
+  root->SetChildrensLimit(2);
+  for (int i = 0; i < 5; ++i) {
+    FastoObject* ptr = new FastoObject(root.get(), common::Value::CreateIntegerValue(i), "/n");
+    root->AddChildren(ptr);
+  }
+
+  FastoObject::childs_t childrens = root->GetChildrens();
+  ASSERT_EQ(childrens.size(), 2);
+  ASSERT_EQ(root->GetDroppedChildrensCount(), 3);
+  int first = 0;
+  ASSERT_TRUE(childrens[0]->GetValue()->GetAsInteger(&first));
+  ASSERT_EQ(first, 3);
+  int second = 0;
+  ASSERT_TRUE(childrens[1]->GetValue()->GetAsInteger(&second));
+  ASSERT_EQ(second, 4);
+}
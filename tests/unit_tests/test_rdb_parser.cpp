@@ -0,0 +1,271 @@
+#include <gtest/gtest.h>
+
+#include <string.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "core/db/redis/rdb_parser.h"
+
+using namespace fastonosql;
+
+namespace {
+typedef std::vector<core::redis::RdbKeyInfo> keys_t;
+
+std::string Len(uint64_t len) {
+  if (len < 64) {
+    return std::string(1, static_cast<char>(len));
+  }
+
+  std::string res;
+  if (len < 16384) {
+    res += static_cast<char>(0x40 | (len >> 8));
+    res += static_cast<char>(len & 0xFF);
+    return res;
+  }
+
+  res += '\x80';
+  for (int i = 3; i >= 0; --i) {
+    res += static_cast<char>((len >> (8 * i)) & 0xFF);
+  }
+  return res;
+}
+
+std::string Str(const std::string& str) {
+  return Len(str.size()) + str;
+}
+
+std::string LE(uint64_t value, size_t size) {
+  std::string res;
+  for (size_t i = 0; i < size; ++i) {
+    res += static_cast<char>((value >> (8 * i)) & 0xFF);
+  }
+  return res;
+}
+
+// only headers are parsed, entries are skipped
+std::string Ziplist(uint16_t count) {
+  return LE(11, 4) + LE(10, 4) + LE(count, 2) + "\xff";
+}
+
+std::string Listpack(uint16_t count) {
+  return LE(7, 4) + LE(count, 2) + "\xff";
+}
+
+std::string Intset(uint32_t count) {
+  std::string res = LE(2, 4) + LE(count, 4);
+  for (uint32_t i = 0; i < count; ++i) {
+    res += LE(i, 2);
+  }
+  return res;
+}
+
+std::string Stream(bool v3) {
+  std::string res = Len(1) + Str(std::string(16, '\x01')) + Str(Listpack(10));  // master id, entries
+  res += Len(2);                                                                // length
+  res += Len(5) + Len(0);                                                       // last id
+  if (v3) {
+    res += Len(1) + Len(0) + Len(0) + Len(0) + Len(2);  // first id, max deleted id, entries added
+  }
+  res += Len(1) + Str("group") + Len(5) + Len(0);  // groups, last delivered id
+  if (v3) {
+    res += Len(2);  // entries read
+  }
+  res += Len(1) + std::string(16, '\x02') + LE(1000, 8) + Len(1);  // pel: id, delivery time, delivery count
+  res += Len(1) + Str("consumer") + LE(1000, 8);                     // consumers, seen time
+  if (v3) {
+    res += LE(1000, 8);  // active time
+  }
+  res += Len(1) + std::string(16, '\x02');  // consumer pel
+  return res;
+}
+
+std::string Header() {
+  return "REDIS0011";
+}
+
+std::string Footer() {
+  return "\xff" + std::string(8, '\0');  // EOF, checksum
+}
+
+const std::string kLzfTenA("\x00\x61\xe0\x00\x00", 5);  // "aaaaaaaaaa"
+
+std::string Strings() {
+  const std::string int32("\xc2\x40\xe2\x01\x00", 5);
+  return Header() + "\xfa" + Str("redis-ver") + Str("7.2.0") + "\xfe" + Len(0) + "\xfb" + Len(5) + Len(0) + '\x00' +
+         Str("str") + Str("hello") + '\x00' + Str("raw") + Str(std::string(100, 'x')) + '\x00' + Str("i8") +
+         "\xc0\x7b" + '\x00' + Str("i16") + "\xc1\xfe\xff" + '\x00' + Str("i32") + int32 + Footer();
+}
+
+// reader gives at most chunk bytes per call and 0 bytes at end of data, like closed socket
+common::Error Parse(const std::string& rdb, keys_t* keys, size_t chunk = 3, uint64_t* parsed = nullptr) {
+  size_t pos = 0;
+  core::redis::RdbParser parser(
+      [&rdb, &pos, chunk](char* buf, size_t size, size_t* nread) -> common::Error {
+        const size_t len = std::min(std::min(size, chunk), rdb.size() - pos);
+        memcpy(buf, rdb.data() + pos, len);
+        pos += len;
+        *nread = len;
+        return common::Error();
+      },
+      [keys](const core::redis::RdbKeyInfo& info) { keys->push_back(info); });
+  common::Error err = parser.Parse();
+  if (parsed) {
+    *parsed = parser.GetParsedBytes();
+  }
+  return err;
+}
+}  // namespace
+
+TEST(RdbParser, Strings) {
+  const std::string rdb = Strings();
+  const size_t chunks[] = {1, 3, core::redis::RdbParser::buffer_size};
+  for (size_t i = 0; i < sizeof(chunks) / sizeof(chunks[0]); ++i) {
+    keys_t keys;
+    uint64_t parsed = 0;
+    ASSERT_FALSE(Parse(rdb, &keys, chunks[i], &parsed));
+    ASSERT_EQ(parsed, rdb.size());
+    ASSERT_EQ(keys.size(), 5);
+
+    ASSERT_EQ(keys[0].key, "str");
+    ASSERT_EQ(keys[0].db, 0);
+    ASSERT_EQ(keys[0].type, "string");
+    ASSERT_EQ(keys[0].encoding, "embstr");
+    ASSERT_EQ(keys[0].elements, 5);
+    ASSERT_EQ(keys[0].expire_msec, -1);
+    ASSERT_EQ(keys[0].serialized_size, 11);  // type, key, value
+
+    ASSERT_EQ(keys[1].encoding, "raw");
+    ASSERT_EQ(keys[1].elements, 100);
+    ASSERT_EQ(keys[2].encoding, "int");
+    ASSERT_EQ(keys[2].elements, 3);  // 123
+    ASSERT_EQ(keys[3].elements, 2);  // -2
+    ASSERT_EQ(keys[4].elements, 6);  // 123456
+  }
+}
+
+TEST(RdbParser, Lzf) {
+  keys_t keys;
+  const std::string lzf = "\xc3" + Len(kLzfTenA.size()) + Len(10) + kLzfTenA;
+  ASSERT_FALSE(Parse(Header() + '\x00' + lzf + lzf + Footer(), &keys));
+  ASSERT_EQ(keys.size(), 1);
+  ASSERT_EQ(keys[0].key, std::string(10, 'a'));  // key is decompressed
+  ASSERT_EQ(keys[0].elements, 10);                // value is skipped
+
+  keys.clear();
+  const std::string broken = "\xc3" + Len(kLzfTenA.size()) + Len(11) + kLzfTenA;
+  ASSERT_TRUE(Parse(Header() + '\x00' + broken + lzf + Footer(), &keys));
+  ASSERT_TRUE(keys.empty());
+}
+
+TEST(RdbParser, Encodings) {
+  const std::string rdb = Header() + '\x0a' + Str("zl") + Str(Ziplist(3)) + '\x0c' + Str("zzl") + Str(Ziplist(4)) +
+                          '\x10' + Str("hlp") + Str(Listpack(6)) + '\x14' + Str("slp") + Str(Listpack(5)) + '\x0b' +
+                          Str("is") + Str(Intset(3)) + '\x0e' + Str("ql") + Len(2) + Str(Ziplist(2)) +
+                          Str(Ziplist(3)) + '\x12' + Str("ql2") + Len(2) + Len(2) + Str(Listpack(3)) + Len(1) +
+                          Str("plain") + '\x01' + Str("ll") + Len(2) + Str("a") + Str("b") + '\x05' + Str("zs2") +
+                          Len(1) + Str("m") + LE(0, 8) + '\x03' + Str("zs") + Len(2) + Str("m") + '\x01' + "1" +
+                          Str("n") + "\xfd" + '\x04' + Str("h") + Len(1) + Str("f") + Str("v") + Footer();
+  keys_t keys;
+  ASSERT_FALSE(Parse(rdb, &keys));
+  ASSERT_EQ(keys.size(), 11);
+
+  const struct {
+    const char* type;
+    const char* encoding;
+    uint64_t elements;
+  } expected[] = {{"list", "ziplist", 3},     {"zset", "ziplist", 2},     {"hash", "listpack", 3},
+                  {"set", "listpack", 5},     {"set", "intset", 3},       {"list", "quicklist", 5},
+                  {"list", "quicklist", 4},   {"list", "linkedlist", 2},  {"zset", "skiplist", 1},
+                  {"zset", "skiplist", 2},    {"hash", "hashtable", 1}};
+  for (size_t i = 0; i < keys.size(); ++i) {
+    ASSERT_EQ(keys[i].type, expected[i].type) << keys[i].key;
+    ASSERT_EQ(keys[i].encoding, expected[i].encoding) << keys[i].key;
+    ASSERT_EQ(keys[i].elements, expected[i].elements) << keys[i].key;
+  }
+}
+
+TEST(RdbParser, Stream) {
+  const std::string rdb = Header() + '\x0f' + Str("s1") + Stream(false) + '\x15' + Str("s3") + Stream(true) + '\x00' +
+                          Str("after") + Str("x") + Footer();
+  keys_t keys;
+  ASSERT_FALSE(Parse(rdb, &keys));
+  ASSERT_EQ(keys.size(), 3);
+  ASSERT_EQ(keys[0].type, "stream");
+  ASSERT_EQ(keys[0].elements, 2);
+  ASSERT_EQ(keys[1].type, "stream");
+  ASSERT_EQ(keys[1].elements, 2);
+  ASSERT_EQ(keys[2].key, "after");  // framing of both versions consumed exactly
+}
+
+TEST(RdbParser, Expire) {
+  const std::string rdb = Header() + "\xfc" + LE(1700000000123, 8) + '\x00' + Str("ms") + Str("v") + "\xfd" +
+                          LE(1700000000, 4) + '\x00' + Str("sec") + Str("v") + "\xf8" + Len(100) + "\xf9" + '\x05' +
+                          '\x00' + Str("persist") + Str("v") + "\xfe" + Len(3) + '\x00' + Str("db3") + Str("v") +
+                          Footer();
+  keys_t keys;
+  ASSERT_FALSE(Parse(rdb, &keys));
+  ASSERT_EQ(keys.size(), 4);
+  ASSERT_EQ(keys[0].expire_msec, 1700000000123);
+  ASSERT_EQ(keys[1].expire_msec, 1700000000000);
+  ASSERT_EQ(keys[2].expire_msec, -1);  // expire is not carried to next key
+  ASSERT_EQ(keys[2].db, 0);
+  ASSERT_EQ(keys[3].db, 3);
+}
+
+TEST(RdbParser, Truncated) {
+  const std::string rdb = Strings();
+  for (size_t i = 0; i < rdb.size(); ++i) {
+    keys_t keys;
+    ASSERT_TRUE(Parse(rdb.substr(0, i), &keys)) << i;
+  }
+}
+
+TEST(RdbParser, Corrupt) {
+  keys_t keys;
+  ASSERT_TRUE(Parse("RADIS0011" + Footer(), &keys));
+  ASSERT_TRUE(Parse(Header() + '\x63' + Str("k") + Str("v") + Footer(), &keys));  // unknown type
+
+  // lengths from stream are not allocated up front
+  ASSERT_TRUE(Parse(Header() + '\x00' + Len(16 * 1024 * 1024) + Str("v") + Footer(), &keys));
+  ASSERT_TRUE(Parse(Header() + '\x00' + std::string("\x81\x00\x00\x01\x00\x00\x00\x00\x00", 9) + Footer(), &keys));
+  const std::string lzf_ratio = "\xc3" + Len(kLzfTenA.size()) + Len(10000) + kLzfTenA;
+  ASSERT_TRUE(Parse(Header() + '\x00' + lzf_ratio + Str("v") + Footer(), &keys));
+  ASSERT_TRUE(keys.empty());
+}
+
+TEST(RdbMemoryReport, MakeValue) {
+  core::redis::RdbMemoryReport report(":", 2);
+  const struct {
+    const char* key;
+    const char* type;
+    uint64_t size;
+  } keys[] = {{"user:1", "string", 100}, {"user:2", "hash", 300}, {"session:1", "string", 50}, {"plain", "string", 10}};
+  for (size_t i = 0; i < sizeof(keys) / sizeof(keys[0]); ++i) {
+    core::redis::RdbKeyInfo info;
+    info.key = keys[i].key;
+    info.type = keys[i].type;
+    info.serialized_size = keys[i].size;
+    report.AddKey(info);
+  }
+  ASSERT_EQ(report.GetKeysCount(), 4);
+  ASSERT_EQ(report.GetTotalSize(), 460);
+
+  std::unique_ptr<common::ArrayValue> value(report.MakeValue());
+  std::vector<std::string> lines;
+  for (size_t i = 0; i < value->GetSize(); ++i) {
+    std::string line;
+    ASSERT_TRUE(value->GetString(i, &line));
+    lines.push_back(line);
+  }
+  ASSERT_EQ(lines.size(), 7);
+  ASSERT_EQ(lines[0], "Total: 4 keys, 460 bytes");
+  ASSERT_EQ(lines[1], "Type hash: 1 keys, 300 bytes");
+  ASSERT_EQ(lines[2], "Type string: 3 keys, 160 bytes");
+  ASSERT_EQ(lines[3].find("Biggest key db0 'user:2'"), 0);  // biggest first
+  ASSERT_EQ(lines[4].find("Biggest key db0 'user:1'"), 0);
+  ASSERT_EQ(lines[5], "Prefix user:: 2 keys, 400 bytes");
+  ASSERT_EQ(lines[6], "Prefix session:: 1 keys, 50 bytes");
+}
@@ -0,0 +1,317 @@
+#include <gtest/gtest.h>
+
+#include <limits.h>
+
+#include <memory>
+#include <string>
+
+#include <common/value.h>
+
+#include "core/db/redis/server_info.h"
+
+using namespace fastonosql;
+
+namespace {
+// INFO reply of redis 3.2, sections are separated by empty lines, unknown labels are kept
+const char kInfoReply[] =
+    "# Server\n"
+    "redis_version:3.2.8\n"
+    "redis_git_sha1:00000000\n"
+    "redis_git_dirty:0\n"
+    "redis_build_id:dd0c4e1ff1c8b5a7\n"
+    "redis_mode:standalone\n"
+    "os:Linux 4.9.0-3-amd64 x86_64\n"
+    "arch_bits:64\n"
+    "multiplexing_api:epoll\n"
+    "gcc_version:6.3.0\n"
+    "process_id:1215\n"
+    "run_id:54e8a3f4c2bc3a5d9b0e7d8f2a1c6b4e3d2f1a0b\n"
+    "tcp_port:6379\n"
+    "uptime_in_seconds:86427\n"
+    "uptime_in_days:1\n"
+    "hz:10\n"
+    "lru_clock:9214361\n"
+    "executable:/usr/bin/redis-server\n"
+    "config_file:/etc/redis/redis.conf\n"
+    "\n"
+    "# Clients\n"
+    "connected_clients:3\n"
+    "client_longest_output_list:0\n"
+    "client_biggest_input_buf:14\n"
+    "blocked_clients:1\n"
+    "\n"
+    "# Memory\n"
+    "used_memory:856344\n"
+    "used_memory_human:836.27K\n"
+    "used_memory_rss:3842048\n"
+    "used_memory_rss_human:3.66M\n"
+    "used_memory_peak:917808\n"
+    "used_memory_peak_human:896.30K\n"
+    "total_system_memory:8264462336\n"
+    "used_memory_lua:37888\n"
+    "mem_fragmentation_ratio:4.49\n"
+    "mem_allocator:jemalloc-4.0.3\n"
+    "\n"
+    "# Persistence\n"
+    "loading:0\n"
+    "rdb_changes_since_last_save:12\n"
+    "rdb_bgsave_in_progress:0\n"
+    "rdb_last_save_time:1497335062\n"
+    "rdb_last_bgsave_status:ok\n"
+    "rdb_last_bgsave_time_sec:0\n"
+    "rdb_current_bgsave_time_sec:-1\n"
+    "aof_enabled:1\n"
+    "aof_rewrite_in_progress:0\n"
+    "aof_rewrite_scheduled:0\n"
+    "aof_last_rewrite_time_sec:2\n"
+    "aof_current_rewrite_time_sec:-1\n"
+    "aof_last_bgrewrite_status:ok\n"
+    "aof_last_write_status:err\n"
+    "\n"
+    "# Stats\n"
+    "total_connections_received:145\n"
+    "total_commands_processed:20733\n"
+    "instantaneous_ops_per_sec:7\n"
+    "total_net_input_bytes:1094332\n"
+    "rejected_connections:2\n"
+    "sync_full:1\n"
+    "sync_partial_ok:3\n"
+    "sync_partial_err:4\n"
+    "expired_keys:5\n"
+    "evicted_keys:6\n"
+    "keyspace_hits:7000\n"
+    "keyspace_misses:800\n"
+    "pubsub_channels:9\n"
+    "pubsub_patterns:10\n"
+    "latest_fork_usec:427\n"
+    "\n"
+    "# Replication\n"
+    "role:master\n"
+    "connected_slaves:1\n"
+    "slave0:ip=127.0.0.1,port=6380,state=online,offset=4561,lag=0\n"
+    "master_repl_offset:4561\n"
+    "repl_backlog_active:1\n"
+    "repl_backlog_size:1048576\n"
+    "repl_backlog_first_byte_offset:2\n"
+    "repl_backlog_histlen:4560\n"
+    "\n"
+    "# CPU\n"
+    "used_cpu_sys:61.35\n"
+    "used_cpu_user:30.5\n"
+    "used_cpu_sys_children:0.25\n"
+    "used_cpu_user_children:0\n"
+    "\n"
+    "# Keyspace\n"
+    "db0:keys=10,expires=1,avg_ttl=0\n";
+
+std::string ToCRLF(const std::string& text) {
+  std::string result;
+  for (size_t i = 0; i < text.size(); ++i) {
+    if (text[i] == '\n') {
+      result += '\r';
+    }
+    result += text[i];
+  }
+  return result;
+}
+
+std::unique_ptr<common::Value> GetValue(const core::IServerInfo* info, unsigned char property, unsigned char field) {
+  return std::unique_ptr<common::Value>(info->GetValueByIndexes(property, field));
+}
+
+std::string GetString(const core::IServerInfo* info, unsigned char property, unsigned char field) {
+  std::string result;
+  std::unique_ptr<common::Value> value = GetValue(info, property, field);
+  EXPECT_TRUE(value && value->GetAsString(&result));
+  return result;
+}
+
+unsigned int GetUInteger(const core::IServerInfo* info, unsigned char property, unsigned char field) {
+  unsigned int result = 0;
+  std::unique_ptr<common::Value> value = GetValue(info, property, field);
+  EXPECT_TRUE(value && value->GetAsUInteger(&result));
+  return result;
+}
+
+int GetInteger(const core::IServerInfo* info, unsigned char property, unsigned char field) {
+  int result = 0;
+  std::unique_ptr<common::Value> value = GetValue(info, property, field);
+  EXPECT_TRUE(value && value->GetAsInteger(&result));
+  return result;
+}
+
+double GetDouble(const core::IServerInfo* info, unsigned char property, unsigned char field) {
+  double result = 0;
+  std::unique_ptr<common::Value> value = GetValue(info, property, field);
+  EXPECT_TRUE(value && value->GetAsDouble(&result));
+  return result;
+}
+
+std::unique_ptr<core::IServerInfo> Parse(const std::string& content) {
+  return std::unique_ptr<core::IServerInfo>(core::redis::MakeRedisServerInfo(content));
+}
+
+void CheckInfoReply(const core::IServerInfo* info) {
+  ASSERT_TRUE(info);
+
+  // server
+  ASSERT_EQ(GetString(info, 0, 0), "3.2.8");
+  ASSERT_EQ(GetString(info, 0, 1), "00000000");
+  ASSERT_EQ(GetString(info, 0, 2), "0");
+  ASSERT_EQ(GetString(info, 0, 3), "dd0c4e1ff1c8b5a7");
+  ASSERT_EQ(GetString(info, 0, 4), "standalone");
+  ASSERT_EQ(GetString(info, 0, 5), "Linux 4.9.0-3-amd64 x86_64");
+  ASSERT_EQ(GetUInteger(info, 0, 6), 64);
+  ASSERT_EQ(GetString(info, 0, 7), "epoll");
+  ASSERT_EQ(GetString(info, 0, 8), "6.3.0");
+  ASSERT_EQ(GetUInteger(info, 0, 9), 1215);
+  ASSERT_EQ(GetString(info, 0, 10), "54e8a3f4c2bc3a5d9b0e7d8f2a1c6b4e3d2f1a0b");
+  ASSERT_EQ(GetUInteger(info, 0, 11), 6379);
+  ASSERT_EQ(GetUInteger(info, 0, 12), 86427);
+  ASSERT_EQ(GetUInteger(info, 0, 13), 1);
+  ASSERT_EQ(GetUInteger(info, 0, 14), 10);
+  ASSERT_EQ(GetUInteger(info, 0, 15), 9214361);
+
+  // clients
+  ASSERT_EQ(GetUInteger(info, 1, 0), 3);
+  ASSERT_EQ(GetUInteger(info, 1, 1), 0);
+  ASSERT_EQ(GetUInteger(info, 1, 2), 14);
+  ASSERT_EQ(GetUInteger(info, 1, 3), 1);
+
+  // memory
+  ASSERT_EQ(GetUInteger(info, 2, 0), 856344);
+  ASSERT_EQ(GetString(info, 2, 1), "836.27K");
+  ASSERT_EQ(GetUInteger(info, 2, 2), 3842048);
+  ASSERT_EQ(GetUInteger(info, 2, 3), 917808);
+  ASSERT_EQ(GetString(info, 2, 4), "896.30K");
+  ASSERT_EQ(GetUInteger(info, 2, 5), 37888);
+  ASSERT_NEAR(GetDouble(info, 2, 6), 4.49, 0.001);
+  ASSERT_EQ(GetString(info, 2, 7), "jemalloc-4.0.3");
+
+  // persistence
+  ASSERT_EQ(GetUInteger(info, 3, 0), 0);
+  ASSERT_EQ(GetUInteger(info, 3, 1), 12);
+  ASSERT_EQ(GetUInteger(info, 3, 2), 0);
+  ASSERT_EQ(GetUInteger(info, 3, 3), 1497335062);
+  ASSERT_EQ(GetString(info, 3, 4), "ok");
+  ASSERT_EQ(GetInteger(info, 3, 5), 0);
+  ASSERT_EQ(GetInteger(info, 3, 6), -1);
+  ASSERT_EQ(GetUInteger(info, 3, 7), 1);
+  ASSERT_EQ(GetUInteger(info, 3, 8), 0);
+  ASSERT_EQ(GetUInteger(info, 3, 9), 0);
+  ASSERT_EQ(GetInteger(info, 3, 10), 2);
+  ASSERT_EQ(GetInteger(info, 3, 11), -1);
+  ASSERT_EQ(GetString(info, 3, 12), "ok");
+  ASSERT_EQ(GetString(info, 3, 13), "err");
+
+  // stats
+  const unsigned int stats[] = {145, 20733, 7, 2, 1, 3, 4, 5, 6, 7000, 800, 9, 10, 427};
+  for (unsigned char i = 0; i < sizeof(stats) / sizeof(stats[0]); ++i) {
+    ASSERT_EQ(GetUInteger(info, 4, i), stats[i]);
+  }
+
+  // replication
+  ASSERT_EQ(GetString(info, 5, 0), "master");
+  ASSERT_EQ(GetUInteger(info, 5, 1), 1);
+  ASSERT_EQ(GetUInteger(info, 5, 2), 4561);
+  ASSERT_EQ(GetUInteger(info, 5, 3), 1);
+  ASSERT_EQ(GetUInteger(info, 5, 4), 1048576);
+  ASSERT_EQ(GetUInteger(info, 5, 5), 2);
+  ASSERT_EQ(GetUInteger(info, 5, 6), 4560);
+
+  // cpu
+  ASSERT_NEAR(GetDouble(info, 6, 0), 61.35, 0.001);
+  ASSERT_NEAR(GetDouble(info, 6, 1), 30.5, 0.001);
+  ASSERT_NEAR(GetDouble(info, 6, 2), 0.25, 0.001);
+  ASSERT_NEAR(GetDouble(info, 6, 3), 0, 0.001);
+
+  // keyspace
+  ASSERT_FALSE(GetValue(info, 7, 0));
+}
+}  // namespace
+
+TEST(ServerInfo, Empty) {
+  ASSERT_FALSE(Parse(std::string()));
+
+  std::unique_ptr<core::IServerInfo> info = Parse("# Server\n");
+  ASSERT_TRUE(info);
+  ASSERT_EQ(GetString(info.get(), 0, 0), std::string());
+  ASSERT_EQ(GetUInteger(info.get(), 0, 9), 0);
+  ASSERT_NEAR(GetDouble(info.get(), 6, 0), 0, 0.001);
+}
+
+TEST(ServerInfo, LineEndings) {
+  const std::string lf = kInfoReply;
+  std::unique_ptr<core::IServerInfo> info = Parse(lf);
+  CheckInfoReply(info.get());
+
+  // redis replies with CRLF, no '\r' must end up in values
+  info = Parse(ToCRLF(lf));
+  CheckInfoReply(info.get());
+
+  // last line without line ending
+  info = Parse(lf + "used_cpu_user_children:1.5");
+  ASSERT_NEAR(GetDouble(info.get(), 6, 3), 1.5, 0.001);
+  info = Parse(ToCRLF(lf) + "mem_allocator:libc");
+  ASSERT_EQ(GetString(info.get(), 2, 7), "libc");
+}
+
+TEST(ServerInfo, OutOfRange) {
+  std::unique_ptr<core::IServerInfo> info = Parse(
+      "process_id:99999999999\r\n"
+      "used_memory:4294967296\r\n"
+      "used_memory_rss:4294967295\r\n"
+      "rdb_last_bgsave_time_sec:2147483648\r\n"
+      "rdb_current_bgsave_time_sec:-2147483648\r\n"
+      "aof_last_rewrite_time_sec:-2147483649\r\n"
+      "aof_current_rewrite_time_sec:2147483647\r\n");
+  ASSERT_EQ(GetUInteger(info.get(), 0, 9), 0);
+  ASSERT_EQ(GetUInteger(info.get(), 2, 0), 0);
+  ASSERT_EQ(GetUInteger(info.get(), 2, 2), 4294967295U);
+  ASSERT_EQ(GetInteger(info.get(), 3, 5), 0);
+  ASSERT_EQ(GetInteger(info.get(), 3, 6), INT_MIN);
+  ASSERT_EQ(GetInteger(info.get(), 3, 10), 0);
+  ASSERT_EQ(GetInteger(info.get(), 3, 11), INT_MAX);
+}
+
+TEST(ServerInfo, NotNumeric) {
+  std::unique_ptr<core::IServerInfo> info = Parse(
+      "arch_bits:abc\r\n"
+      "process_id:12x\r\n"
+      "tcp_port:\r\n"
+      "hz:-\r\n"
+      "lru_clock:-1\r\n"
+      "uptime_in_days: 1\r\n"
+      "rdb_last_bgsave_time_sec:-\r\n"
+      "aof_last_rewrite_time_sec:--1\r\n");
+  for (unsigned char i = 6; i < 16; ++i) {
+    if (i == 7 || i == 8 || i == 10) {  // strings
+      continue;
+    }
+    ASSERT_EQ(GetUInteger(info.get(), 0, i), 0);
+  }
+  ASSERT_EQ(GetInteger(info.get(), 3, 5), 0);
+  ASSERT_EQ(GetInteger(info.get(), 3, 10), 0);
+
+  // the last valid value wins, broken one doesn't reset it
+  info = Parse("tcp_port:6379\ntcp_port:63x79\n");
+  ASSERT_EQ(GetUInteger(info.get(), 0, 11), 6379);
+}
+
+TEST(ServerInfo, Float) {
+  std::unique_ptr<core::IServerInfo> info = Parse(
+      "used_cpu_sys:1.5\r\n"
+      "used_cpu_user:1e2\r\n"
+      "used_cpu_sys_children:abc\r\n"
+      "used_cpu_user_children:1.5x\r\n"
+      "mem_fragmentation_ratio:\r\n");
+  ASSERT_NEAR(GetDouble(info.get(), 6, 0), 1.5, 0.001);
+  ASSERT_NEAR(GetDouble(info.get(), 6, 1), 100, 0.001);
+  ASSERT_NEAR(GetDouble(info.get(), 6, 2), 0, 0.001);
+  ASSERT_NEAR(GetDouble(info.get(), 6, 3), 0, 0.001);
+  ASSERT_NEAR(GetDouble(info.get(), 2, 6), 0, 0.001);
+
+  // value followed by the next line isn't glued to it
+  info = Parse("used_cpu_sys:0.25\n5\n");
+  ASSERT_NEAR(GetDouble(info.get(), 6, 0), 0.25, 0.001);
+}
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+
+#include <common/macros.h>  // for SIZEOFMASS
+
+#include "core/db_key.h"
+#include "core/value.h"
+
+using namespace fastonosql;
+
+TEST(Value, HexString) {
+  ASSERT_EQ(core::detail::hex_string(std::string()), std::string());
+  ASSERT_EQ(core::detail::hex_string(std::string("\x00\xff", 2)), "\\x00\\xff");
+
+  std::string raw;
+  for (int i = 0; i < 300; ++i) {  // covers vector and scalar tails
+    raw += static_cast<char>(i * 7);
+    std::string hexed = core::detail::hex_string(raw);
+    ASSERT_EQ(hexed.size(), raw.size() * 4);
+    ASSERT_EQ(core::detail::string_from_hex(hexed), raw);
+  }
+}
+
+TEST(Value, StringFromHex) {
+  ASSERT_EQ(core::detail::string_from_hex(std::string("\\x4A\\x6b")), "Jk");
+  ASSERT_EQ(core::detail::string_from_hex(std::string("\\x4")), std::string());
+  ASSERT_EQ(core::detail::string_from_hex(std::string("\\x4g")), std::string());
+  ASSERT_EQ(core::detail::string_from_hex(std::string("/x41")), std::string());
+
+  std::string hexed = core::detail::hex_string(std::string(100, 'a'));
+  hexed[70] = 'z';
+  ASSERT_EQ(core::detail::string_from_hex(hexed), std::string());
+}
+
+// micro-benchmark, skipped by default, run with --gtest_also_run_disabled_tests --gtest_filter=*HexBenchmark
+TEST(Value, DISABLED_HexBenchmark) {
+  std::string raw(16 * 1024 * 1024, 0);
+  for (size_t i = 0; i < raw.size(); ++i) {
+    raw[i] = static_cast<char>(i * 31);
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  std::string hexed = core::detail::hex_string(raw);
+  const auto encoded = std::chrono::steady_clock::now();
+  std::string decoded = core::detail::string_from_hex(hexed);
+  const auto finished = std::chrono::steady_clock::now();
+  ASSERT_EQ(decoded, raw);
+
+  const double mb = raw.size() / (1024.0 * 1024.0);
+  std::cout << "hex encode: " << mb / std::chrono::duration<double>(encoded - start).count() << " MB/s, decode: "
+            << mb / std::chrono::duration<double>(finished - encoded).count() << " MB/s" << std::endl;
+}
+
+TEST(Value, ConvertContainers) {
+  common::ArrayValue* array = common::Value::CreateArrayValue();
+  array->Append(common::Value::CreateStringValue("a b"));
+  array->Append(common::Value::CreateStringValue(std::string()));
+  array->Append(common::Value::CreateIntegerValue(5));
+  common::ArrayValue* empty = common::Value::CreateArrayValue();
+  array->Append(empty);
+  ASSERT_EQ(core::ConvertValue(array, ",", true), "\"a b\",5");
+  ASSERT_EQ(core::ConvertValue(array, ",", false), "a b,5");
+
+  std::string streamed;
+  {
+    core::BufferedValueSink sink(
+        [&streamed](const char* data, size_t size) {
+          streamed.append(data, size);
+          return true;
+        },
+        3);
+    core::WriteValue(array, ",", true, &sink);
+  }
+  ASSERT_EQ(streamed, "\"a b\",5");
+  delete array;
+
+  common::HashValue* hash = common::Value::CreateHashValue();
+  hash->Insert("key", "value");
+  ASSERT_EQ(core::ConvertValue(hash, ";", false), "key value");
+  delete hash;
+}
+
+TEST(Value, ConvertValueToArgs) {
+  const std::string binary("\x00\xff \"\n", 5);
+  core::commands_args_t args;
+  common::ArrayValue* array = common::Value::CreateArrayValue();
+  array->Append(common::Value::CreateStringValue(binary));
+  array->Append(common::Value::CreateStringValue(std::string()));
+  array->Append(common::Value::CreateIntegerValue(5));
+  core::ConvertValueToArgs(array, &args);
+  delete array;
+  ASSERT_EQ(args, core::commands_args_t({binary, std::string(), "5"}));
+
+  args.clear();
+  common::ZSetValue* zset = common::Value::CreateZSetValue();
+  zset->Insert("1.5", binary);
+  core::ConvertValueToArgs(zset, &args);
+  delete zset;
+  ASSERT_EQ(args, core::commands_args_t({"1.5", binary}));
+
+  args.clear();
+  common::HashValue* hash = common::Value::CreateHashValue();
+  hash->Insert(binary, std::string());
+  core::ConvertValueToArgs(hash, &args);
+  delete hash;
+  ASSERT_EQ(args, core::commands_args_t({binary, std::string()}));
+}
+
+TEST(Value, ArgsCommandLineRoundTrip) {
+  const core::commands_args_t cases[] = {
+      {"SET", "key", "value"},
+      {"SET", "key with spaces", std::string()},
+      {"HSET", std::string("\x00\x01\x02", 3), std::string("field\n"), std::string("\xff\xfe", 2)},
+      {"ZADD", "zset", "1", std::string("a\x00b", 3), "2", std::string()},
+  };
+
+  for (size_t i = 0; i < SIZEOFMASS(cases); ++i) {
+    const core::command_buffer_t line = core::ConvertArgsToCommandLine(cases[i]);
+    core::commands_args_t parsed;
+    ASSERT_TRUE(core::SplitCommandArgs(line, &parsed)) << line;
+    ASSERT_EQ(parsed, cases[i]) << line;
+  }
+}